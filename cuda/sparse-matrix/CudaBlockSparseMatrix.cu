@@ -643,3 +643,82 @@ extern "C" __global__ void setupBlocksForBatchedSgemm(float** array, float* base
 	}	
 }
 
+// These match minerva::matrix::ActivationFunction
+enum ActivationType
+{
+	Sigmoid,
+	RectifiedLinear,
+	LeakyRectifiedLinear,
+	HardSigmoid,
+	Tanh
+};
+
+__device__ float computeActivation(uint64_t activation, float v)
+{
+	switch(activation)
+	{
+	case RectifiedLinear:      return v > 0.0f ? v : 0.0f;
+	case LeakyRectifiedLinear: return v > 0.0f ? v : 0.01f * v;
+	case HardSigmoid:          return min(1.0f, max(0.0f, 0.2f * v + 0.5f));
+	case Tanh:                 return 2.0f * computeSigmoid(2.0f * v) - 1.0f;
+	default:                   return computeSigmoid(v);
+	}
+}
+
+__device__ float computeActivationDerivative(uint64_t activation, float y)
+{
+	switch(activation)
+	{
+	case RectifiedLinear:      return y > 0.0f ? 1.0f : 0.0f;
+	case LeakyRectifiedLinear: return y > 0.0f ? 1.0f : 0.01f;
+	case HardSigmoid:          return (y > 0.0f && y < 1.0f) ? 0.2f : 0.0f;
+	case Tanh:                 return 1.0f - y * y;
+	default:                   return computeSigmoidDerivative(y);
+	}
+}
+
+extern "C" __global__ void activationDerivativeSelf(float* result, uint64_t activation, uint64_t size)
+{
+	uint64_t step  = blockDim.x * gridDim.x;
+	uint64_t start = blockIdx.x * blockDim.x + threadIdx.x;
+
+	for(uint64_t i = start; i < size; i += step)
+	{
+		result[i] = computeActivationDerivative(activation, result[i]);
+	}
+}
+
+extern "C" __global__ void addBiasAndActivate(float* result, float* derivative, const float* bias,
+	uint64_t activation, uint64_t resultBlocks, uint64_t biasBlocks, uint64_t rows, uint64_t columns)
+{
+	uint64_t step  = blockDim.x * gridDim.x;
+	uint64_t start = blockIdx.x * blockDim.x + threadIdx.x;
+	uint64_t size  = resultBlocks * rows * columns;
+
+	uint64_t blockSize = rows * columns;
+
+	for(uint64_t i = start; i < size; i += step)
+	{
+		float value = result[i];
+
+		// bias blocks map onto result blocks as in convolutionalAddBroadcastRow
+		if(biasBlocks > 0)
+		{
+			uint64_t indexInBlock  = i % blockSize;
+			uint64_t resultBlockId = i / blockSize;
+			uint64_t biasBlockId   = (resultBlockId * biasBlocks) / resultBlocks;
+
+			value += bias[biasBlockId * columns + (indexInBlock % columns)];
+		}
+
+		value = computeActivation(activation, value);
+
+		result[i] = value;
+
+		if(derivative != 0)
+		{
+			derivative[i] = computeActivationDerivative(activation, value);
+		}
+	}
+}
+
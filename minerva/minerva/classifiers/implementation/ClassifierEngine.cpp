@@ -14,9 +14,15 @@
 #include <minerva/results/interface/LabelResult.h>
 #include <minerva/results/interface/ResultVector.h>
 
+#include <minerva/model/interface/Model.h>
+
 #include <minerva/matrix/interface/Matrix.h>
 
 #include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+
+// Standard Library Includes
+#include <stdexcept>
 
 namespace minerva
 {
@@ -24,6 +30,9 @@ namespace minerva
 namespace classifiers
 {
 
+static util::Knob<bool> useInt8Knob("ClassifierEngine::UseInt8", false,
+	"Classify with the int8 calibration saved in the model");
+
 ClassifierEngine::ClassifierEngine()
 : _shouldUseLabeledData(false)
 {
@@ -40,7 +49,7 @@ void ClassifierEngine::setUseLabeledData(bool shouldUse)
 	_shouldUseLabeledData = shouldUse;
 }
 
-util::StringVector convertActivationsToLabels(matrix::Matrix&& activations,
+util::StringVector convertActivationsToLabels(const matrix::Matrix& activations,
 	const neuralnetwork::NeuralNetwork& network)
 {
 	size_t samples = activations.rows();
@@ -95,22 +104,67 @@ results::ResultVector recordLabels(const util::StringVector& labels)
 
 ClassifierEngine::ResultVector ClassifierEngine::runOnBatch(Matrix&& input, Matrix&& reference)
 {
-	auto network = getAggregateNetwork();
+	auto& network = getLabeledNetwork();
 	
-	auto result = network.runInputs(std::move(input));
+	auto& result = _plan.runInputs(input);
 
-	auto labels = convertActivationsToLabels(std::move(result), network);
-	
-	restoreAggregateNetwork(network);
+	auto labels = convertActivationsToLabels(result, network);
 	
 	if(_shouldUseLabeledData)
 	{
-		return compareWithReference(labels, convertActivationsToLabels(std::move(reference), network));
+		return compareWithReference(labels, convertActivationsToLabels(reference, network));
 	}
 	
 	return recordLabels(labels);
 }
 
+void ClassifierEngine::registerModel()
+{
+	buildPlan(_plan);
+	
+	if(!useInt8Knob)
+	{
+		return;
+	}
+	
+	if(!_model->hasAttribute("int8-calibration"))
+	{
+		throw std::runtime_error("Model '" + _model->path() + "' has no int8 "
+			"calibration, run minerva-classifier --quantize on it first.");
+	}
+	
+	_plan.setCalibration(_model->getAttribute("int8-calibration"));
+	_plan.quantize();
+}
+
+void ClassifierEngine::closeModel()
+{
+	_plan.clear();
+}
+
+const ClassifierEngine::NeuralNetwork& ClassifierEngine::getLabeledNetwork() const
+{
+	return _model->getNeuralNetwork("Classifier");
+}
+
+util::StringVector ClassifierEngine::getLabels(const Matrix& activations) const
+{
+	return convertActivationsToLabels(activations, getLabeledNetwork());
+}
+
+void ClassifierEngine::buildPlan(neuralnetwork::InferencePlan& plan) const
+{
+	size_t batchSize = util::KnobDatabase::getKnobValue(
+		"InputDataProducer::BatchSize", 64);
+	
+	neuralnetwork::InferencePlan::NeuralNetworkVector networks;
+	
+	networks.push_back(&_model->getNeuralNetwork("FeatureSelector"));
+	networks.push_back(&_model->getNeuralNetwork("Classifier"));
+	
+	plan.build(networks, batchSize);
+}
+
 bool ClassifierEngine::requiresLabeledData() const
 {
 	return _shouldUseLabeledData;
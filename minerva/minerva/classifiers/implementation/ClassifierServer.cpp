@@ -0,0 +1,601 @@
+/*	\file   ClassifierServer.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The source file for the ClassifierServer class.
+*/
+
+// Minerva Includes
+#include <minerva/classifiers/interface/ClassifierServer.h>
+
+#include <minerva/neuralnetwork/interface/NeuralNetwork.h>
+#include <minerva/neuralnetwork/interface/InferencePlan.h>
+
+#include <minerva/model/interface/Model.h>
+
+#include <minerva/video/interface/Image.h>
+#include <minerva/video/interface/ImageVector.h>
+
+#include <minerva/matrix/interface/Matrix.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/math.h>
+#include <minerva/util/interface/Metrics.h>
+
+// System Includes
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+// Standard Library Includes
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <set>
+#include <sstream>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+typedef std::chrono::steady_clock Clock;
+
+static util::Counter& serverRequests = util::Metrics::getCounter(
+	"minerva_server_requests_total", "Requests answered by the classifier server.");
+static util::Histogram& serverLatency = util::Metrics::getHistogram(
+	"minerva_server_request_seconds", "Time from a request arriving to its answer.");
+static util::Gauge& serverQueueDepth = util::Metrics::getGauge(
+	"minerva_server_queue_depth", "Requests waiting for a batch.");
+
+static util::Knob<size_t> latencyWindowKnob("ClassifierServer::LatencyWindow",
+	10000, "The number of recent request latencies kept for percentiles");
+
+static double getSecondsSince(const Clock::time_point& start)
+{
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+class ClassifierServer::Request
+{
+public:
+	Request(const video::Image& image)
+	: image(image), arrivalTime(Clock::now())
+	{
+	
+	}
+
+public:
+	video::Image              image;
+	Clock::time_point         arrivalTime;
+	std::promise<std::string> label;
+
+};
+
+/*! \brief The queue of pending requests, drained by the dynamic batcher. */
+class ClassifierServer::RequestQueue
+{
+public:
+	RequestQueue()
+	: _stopped(false)
+	{
+	
+	}
+
+public:
+	void push(RequestPointer request)
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			
+			if(_stopped)
+			{
+				request->label.set_exception(std::make_exception_ptr(
+					std::runtime_error("Server is shutting down.")));
+				
+				return;
+			}
+			
+			_requests.push_back(request);
+		}
+		
+		_condition.notify_all();
+	}
+
+	/*! \brief Wait for a batch of requests.
+	
+		The batch is released once it holds 'maximumBatchSize' requests, or
+		once the oldest request has waited for 'maximumWait'.  Returns false
+		once the queue is stopped.
+	*/
+	bool pop(RequestVector& batch, size_t maximumBatchSize,
+		const Clock::duration& maximumWait)
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		_condition.wait(lock, [this]() { return !_requests.empty() || _stopped; });
+		
+		if(_stopped)
+		{
+			return false;
+		}
+		
+		auto deadline = _requests.front()->arrivalTime + maximumWait;
+		
+		_condition.wait_until(lock, deadline, [this, maximumBatchSize]()
+		{
+			return _requests.size() >= maximumBatchSize || _stopped;
+		});
+		
+		while(!_requests.empty() && batch.size() < maximumBatchSize)
+		{
+			batch.push_back(_requests.front());
+			_requests.pop_front();
+		}
+		
+		return !batch.empty();
+	}
+
+	void stop()
+	{
+		std::deque<RequestPointer> abandoned;
+		
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			
+			_stopped = true;
+			
+			std::swap(abandoned, _requests);
+		}
+		
+		for(auto& request : abandoned)
+		{
+			request->label.set_exception(std::make_exception_ptr(
+				std::runtime_error("Server is shutting down.")));
+		}
+		
+		_condition.notify_all();
+	}
+
+	size_t size() const
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		return _requests.size();
+	}
+
+private:
+	std::deque<RequestPointer> _requests;
+	bool                       _stopped;
+
+private:
+	mutable std::mutex      _mutex;
+	std::condition_variable _condition;
+
+};
+
+/*! \brief Throughput and latency counters. */
+class ClassifierServer::Statistics
+{
+public:
+	Statistics()
+	: _startTime(Clock::now()), _requests(0), _batches(0)
+	{
+	
+	}
+
+public:
+	void recordBatch(const std::vector<double>& latencies)
+	{
+		size_t window = latencyWindowKnob;
+		
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		_requests += latencies.size();
+		_batches  += 1;
+		
+		_latencies.insert(_latencies.end(), latencies.begin(), latencies.end());
+		
+		while(_latencies.size() > window)
+		{
+			_latencies.pop_front();
+		}
+	}
+
+	std::string toString(size_t queueDepth) const
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		std::vector<double> latencies(_latencies.begin(), _latencies.end());
+		
+		double seconds = getSecondsSince(_startTime);
+		
+		std::stringstream stream;
+		
+		stream << "requests " << _requests
+			<< " batches " << _batches
+			<< " average-batch-size " << (_requests + 0.0) / std::max(_batches, (size_t)1)
+			<< " throughput " << (seconds > 0.0 ? _requests / seconds : 0.0)
+			<< " queue-depth " << queueDepth
+			<< " p50 " << util::getPercentile(latencies, 50.0)
+			<< " p99 " << util::getPercentile(latencies, 99.0);
+		
+		return stream.str();
+	}
+
+private:
+	Clock::time_point  _startTime;
+	size_t             _requests;
+	size_t             _batches;
+	std::deque<double> _latencies;
+
+private:
+	mutable std::mutex _mutex;
+
+};
+
+/*! \brief The open client connections, each served by a detached thread. */
+class ClassifierServer::ConnectionList
+{
+public:
+	void add(int socket)
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		_sockets.insert(socket);
+	}
+	
+	/*! \brief Called by a connection thread before it closes its socket. */
+	void remove(int socket)
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		_sockets.erase(socket);
+		
+		// notify under the lock, closeAll() may return and the list be
+		// destroyed as soon as the lock is released
+		_condition.notify_all();
+	}
+
+	/*! \brief Unblock every connection and wait for them to finish. */
+	void closeAll()
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		for(auto socket : _sockets)
+		{
+			::shutdown(socket, SHUT_RDWR);
+		}
+		
+		_condition.wait(lock, [this]() { return _sockets.empty(); });
+	}
+
+private:
+	std::set<int> _sockets;
+
+private:
+	std::mutex              _mutex;
+	std::condition_variable _condition;
+
+};
+
+ClassifierServer::ClassifierServer()
+: _queue(new RequestQueue), _statistics(new Statistics),
+	_connections(new ConnectionList), _listenSocket(-1)
+{
+
+}
+
+ClassifierServer::~ClassifierServer()
+{
+
+}
+
+static int openListenSocket(unsigned int port)
+{
+	int listenSocket = ::socket(AF_INET, SOCK_STREAM, 0);
+	
+	if(listenSocket < 0)
+	{
+		throw std::runtime_error("Failed to create server socket.");
+	}
+	
+	int reuse = 1;
+	
+	::setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+	
+	sockaddr_in address;
+	
+	std::memset(&address, 0, sizeof(address));
+	
+	address.sin_family      = AF_INET;
+	address.sin_port        = htons(port);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	
+	if(::bind(listenSocket, (sockaddr*)&address, sizeof(address)) != 0 ||
+		::listen(listenSocket, SOMAXCONN) != 0)
+	{
+		::close(listenSocket);
+		
+		std::stringstream message;
+		
+		message << "Failed to listen on port " << port << ".";
+		
+		throw std::runtime_error(message.str());
+	}
+	
+	return listenSocket;
+}
+
+void ClassifierServer::serve(unsigned int port)
+{
+	_model->load();
+
+	registerModel();
+	
+	size_t maximumBatchSize = util::KnobDatabase::getKnobValue(
+		"ClassifierServer::MaximumBatchSize", 32);
+	size_t maximumWaitMicroseconds = util::KnobDatabase::getKnobValue(
+		"ClassifierServer::MaximumWaitMicroseconds", 2000);
+	
+	_listenSocket = openListenSocket(port);
+	
+	util::Metrics::startExporting();
+	
+	util::log("ClassifierServer") << "Serving on port " << port
+		<< " (maximum batch size " << maximumBatchSize << ", maximum wait "
+		<< maximumWaitMicroseconds << " us)\n";
+	
+	std::thread acceptor(&ClassifierServer::_acceptConnections, this);
+	
+	RequestVector batch;
+	
+	while(_queue->pop(batch, std::max(maximumBatchSize, (size_t)1),
+		std::chrono::microseconds(maximumWaitMicroseconds)))
+	{
+		_runBatch(batch);
+		
+		batch.clear();
+	}
+	
+	acceptor.join();
+	
+	::close(_listenSocket.exchange(-1));
+	
+	_connections->closeAll();
+	
+	util::log("ClassifierServer") << "Server stopped: " << getStatistics() << "\n";
+	
+	closeModel();
+}
+
+void ClassifierServer::stop()
+{
+	// shut the socket down before stopping the queue, serve() only closes
+	// it once the queue has stopped
+	int listenSocket = _listenSocket;
+	
+	if(listenSocket >= 0)
+	{
+		::shutdown(listenSocket, SHUT_RDWR);
+	}
+	
+	_queue->stop();
+}
+
+std::string ClassifierServer::getStatistics() const
+{
+	return _statistics->toString(_queue->size());
+}
+
+void ClassifierServer::_acceptConnections()
+{
+	while(true)
+	{
+		int connection = ::accept(_listenSocket, nullptr, nullptr);
+		
+		if(connection < 0)
+		{
+			break;
+		}
+		
+		util::log("ClassifierServer") << "Accepted connection " << connection << "\n";
+		
+		_connections->add(connection);
+		
+		std::thread(&ClassifierServer::_serveConnection, this, connection).detach();
+	}
+}
+
+static bool sendLine(int socket, const std::string& line)
+{
+	std::string message = line + "\n";
+	
+	#ifdef MSG_NOSIGNAL
+	int flags = MSG_NOSIGNAL;
+	#else
+	int flags = 0;
+	#endif
+	
+	size_t sent = 0;
+	
+	while(sent < message.size())
+	{
+		auto bytes = ::send(socket, message.data() + sent,
+			message.size() - sent, flags);
+		
+		if(bytes <= 0)
+		{
+			return false;
+		}
+		
+		sent += bytes;
+	}
+	
+	return true;
+}
+
+static bool receiveLine(int socket, std::string& buffer, std::string& line)
+{
+	while(true)
+	{
+		auto newline = buffer.find('\n');
+		
+		if(newline != std::string::npos)
+		{
+			line = buffer.substr(0, newline);
+			buffer.erase(0, newline + 1);
+			
+			if(!line.empty() && line.back() == '\r')
+			{
+				line.pop_back();
+			}
+			
+			return true;
+		}
+		
+		char data[4096];
+		
+		auto bytes = ::recv(socket, data, sizeof(data), 0);
+		
+		if(bytes <= 0)
+		{
+			return false;
+		}
+		
+		buffer.append(data, bytes);
+	}
+}
+
+void ClassifierServer::_serveConnection(int socket)
+{
+	std::string buffer;
+	std::string line;
+	
+	while(receiveLine(socket, buffer, line))
+	{
+		if(line.empty())
+		{
+			continue;
+		}
+		
+		if(line == "QUIT")
+		{
+			break;
+		}
+		
+		if(line == "SHUTDOWN")
+		{
+			stop();
+			break;
+		}
+		
+		if(line == "STATS")
+		{
+			if(!sendLine(socket, getStatistics())) break;
+			
+			continue;
+		}
+		
+		std::string response;
+		
+		try
+		{
+			// decode on the connection thread so that the batcher only runs
+			//  the network
+			video::Image image(line);
+			
+			image.load();
+			
+			auto request = std::make_shared<Request>(image);
+			
+			auto label = request->label.get_future();
+			
+			_queue->push(request);
+			
+			response = label.get();
+		}
+		catch(const std::exception& e)
+		{
+			response = std::string("ERROR ") + e.what();
+		}
+		
+		if(!sendLine(socket, response)) break;
+	}
+	
+	_connections->remove(socket);
+	
+	::close(socket);
+}
+
+util::StringVector convertActivationsToLabels(const matrix::Matrix& activations,
+	const neuralnetwork::NeuralNetwork& network);
+
+void ClassifierServer::_runBatch(RequestVector& batch)
+{
+	const size_t colorComponents = 3;
+	
+	util::log("ClassifierServer") << "Running batch of " << batch.size()
+		<< " requests\n";
+	
+	serverQueueDepth.set(_queue->size());
+	
+	util::StringVector labels;
+	
+	try
+	{
+		video::ImageVector images;
+		
+		for(auto& request : batch)
+		{
+			images.push_back(request->image);
+		}
+		
+		auto input = images.convertToStandardizedMatrix(_plan.getInputCount(),
+			_plan.getInputBlockingFactor(), colorComponents);
+		
+		labels = convertActivationsToLabels(_plan.runInputs(input),
+			getLabeledNetwork());
+	}
+	catch(...)
+	{
+		auto exception = std::current_exception();
+		
+		for(auto& request : batch)
+		{
+			request->label.set_exception(exception);
+		}
+		
+		return;
+	}
+	
+	std::vector<double> latencies;
+	
+	for(size_t i = 0; i < batch.size(); ++i)
+	{
+		latencies.push_back(getSecondsSince(batch[i]->arrivalTime));
+		
+		batch[i]->label.set_value(labels[i]);
+		
+		serverLatency.observe(latencies.back());
+	}
+	
+	serverRequests.increment(batch.size());
+	
+	_statistics->recordBatch(latencies);
+}
+
+}
+
+}
+
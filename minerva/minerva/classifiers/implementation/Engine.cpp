@@ -6,6 +6,7 @@
 
 // Minerva Includes
 #include <minerva/classifiers/interface/Engine.h>
+#include <minerva/classifiers/interface/TrainingCheckpointer.h>
 
 #include <minerva/results/interface/NullResultProcessor.h>
 #include <minerva/results/interface/ResultVector.h>
@@ -21,6 +22,7 @@
 #include <minerva/util/interface/paths.h>
 #include <minerva/util/interface/math.h>
 #include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/Metrics.h>
 
 // Standard Library Includes
 #include <stdexcept>
@@ -28,6 +30,7 @@
 #include <random>
 #include <cstdlib>
 #include <algorithm>
+#include <chrono>
 
 namespace minerva
 {
@@ -35,6 +38,17 @@ namespace minerva
 namespace classifiers
 {
 
+static util::Counter& engineSamples = util::Metrics::getCounter(
+	"minerva_engine_samples_total", "Samples run by all engines.");
+static util::Counter& engineBatches = util::Metrics::getCounter(
+	"minerva_engine_batches_total", "Batches run by all engines.");
+static util::Gauge& engineThroughput = util::Metrics::getGauge(
+	"minerva_engine_samples_per_second", "Throughput of the latest batch.");
+static util::Histogram& engineBatchLatency = util::Metrics::getHistogram(
+	"minerva_engine_batch_seconds", "Time to run a batch through the model.");
+static util::Histogram& producerLatency = util::Metrics::getHistogram(
+	"minerva_producer_pop_seconds", "Time to load and decode a batch.");
+
 Engine::Engine()
 {
 	setResultProcessor(new results::NullResultProcessor);
@@ -68,6 +82,22 @@ void Engine::setResultProcessor(ResultProcessor* processor)
 void Engine::runOnDatabaseFile(const std::string& path)
 {
 	_model->load();
+	
+	std::unique_ptr<TrainingCheckpointer> checkpointer;
+	
+	std::string producerState;
+	size_t      batches = 0;
+	
+	if(modifiesModel())
+	{
+		checkpointer.reset(new TrainingCheckpointer(_model->path()));
+		
+		if(util::KnobDatabase::getKnobValue("Engine::ResumeFromCheckpoint",
+			false))
+		{
+			checkpointer->restore(*_model, producerState, batches);
+		}
+	}
 
 	registerModel();
 		
@@ -78,18 +108,56 @@ void Engine::runOnDatabaseFile(const std::string& path)
 	
 	_setupProducer(path);
 	
+	_dataProducer->setState(producerState);
+	
+	util::Metrics::startExporting();
+	
+	typedef std::chrono::steady_clock Clock;
+	
 	while(!_dataProducer->empty())
 	{
+		auto popStart = Clock::now();
+		
 		auto dataAndReference = std::move(_dataProducer->pop());
 		
+		auto batchStart = Clock::now();
+		
+		size_t samples = dataAndReference.first.rows();
+		
 		auto results = runOnBatch(std::move(dataAndReference.first),
 			std::move(dataAndReference.second));
 		
 		_resultProcessor->process(std::move(results));
+		
+		double popSeconds = std::chrono::duration<double>(
+			batchStart - popStart).count();
+		double batchSeconds = std::chrono::duration<double>(
+			Clock::now() - batchStart).count();
+		
+		producerLatency.observe(popSeconds);
+		engineBatchLatency.observe(batchSeconds);
+		engineSamples.increment(samples);
+		engineBatches.increment();
+		engineThroughput.set(samples / std::max(popSeconds + batchSeconds, 1.0e-9));
+		
+		++batches;
+		
+		if(checkpointer && checkpointer->isDue(batches))
+		{
+			checkpointer->checkpoint(*_model, _dataProducer->getState(),
+				batches);
+		}
+	}
+	
+	if(checkpointer)
+	{
+		checkpointer->wait();
 	}
 
 	// close
 	closeModel();
+	
+	_reportLoadedModel();
 }
 
 void Engine::setOutputFilename(const std::string& filename)
@@ -147,6 +215,11 @@ bool Engine::requiresLabeledData() const
 	return false;
 }
 
+bool Engine::modifiesModel() const
+{
+	return false;
+}
+
 void Engine::saveModel()
 {
 	if(_model) _model->save();
@@ -198,8 +271,21 @@ void Engine::_setupProducer(const std::string& path)
 		input::InputDataProducerFactory::createForDatabase(path));
 	
 	_dataProducer->setRequiresLabeledData(requiresLabeledData());
+	_dataProducer->setModel(_model.get());
 }
 
+void Engine::_reportLoadedModel() const
+{
+	util::log("Engine") << "Loaded " << _model->getLoadedBytes()
+		<< " bytes of weights from networks:";
+	
+	for(auto& name : _model->getLoadedNeuralNetworkNames())
+	{
+		util::log("Engine") << " '" << name << "'";
+	}
+	
+	util::log("Engine") << "\n";
+}
 
 }
 
@@ -8,9 +8,13 @@
 #include <minerva/classifiers/interface/EngineFactory.h>
 
 #include <minerva/classifiers/interface/ClassifierEngine.h>
+#include <minerva/classifiers/interface/ClassifierServer.h>
+#include <minerva/classifiers/interface/StreamingClassifierEngine.h>
 #include <minerva/classifiers/interface/FeatureExtractorEngine.h>
 #include <minerva/classifiers/interface/LearnerEngine.h>
 #include <minerva/classifiers/interface/UnsupervisedLearnerEngine.h>
+#include <minerva/classifiers/interface/PrunerEngine.h>
+#include <minerva/classifiers/interface/QuantizerEngine.h>
 
 namespace minerva
 {
@@ -25,6 +29,16 @@ Engine* EngineFactory::create(const std::string& classifierName)
 		return new ClassifierEngine;
 	}
 	
+	if(classifierName == "StreamingClassifierEngine")
+	{
+		return new StreamingClassifierEngine;
+	}
+	
+	if(classifierName == "ClassifierServer")
+	{
+		return new ClassifierServer;
+	}
+	
 	if(classifierName == "LearnerEngine")
 	{
 		return new LearnerEngine;
@@ -39,6 +53,16 @@ Engine* EngineFactory::create(const std::string& classifierName)
 	{
 		return new FeatureExtractorEngine;
 	}
+	
+	if(classifierName == "PrunerEngine")
+	{
+		return new PrunerEngine;
+	}
+	
+	if(classifierName == "QuantizerEngine")
+	{
+		return new QuantizerEngine;
+	}
 
 	return nullptr;
 }
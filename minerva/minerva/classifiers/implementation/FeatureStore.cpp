@@ -0,0 +1,269 @@
+/*	\file   FeatureStore.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The source file for the FeatureStore class.
+*/
+
+// Minerva Includes
+#include <minerva/classifiers/interface/FeatureStore.h>
+
+#include <minerva/matrix/interface/Matrix.h>
+
+#include <minerva/util/interface/MemoryMappedFile.h>
+#include <minerva/util/interface/debug.h>
+
+// Standard Library Includes
+#include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+static uint16_t floatToHalf(float value)
+{
+	uint32_t bits = 0;
+
+	std::memcpy(&bits, &value, sizeof(float));
+
+	uint16_t sign     = (bits >> 16) & 0x8000;
+	int      exponent = ((bits >> 23) & 0xff) - 127 + 15;
+	uint32_t mantissa = bits & 0x7fffff;
+
+	// infinity or nan
+	if(((bits >> 23) & 0xff) == 0xff)
+	{
+		return sign | 0x7c00 | (mantissa != 0 ? 0x200 : 0);
+	}
+
+	// overflow
+	if(exponent >= 31)
+	{
+		return sign | 0x7c00;
+	}
+
+	// denormal or zero
+	if(exponent <= 0)
+	{
+		if(exponent < -10)
+		{
+			return sign;
+		}
+
+		mantissa |= 0x800000;
+
+		uint32_t shift     = 14 - exponent;
+		uint32_t half      = mantissa >> shift;
+		uint32_t remainder = mantissa & ((1 << shift) - 1);
+		uint32_t halfway   = 1 << (shift - 1);
+
+		if(remainder > halfway || (remainder == halfway && (half & 1)))
+		{
+			++half;
+		}
+
+		return sign | half;
+	}
+
+	uint32_t half      = (exponent << 10) | (mantissa >> 13);
+	uint32_t remainder = mantissa & 0x1fff;
+
+	// round to nearest even, a carry correctly bumps the exponent
+	if(remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+	{
+		++half;
+	}
+
+	return sign | half;
+}
+
+static float halfToFloat(uint16_t half)
+{
+	uint32_t sign     = (half & 0x8000) << 16;
+	uint32_t exponent = (half >> 10) & 0x1f;
+	uint32_t mantissa = half & 0x3ff;
+
+	if(exponent == 0)
+	{
+		float value = std::ldexp((float)mantissa, -24);
+
+		return sign != 0 ? -value : value;
+	}
+
+	uint32_t bits = 0;
+
+	if(exponent == 31)
+	{
+		bits = sign | 0x7f800000 | (mantissa << 13);
+	}
+	else
+	{
+		bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+	}
+
+	float value = 0.0f;
+
+	std::memcpy(&value, &bits, sizeof(float));
+
+	return value;
+}
+
+FeatureStore::FeatureStore(const std::string& path, bool halfPrecision)
+: _path(path), _halfPrecision(halfPrecision), _rows(0), _columns(0),
+  _stream(path, std::ios::binary | std::ios::trunc)
+{
+	if(!_stream.is_open())
+	{
+		throw std::runtime_error("Failed to open feature store '" +
+			path + "' for writing.");
+	}
+}
+
+FeatureStore::~FeatureStore()
+{
+	_mappedFile.reset();
+
+	if(_stream.is_open())
+	{
+		_stream.close();
+	}
+
+	std::remove(_path.c_str());
+}
+
+void FeatureStore::append(const Matrix& features)
+{
+	if(!_stream.is_open())
+	{
+		throw std::runtime_error("Feature store '" + _path +
+			"' is already finished.");
+	}
+
+	if(_rows == 0)
+	{
+		_columns = features.columns();
+	}
+
+	if(features.columns() != _columns)
+	{
+		throw std::runtime_error("Features appended to '" + _path +
+			"' do not match the number of columns in the store.");
+	}
+
+	auto& data = features.data();
+
+	if(_halfPrecision)
+	{
+		std::vector<uint16_t> halves(data.size());
+
+		for(size_t i = 0; i < data.size(); ++i)
+		{
+			halves[i] = floatToHalf(data[i]);
+		}
+
+		_stream.write(reinterpret_cast<const char*>(halves.data()),
+			halves.size() * sizeof(uint16_t));
+	}
+	else
+	{
+		_stream.write(reinterpret_cast<const char*>(data.data()),
+			data.size() * sizeof(float));
+	}
+
+	if(!_stream.good())
+	{
+		throw std::runtime_error("Failed to write features to '" +
+			_path + "'.");
+	}
+
+	_rows += features.rows();
+}
+
+void FeatureStore::finish()
+{
+	if(_mappedFile)
+	{
+		return;
+	}
+
+	_stream.close();
+
+	_mappedFile.reset(new util::MemoryMappedFile(_path));
+
+	util::log("FeatureStore") << "Stored " << _rows << " rows of " << _columns
+		<< " features in '" << _path << "' (" << _mappedFile->size()
+		<< " bytes)\n";
+}
+
+FeatureStore::Matrix FeatureStore::getRows(size_t begin, size_t count) const
+{
+	if(!_mappedFile)
+	{
+		throw std::runtime_error("Feature store '" + _path +
+			"' must be finished before it is read.");
+	}
+
+	if(begin + count > _rows)
+	{
+		throw std::runtime_error("Read past the end of feature store '" +
+			_path + "'.");
+	}
+
+	Matrix result(count, _columns);
+
+	auto& data = result.data();
+
+	size_t offset = begin * _columns;
+
+	if(_halfPrecision)
+	{
+		auto halves = reinterpret_cast<const uint16_t*>(_mappedFile->data()) +
+			offset;
+
+		for(size_t i = 0; i < data.size(); ++i)
+		{
+			data[i] = halfToFloat(halves[i]);
+		}
+	}
+	else
+	{
+		auto floats = reinterpret_cast<const float*>(_mappedFile->data()) +
+			offset;
+
+		std::copy(floats, floats + data.size(), data.begin());
+	}
+
+	return result;
+}
+
+size_t FeatureStore::rows() const
+{
+	return _rows;
+}
+
+size_t FeatureStore::columns() const
+{
+	return _columns;
+}
+
+bool FeatureStore::empty() const
+{
+	return _rows == 0;
+}
+
+const std::string& FeatureStore::path() const
+{
+	return _path;
+}
+
+}
+
+}
+
@@ -57,6 +57,11 @@ bool LearnerEngine::requiresLabeledData() const
 	return true;
 }
 
+bool LearnerEngine::modifiesModel() const
+{
+	return true;
+}
+
 }
 
 }
@@ -0,0 +1,102 @@
+/*	\file   PrunerEngine.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The source file for the PrunerEngine class.
+*/
+
+// Minerva Includes
+#include <minerva/classifiers/interface/PrunerEngine.h>
+
+#include <minerva/neuralnetwork/interface/NeuralNetwork.h>
+#include <minerva/neuralnetwork/interface/NeuralNetworkPruner.h>
+
+#include <minerva/results/interface/ResultVector.h>
+#include <minerva/matrix/interface/Matrix.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+static util::Knob<float> thresholdKnob("PrunerEngine::Threshold", 0.01f,
+	"Prune weights, neurons, and blocks below this magnitude");
+
+PrunerEngine::PrunerEngine()
+: _threshold(thresholdKnob), _pruner(new neuralnetwork::NeuralNetworkPruner)
+{
+
+}
+
+PrunerEngine::~PrunerEngine()
+{
+
+}
+
+void PrunerEngine::setThreshold(float threshold)
+{
+	_threshold = threshold;
+}
+
+void PrunerEngine::registerModel()
+{
+	auto network = getAggregateNetwork();
+	
+	_pruner->prune(network, _threshold);
+	
+	util::log("PrunerEngine") << "Pruned " << (_pruner->getSparsity() * 100.0f)
+		<< "% of " << network.totalWeights() << " weights below "
+		<< _threshold << ".\n";
+	
+	restoreAggregateNetwork(network);
+}
+
+void PrunerEngine::closeModel()
+{
+	auto network = getAggregateNetwork();
+	
+	size_t weights = network.totalWeights();
+	
+	_pruner->compact(network);
+	
+	util::log("PrunerEngine") << "Compacted model from " << weights
+		<< " to " << network.totalWeights() << " weights.\n";
+	
+	restoreAggregateNetwork(network);
+	
+	saveModel();
+}
+
+PrunerEngine::ResultVector PrunerEngine::runOnBatch(Matrix&& input, Matrix&& reference)
+{
+	util::log("PrunerEngine") << "Fine-tuning pruned model "
+		"on batch of " << input.rows() <<  " images...\n";
+	
+	auto network = getAggregateNetwork();
+	
+	network.train(std::move(input), std::move(reference));
+	
+	_pruner->applyMask(network);
+	
+	restoreAggregateNetwork(network);
+	
+	return ResultVector();
+}
+
+bool PrunerEngine::requiresLabeledData() const
+{
+	return true;
+}
+
+bool PrunerEngine::modifiesModel() const
+{
+	return true;
+}
+
+}
+
+}
+
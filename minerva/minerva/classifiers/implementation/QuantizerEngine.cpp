@@ -0,0 +1,186 @@
+/*	\file   QuantizerEngine.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The source file for the QuantizerEngine class.
+*/
+
+// Minerva Includes
+#include <minerva/classifiers/interface/QuantizerEngine.h>
+
+#include <minerva/results/interface/ResultVector.h>
+
+#include <minerva/model/interface/Model.h>
+
+#include <minerva/matrix/interface/Matrix.h>
+#include <minerva/matrix/interface/Int8Matrix.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/Timer.h>
+
+// Standard Library Includes
+#include <stdexcept>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+static util::Knob<size_t> calibrationSamplesKnob(
+	"QuantizerEngine::CalibrationSamples", 256,
+	"The number of samples used to calibrate the int8 activation ranges");
+
+QuantizerEngine::QuantizerEngine()
+: _calibrationSamples(calibrationSamplesKnob), _calibratedSamples(0),
+  _evaluatedSamples(0), _fp32Matches(0), _int8Matches(0), _agreements(0),
+  _fp32Seconds(0.0), _int8Seconds(0.0)
+{
+
+}
+
+QuantizerEngine::~QuantizerEngine()
+{
+
+}
+
+void QuantizerEngine::setCalibrationSamples(size_t samples)
+{
+	_calibrationSamples = samples;
+}
+
+void QuantizerEngine::registerModel()
+{
+	buildPlan(_plan);
+	buildPlan(_quantizedPlan);
+}
+
+void QuantizerEngine::closeModel()
+{
+	if(_calibratedSamples == 0)
+	{
+		throw std::runtime_error("No samples were available to calibrate "
+			"the int8 model.");
+	}
+	
+	if(!_quantizedPlan.isQuantized())
+	{
+		_quantizedPlan.quantize();
+	}
+	
+	_model->setAttribute("int8-calibration", _quantizedPlan.getCalibration());
+	
+	saveModel();
+	
+	std::cout << _getReport();
+	
+	_quantizedPlan.clear();
+	
+	ClassifierEngine::closeModel();
+}
+
+QuantizerEngine::ResultVector QuantizerEngine::runOnBatch(Matrix&& input,
+	Matrix&& reference)
+{
+	if(_calibratedSamples < _calibrationSamples)
+	{
+		util::log("QuantizerEngine") << "Calibrating int8 activation ranges "
+			"on batch of " << input.rows() << " images...\n";
+		
+		_quantizedPlan.calibrate(input);
+		
+		_calibratedSamples += input.rows();
+		
+		return ResultVector();
+	}
+	
+	if(!_quantizedPlan.isQuantized())
+	{
+		_quantizedPlan.quantize();
+	}
+	
+	util::Timer timer;
+	
+	timer.start();
+	
+	auto fp32Labels = getLabels(_plan.runInputs(input));
+	
+	timer.stop();
+	
+	_fp32Seconds += timer.seconds();
+	
+	timer.start();
+	
+	auto int8Labels = getLabels(_quantizedPlan.runInputs(input));
+	
+	timer.stop();
+	
+	_int8Seconds += timer.seconds();
+	
+	auto referenceLabels = getLabels(reference);
+	
+	for(size_t sample = 0; sample < referenceLabels.size(); ++sample)
+	{
+		if(fp32Labels[sample] == referenceLabels[sample]) ++_fp32Matches;
+		if(int8Labels[sample] == referenceLabels[sample]) ++_int8Matches;
+		if(fp32Labels[sample] == int8Labels[sample])      ++_agreements;
+	}
+	
+	_evaluatedSamples += referenceLabels.size();
+	
+	return ResultVector();
+}
+
+bool QuantizerEngine::requiresLabeledData() const
+{
+	return true;
+}
+
+bool QuantizerEngine::modifiesModel() const
+{
+	return false;
+}
+
+static double percent(size_t count, size_t total)
+{
+	return total == 0 ? 0.0 : (100.0 * count) / total;
+}
+
+std::string QuantizerEngine::_getReport() const
+{
+	std::stringstream stream;
+	
+	stream << std::fixed << std::setprecision(2);
+	
+	stream << "Int8 quantization report (" << matrix::getInt8KernelName()
+		<< " kernel)\n";
+	stream << " calibrated on " << _calibratedSamples << " samples\n";
+	
+	if(_evaluatedSamples == 0)
+	{
+		stream << " no samples remained for evaluation, increase the maximum "
+			"samples to run beyond QuantizerEngine::CalibrationSamples\n";
+		
+		return stream.str();
+	}
+	
+	stream << " evaluated on " << _evaluatedSamples << " samples\n";
+	stream << "  fp32 accuracy:  " << percent(_fp32Matches, _evaluatedSamples)
+		<< "%\n";
+	stream << "  int8 accuracy:  " << percent(_int8Matches, _evaluatedSamples)
+		<< "%\n";
+	stream << "  agreement:      " << percent(_agreements, _evaluatedSamples)
+		<< "%\n";
+	stream << "  fp32 time:      " << _fp32Seconds << " s\n";
+	stream << "  int8 time:      " << _int8Seconds << " s\n";
+	
+	return stream.str();
+}
+
+}
+
+}
+
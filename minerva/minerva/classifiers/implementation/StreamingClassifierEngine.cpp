@@ -0,0 +1,413 @@
+/*	\file   StreamingClassifierEngine.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The source file for the StreamingClassifierEngine class.
+*/
+
+// Minerva Includes
+#include <minerva/classifiers/interface/StreamingClassifierEngine.h>
+
+#include <minerva/neuralnetwork/interface/NeuralNetwork.h>
+#include <minerva/neuralnetwork/interface/InferencePlan.h>
+
+#include <minerva/results/interface/TimestampedLabelResultProcessor.h>
+#include <minerva/results/interface/TimestampedLabelResult.h>
+#include <minerva/results/interface/ResultProcessor.h>
+#include <minerva/results/interface/ResultVector.h>
+
+#include <minerva/model/interface/Model.h>
+
+#include <minerva/video/interface/VideoLibraryInterface.h>
+#include <minerva/video/interface/VideoLibrary.h>
+#include <minerva/video/interface/VideoStream.h>
+#include <minerva/video/interface/ImageVector.h>
+
+#include <minerva/matrix/interface/Matrix.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/math.h>
+
+// Standard Library Includes
+#include <thread>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <deque>
+#include <algorithm>
+#include <stdexcept>
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+typedef std::chrono::steady_clock Clock;
+
+class StreamingClassifierEngine::QueuedFrame
+{
+public:
+	QueuedFrame(const video::Image& image, size_t index, double timestamp,
+		const Clock::time_point& captureTime)
+	: image(image), index(index), timestamp(timestamp), captureTime(captureTime)
+	{
+	
+	}
+
+public:
+	video::Image      image;
+	size_t            index;
+	double            timestamp;
+	Clock::time_point captureTime;
+
+};
+
+/*! \brief A bounded, thread-safe queue of frames waiting to be classified. */
+class StreamingClassifierEngine::FrameQueue
+{
+public:
+	FrameQueue(size_t capacity, bool dropOldest)
+	: _capacity(std::max(capacity, (size_t)1)), _dropOldest(dropOldest),
+		_dropped(0), _peak(0), _closed(false)
+	{
+	
+	}
+
+public:
+	/*! \brief Add a frame, dropping one if the queue is full. */
+	void push(QueuedFrame&& frame)
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			
+			if(_frames.size() >= _capacity)
+			{
+				++_dropped;
+				
+				if(!_dropOldest)
+				{
+					return;
+				}
+				
+				_frames.pop_front();
+			}
+			
+			_frames.push_back(std::move(frame));
+			
+			_peak = std::max(_peak, _frames.size());
+		}
+		
+		_condition.notify_one();
+	}
+
+	/*! \brief Wait for frames and remove up to 'maximum' of them.
+	
+		Returns false once the queue is closed and empty.
+	*/
+	bool pop(QueuedFrameVector& frames, size_t maximum)
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		_condition.wait(lock, [this]() { return !_frames.empty() || _closed; });
+		
+		while(!_frames.empty() && frames.size() < maximum)
+		{
+			frames.push_back(std::move(_frames.front()));
+			_frames.pop_front();
+		}
+		
+		return !frames.empty();
+	}
+
+	/*! \brief Signal that no more frames will be added. */
+	void close()
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			
+			_closed = true;
+		}
+		
+		_condition.notify_all();
+	}
+
+	bool isClosed() const
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		return _closed;
+	}
+
+	size_t dropped() const
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		return _dropped;
+	}
+
+	size_t peak() const
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		return _peak;
+	}
+
+private:
+	std::deque<QueuedFrame> _frames;
+
+private:
+	size_t _capacity;
+	bool   _dropOldest;
+	size_t _dropped;
+	size_t _peak;
+	bool   _closed;
+
+private:
+	mutable std::mutex      _mutex;
+	std::condition_variable _condition;
+
+};
+
+StreamingClassifierEngine::StreamingClassifierEngine()
+: _droppedFrames(0), _maximumQueuedFrames(0)
+{
+	setResultProcessor(new results::TimestampedLabelResultProcessor);
+}
+
+StreamingClassifierEngine::~StreamingClassifierEngine()
+{
+
+}
+
+static bool shouldDropOldestFrames()
+{
+	std::string policy = util::KnobDatabase::getKnobValue(
+		"StreamingClassifierEngine::DropPolicy", "DropOldest");
+	
+	if(policy == "DropOldest")
+	{
+		return true;
+	}
+	
+	if(policy == "DropNewest")
+	{
+		return false;
+	}
+	
+	throw std::runtime_error("Invalid frame drop policy '" + policy +
+		"', expecting 'DropOldest' or 'DropNewest'.");
+}
+
+void StreamingClassifierEngine::runOnVideoStream(const std::string& path)
+{
+	if(path.empty())
+	{
+		throw std::runtime_error("No input stream provided.");
+	}
+	
+	auto library = video::VideoLibraryInterface::getLibraryThatSupports(path);
+	
+	if(library == nullptr)
+	{
+		throw std::runtime_error("No video library can support '" +
+			path + "'");
+	}
+	
+	auto stream = library->newStream(path);
+	
+	try
+	{
+		runOnVideoStream(*stream);
+	}
+	catch(...)
+	{
+		library->freeStream(stream);
+		
+		throw;
+	}
+	
+	library->freeStream(stream);
+}
+
+void StreamingClassifierEngine::runOnVideoStream(video::VideoStream& stream)
+{
+	_model->load();
+
+	registerModel();
+	
+	size_t queueCapacity = util::KnobDatabase::getKnobValue(
+		"StreamingClassifierEngine::QueueCapacity", 32);
+	size_t microBatchSize = util::KnobDatabase::getKnobValue(
+		"StreamingClassifierEngine::MicroBatchSize", 4);
+	
+	_queue.reset(new FrameQueue(queueCapacity, shouldDropOldestFrames()));
+	_latencies.clear();
+	_readerException = nullptr;
+	
+	std::thread reader(&StreamingClassifierEngine::_readFrames, this,
+		std::ref(stream));
+	
+	try
+	{
+		QueuedFrameVector frames;
+		
+		while(_queue->pop(frames, std::max(microBatchSize, (size_t)1)))
+		{
+			_classifyFrames(frames);
+			
+			frames.clear();
+		}
+	}
+	catch(...)
+	{
+		_queue->close();
+		reader.join();
+		
+		closeModel();
+		
+		throw;
+	}
+	
+	reader.join();
+	
+	_droppedFrames       = _queue->dropped();
+	_maximumQueuedFrames = _queue->peak();
+	
+	_reportLatency();
+	
+	closeModel();
+	
+	if(_readerException)
+	{
+		std::rethrow_exception(_readerException);
+	}
+}
+
+double StreamingClassifierEngine::getLatencyPercentile(double percentile) const
+{
+	return util::getPercentile(_latencies, percentile);
+}
+
+size_t StreamingClassifierEngine::getClassifiedFrameCount() const
+{
+	return _latencies.size();
+}
+
+size_t StreamingClassifierEngine::getDroppedFrameCount() const
+{
+	return _droppedFrames;
+}
+
+size_t StreamingClassifierEngine::getMaximumQueuedFrameCount() const
+{
+	return _maximumQueuedFrames;
+}
+
+static double getSecondsSince(const Clock::time_point& start)
+{
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void StreamingClassifierEngine::_readFrames(video::VideoStream& stream)
+{
+	// a positive frame rate replays a file in real time, zero reads as fast
+	//  as possible (e.g. for a live device that already paces itself)
+	double framesPerSecond = util::KnobDatabase::getKnobValue(
+		"StreamingClassifierEngine::FramesPerSecond", 0.0);
+	
+	try
+	{
+		auto start = Clock::now();
+		
+		for(size_t index = 0; !_queue->isClosed(); ++index)
+		{
+			if(framesPerSecond > 0.0)
+			{
+				std::this_thread::sleep_until(start +
+					std::chrono::duration_cast<Clock::duration>(
+					std::chrono::duration<double>(index / framesPerSecond)));
+			}
+			
+			if(stream.finished()) break;
+			
+			video::Image image;
+			
+			if(!stream.getNextFrame(image)) break;
+			
+			double timestamp = framesPerSecond > 0.0 ?
+				index / framesPerSecond : getSecondsSince(start);
+			
+			_queue->push(QueuedFrame(image, index, timestamp, Clock::now()));
+		}
+	}
+	catch(...)
+	{
+		_readerException = std::current_exception();
+	}
+	
+	_queue->close();
+}
+
+util::StringVector convertActivationsToLabels(const matrix::Matrix& activations,
+	const neuralnetwork::NeuralNetwork& network);
+
+util::StringVector StreamingClassifierEngine::classifyImages(
+	const video::ImageVector& images)
+{
+	const size_t colorComponents = 3;
+	
+	auto input = images.convertToStandardizedMatrix(_plan.getInputCount(),
+		_plan.getInputBlockingFactor(), colorComponents);
+	
+	return convertActivationsToLabels(_plan.runInputs(input),
+		getLabeledNetwork());
+}
+
+void StreamingClassifierEngine::_classifyFrames(QueuedFrameVector& frames)
+{
+	video::ImageVector images;
+	
+	for(auto& frame : frames)
+	{
+		images.push_back(frame.image);
+	}
+	
+	auto labels = classifyImages(images);
+	
+	ResultVector labelResults;
+	
+	for(size_t i = 0; i < frames.size(); ++i)
+	{
+		double latency = getSecondsSince(frames[i].captureTime);
+		
+		_latencies.push_back(latency);
+		
+		labelResults.push_back(new results::TimestampedLabelResult(labels[i],
+			frames[i].index, frames[i].timestamp, latency));
+	}
+	
+	util::log("StreamingClassifierEngine") << "Classified " << frames.size()
+		<< " frames, " << _queue->dropped() << " dropped so far.\n";
+	
+	_resultProcessor->process(labelResults);
+}
+
+void StreamingClassifierEngine::_reportLatency() const
+{
+	util::log("StreamingClassifierEngine") << "Stream finished: "
+		<< getClassifiedFrameCount() << " frames classified, "
+		<< getDroppedFrameCount() << " dropped, at most "
+		<< getMaximumQueuedFrameCount() << " queued\n";
+	util::log("StreamingClassifierEngine") << " end-to-end latency p50 "
+		<< getLatencyPercentile(50.0) << "s, p90 "
+		<< getLatencyPercentile(90.0) << "s, p99 "
+		<< getLatencyPercentile(99.0) << "s, max "
+		<< getLatencyPercentile(100.0) << "s\n";
+}
+
+}
+
+}
+
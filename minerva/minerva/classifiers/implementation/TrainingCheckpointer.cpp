@@ -0,0 +1,208 @@
+/*	\file   TrainingCheckpointer.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The source file for the TrainingCheckpointer class.
+*/
+
+// Minerva Includes
+#include <minerva/classifiers/interface/TrainingCheckpointer.h>
+
+#include <minerva/model/interface/Model.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+
+// Standard Library Includes
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <list>
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+static std::string getCheckpointPath(const std::string& modelPath)
+{
+	return modelPath + ".checkpoint";
+}
+
+static std::string getPreviousCheckpointPath(const std::string& modelPath)
+{
+	return modelPath + ".checkpoint.previous";
+}
+
+static std::string getPartialCheckpointPath(const std::string& modelPath)
+{
+	return modelPath + ".checkpoint.partial";
+}
+
+static bool exists(const std::string& path)
+{
+	return std::ifstream(path).good();
+}
+
+TrainingCheckpointer::TrainingCheckpointer(const std::string& modelPath)
+: _modelPath(modelPath), _lastCheckpointBatch(0),
+  _lastCheckpointTime(Clock::now())
+{
+	_batchInterval = util::KnobDatabase::getKnobValue<size_t>(
+		"TrainingCheckpointer::BatchInterval", 0);
+	_secondsInterval = util::KnobDatabase::getKnobValue(
+		"TrainingCheckpointer::SecondsInterval", 0.0);
+}
+
+TrainingCheckpointer::~TrainingCheckpointer()
+{
+	wait();
+}
+
+bool TrainingCheckpointer::isDue(size_t batches) const
+{
+	if(_batchInterval > 0 && batches >= _lastCheckpointBatch + _batchInterval)
+	{
+		return true;
+	}
+	
+	if(_secondsInterval > 0.0)
+	{
+		std::chrono::duration<double> elapsed =
+			Clock::now() - _lastCheckpointTime;
+		
+		return elapsed.count() >= _secondsInterval;
+	}
+	
+	return false;
+}
+
+void TrainingCheckpointer::checkpoint(const Model& model,
+	const std::string& producerState, size_t batches)
+{
+	// only one checkpoint is written at a time
+	wait();
+	
+	_lastCheckpointBatch = batches;
+	_lastCheckpointTime  = Clock::now();
+	
+	// the copy is the snapshot, training continues on the original
+	auto snapshot = std::make_shared<Model>(model);
+	
+	std::stringstream batchString;
+	
+	batchString << batches;
+	
+	snapshot->setAttribute("checkpoint-batches", batchString.str());
+	snapshot->setAttribute("producer-state", producerState);
+	
+	std::string modelPath = _modelPath;
+	
+	snapshot->setPath(getPartialCheckpointPath(modelPath));
+	
+	util::log("TrainingCheckpointer") << "Writing checkpoint after "
+		<< batches << " batches\n";
+	
+	_pendingCheckpoint = std::async(std::launch::async,
+		[snapshot, modelPath, batches]()
+	{
+		snapshot->save();
+		
+		// readers only ever see complete checkpoints
+		if(exists(getCheckpointPath(modelPath)))
+		{
+			std::rename(getCheckpointPath(modelPath).c_str(),
+				getPreviousCheckpointPath(modelPath).c_str());
+		}
+		
+		if(std::rename(getPartialCheckpointPath(modelPath).c_str(),
+			getCheckpointPath(modelPath).c_str()) != 0)
+		{
+			throw std::runtime_error("Failed to rename checkpoint to '" +
+				getCheckpointPath(modelPath) + "'.");
+		}
+		
+		util::log("TrainingCheckpointer") << "Finished checkpoint after "
+			<< batches << " batches\n";
+	});
+}
+
+void TrainingCheckpointer::wait()
+{
+	if(!_pendingCheckpoint.valid())
+	{
+		return;
+	}
+	
+	// a failed checkpoint leaves the last good one in place, training goes on
+	try
+	{
+		_pendingCheckpoint.get();
+	}
+	catch(const std::exception& e)
+	{
+		util::log("TrainingCheckpointer") << "Checkpoint failed: "
+			<< e.what() << "\n";
+	}
+}
+
+bool TrainingCheckpointer::restore(Model& model, std::string& producerState,
+	size_t& batches)
+{
+	for(auto& path : {getCheckpointPath(_modelPath),
+		getPreviousCheckpointPath(_modelPath)})
+	{
+		if(!exists(path))
+		{
+			continue;
+		}
+		
+		try
+		{
+			Model checkpoint(path);
+			
+			checkpoint.load();
+			
+			if(!checkpoint.hasAttribute("checkpoint-batches"))
+			{
+				throw std::runtime_error("missing the batch count");
+			}
+			
+			// read every network before changing the model
+			std::list<std::pair<std::string, Model::NeuralNetwork>> networks;
+			
+			for(auto& name : checkpoint.getNeuralNetworkNames())
+			{
+				networks.push_back(std::make_pair(name,
+					checkpoint.getNeuralNetwork(name)));
+			}
+			
+			for(auto& network : networks)
+			{
+				model.setNeuralNetwork(network.first, network.second);
+			}
+			
+			producerState = checkpoint.getAttribute("producer-state");
+			batches = std::stoull(checkpoint.getAttribute("checkpoint-batches"));
+			
+			_lastCheckpointBatch = batches;
+			
+			util::log("TrainingCheckpointer") << "Resuming from checkpoint '"
+				<< path << "' after " << batches << " batches\n";
+			
+			return true;
+		}
+		catch(const std::exception& e)
+		{
+			util::log("TrainingCheckpointer") << "Skipping invalid checkpoint '"
+				<< path << "': " << e.what() << "\n";
+		}
+	}
+	
+	return false;
+}
+
+}
+
+}
+
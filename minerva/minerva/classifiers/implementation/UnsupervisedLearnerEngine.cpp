@@ -6,6 +6,7 @@
 
 // Minerva Includes
 #include <minerva/classifiers/interface/UnsupervisedLearnerEngine.h>
+#include <minerva/classifiers/interface/FeatureStore.h>
 
 #include <minerva/model/interface/Model.h>
 
@@ -18,6 +19,11 @@
 #include <minerva/util/interface/debug.h>
 #include <minerva/util/interface/Knobs.h>
 
+// Standard Library Includes
+#include <algorithm>
+#include <stdexcept>
+#include <sstream>
+
 namespace minerva
 {
 
@@ -25,10 +31,15 @@ namespace classifiers
 {
 
 UnsupervisedLearnerEngine::UnsupervisedLearnerEngine()
-: _layersPerIteration(9)
+: _layersPerIteration(9), _pretrainGreedily(false),
+  _halfPrecisionFeatures(false), _batchSize(0)
 {
 	_layersPerIteration = util::KnobDatabase::getKnobValue<size_t>(
 		"UnsupervisedLearnerEngine::LayersPerIteration", 9);
+	_pretrainGreedily = util::KnobDatabase::getKnobValue(
+		"UnsupervisedLearnerEngine::PretrainGreedily", false);
+	_halfPrecisionFeatures = util::KnobDatabase::getKnobValue(
+		"UnsupervisedLearnerEngine::HalfPrecisionFeatures", false);
 }
 
 UnsupervisedLearnerEngine::~UnsupervisedLearnerEngine()
@@ -41,6 +52,11 @@ void UnsupervisedLearnerEngine::setLayersPerIteration(size_t l)
 	_layersPerIteration = l;
 }
 
+void UnsupervisedLearnerEngine::setPretrainGreedily(bool greedy)
+{
+	_pretrainGreedily = greedy;
+}
+
 static size_t getTotalLayers(model::Model& model)
 {
 	#if 0
@@ -63,6 +79,13 @@ UnsupervisedLearnerEngine::ResultVector UnsupervisedLearnerEngine::runOnBatch(Ma
 	util::log("UnsupervisedLearnerEngine") << "Performing unsupervised "
 		"learning on " << input.rows() <<  " samples...\n";
 	
+	if(_pretrainGreedily)
+	{
+		_trainFirstGroupAndStoreInputs(std::move(input));
+		
+		return ResultVector();
+	}
+	
 	auto totalLayers = getTotalLayers(*_model);
 	
 	auto inputReference = input.add(1.0f).multiply(0.4f).add(0.1f);
@@ -95,7 +118,111 @@ UnsupervisedLearnerEngine::ResultVector UnsupervisedLearnerEngine::runOnBatch(Ma
 	return ResultVector();
 }
 
-neuralnetwork::NeuralNetwork UnsupervisedLearnerEngine::_formAugmentedNetwork(size_t layerBegin, size_t layerEnd)
+static std::string getFeatureStorePath(const model::Model& model,
+	size_t layer)
+{
+	std::stringstream stream;
+	
+	stream << model.path() << ".features." << layer;
+	
+	return stream.str();
+}
+
+void UnsupervisedLearnerEngine::_trainFirstGroupAndStoreInputs(Matrix&& input)
+{
+	auto totalLayers = getTotalLayers(*_model);
+	auto layerEnd    = std::min(_layersPerIteration, totalLayers);
+	
+	auto inputReference = input.add(1.0f).multiply(0.4f).add(0.1f);
+	
+	util::log("UnsupervisedLearner") << "Training feature selector layers "
+		"0 to " << layerEnd << "\n";
+	
+	auto network = _formAugmentedNetwork(0, layerEnd);
+	
+	network.train(input, inputReference);
+	
+	_restoreAugmentedNetwork(network, 0);
+	
+	// later groups train from the features of this one after it has seen
+	// the entire database, keep the inputs to compute them from
+	if(layerEnd < totalLayers)
+	{
+		if(!_inputStore)
+		{
+			_inputStore.reset(new FeatureStore(getFeatureStorePath(*_model, 0),
+				_halfPrecisionFeatures));
+		}
+		
+		_inputStore->append(input);
+	}
+	
+	_batchSize = std::max(_batchSize, input.rows());
+}
+
+void UnsupervisedLearnerEngine::_pretrainRemainingGroups()
+{
+	auto totalLayers = getTotalLayers(*_model);
+	
+	std::unique_ptr<FeatureStore> inputs = std::move(_inputStore);
+	
+	inputs->finish();
+	
+	for(size_t counter = _layersPerIteration; counter < totalLayers;
+		counter += _layersPerIteration)
+	{
+		size_t counterEnd = std::min(counter + _layersPerIteration,
+			totalLayers);
+		
+		// each group runs forward over the database once to produce the
+		// inputs of the next group, rather than once per batch per group
+		inputs = _storeFeatures(*inputs, counter - _layersPerIteration, counter);
+		
+		util::log("UnsupervisedLearner") << "Training feature selector layers "
+			<< counter << " to " << counterEnd << " on " << inputs->rows()
+			<< " stored samples\n";
+		
+		auto network = _formAugmentedNetwork(counter, counterEnd);
+		
+		for(size_t row = 0; row < inputs->rows(); row += _batchSize)
+		{
+			auto batch = inputs->getRows(row,
+				std::min(_batchSize, inputs->rows() - row));
+			
+			// the group reconstructs its own inputs
+			auto reference = batch;
+			
+			network.train(std::move(batch), std::move(reference));
+		}
+		
+		_restoreAugmentedNetwork(network, counter);
+	}
+}
+
+std::unique_ptr<FeatureStore> UnsupervisedLearnerEngine::_storeFeatures(
+	const FeatureStore& inputs, size_t layerBegin, size_t layerEnd)
+{
+	std::unique_ptr<FeatureStore> features(new FeatureStore(
+		getFeatureStorePath(*_model, layerEnd), _halfPrecisionFeatures));
+	
+	auto network = _formNetwork(layerBegin, layerEnd);
+	
+	for(size_t row = 0; row < inputs.rows(); row += _batchSize)
+	{
+		auto batch = inputs.getRows(row,
+			std::min(_batchSize, inputs.rows() - row));
+		
+		features->append(network.runInputs(batch));
+	}
+	
+	_restoreNetwork(network, layerBegin, layerEnd);
+	
+	features->finish();
+	
+	return features;
+}
+
+neuralnetwork::NeuralNetwork UnsupervisedLearnerEngine::_formNetwork(size_t layerBegin, size_t layerEnd)
 {
 	// Move the network into the temporary
 	auto& featureSelector = _model->getNeuralNetwork("FeatureSelector");
@@ -109,6 +236,23 @@ neuralnetwork::NeuralNetwork UnsupervisedLearnerEngine::_formAugmentedNetwork(si
 	
 	network.setParameters(featureSelector);
 	
+	return network;
+}
+
+void UnsupervisedLearnerEngine::_restoreNetwork(neuralnetwork::NeuralNetwork& network, size_t layerBegin, size_t layerEnd)
+{
+	auto& featureSelector = _model->getNeuralNetwork("FeatureSelector");
+	
+	for(size_t layerId = layerBegin; layerId < layerEnd; ++layerId)
+	{	
+		featureSelector[layerId] = std::move(network[layerId - layerBegin]);
+	}
+}
+
+neuralnetwork::NeuralNetwork UnsupervisedLearnerEngine::_formAugmentedNetwork(size_t layerBegin, size_t layerEnd)
+{
+	auto network = _formNetwork(layerBegin, layerEnd);
+	
 	// Create or restore the augmentor layers
 	auto& augmentor = _getOrCreateAugmentor("FeatureSelector", layerBegin, network);
 	
@@ -123,21 +267,17 @@ neuralnetwork::NeuralNetwork UnsupervisedLearnerEngine::_formAugmentedNetwork(si
 
 void UnsupervisedLearnerEngine::_restoreAugmentedNetwork(neuralnetwork::NeuralNetwork& network, size_t layerBegin)
 {
-	auto& featureSelector = _model->getNeuralNetwork("FeatureSelector");
 	auto& augmentor = _getAugmentor("FeatureSelector", layerBegin);
 
 	size_t layerEnd = layerBegin + network.size() - augmentor.size();
 	
 	// restore the network layers
-	for(size_t layerId = layerBegin; layerId < layerEnd; ++layerId)
-	{	
-		featureSelector[layerId] = std::move(network[layerId]);
-	}
+	_restoreNetwork(network, layerBegin, layerEnd);
 	
 	// restore the augmentor layers
 	for(size_t layerId = 0, lastLayer = augmentor.size(); layerId < lastLayer; ++layerId)
 	{
-		augmentor[layerId] = std::move(network[layerId + layerEnd]);
+		augmentor[layerId] = std::move(network[layerId + layerEnd - layerBegin]);
 	}
 }
 
@@ -155,7 +295,12 @@ neuralnetwork::NeuralNetwork& UnsupervisedLearnerEngine::_getOrCreateAugmentor(c
 		augmentor = _augmentorNetworks.insert(std::make_pair(stream.str(),
 			neuralnetwork::NeuralNetwork())).first;
 		
-		augmentor->second.mirror(network.front());
+		// mirror the outputs of the group back onto its inputs
+		network.mirror(network.front());
+		
+		augmentor->second.addLayer(std::move(network.back()));
+		
+		network.resize(network.size() - 1);
 	}
 	
 	return augmentor->second;
@@ -175,11 +320,34 @@ neuralnetwork::NeuralNetwork& UnsupervisedLearnerEngine::_getAugmentor(const std
 	return augmentor->second;
 }
 
+void UnsupervisedLearnerEngine::registerModel()
+{
+	// the stored features of the first group are not part of a checkpoint
+	if(_pretrainGreedily && util::KnobDatabase::getKnobValue(
+		"Engine::ResumeFromCheckpoint", false))
+	{
+		throw std::runtime_error("Greedy pretraining can not be resumed "
+			"from a checkpoint, restart it without resuming.");
+	}
+}
+
 void UnsupervisedLearnerEngine::closeModel()
 {
+	if(_inputStore)
+	{
+		_pretrainRemainingGroups();
+	}
+	
 	saveModel();
 }
 
+bool UnsupervisedLearnerEngine::modifiesModel() const
+{
+	// don't checkpoint a greedy pass, a resumed run would only store the
+	// features of the remaining batches for the later groups
+	return !_pretrainGreedily;
+}
+
 }
 
 }
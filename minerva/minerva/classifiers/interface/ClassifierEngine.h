@@ -9,6 +9,10 @@
 // Minerva Includes
 #include <minerva/classifiers/interface/Engine.h>
 
+#include <minerva/neuralnetwork/interface/InferencePlan.h>
+
+#include <minerva/util/interface/string.h>
+
 // Standard Library Includes
 #include <map>
 
@@ -18,6 +22,12 @@ namespace minerva
 namespace classifiers
 {
 
+/*! \brief Classifies samples with the prebuilt inference plan of the model.
+
+	Knobs:
+		ClassifierEngine::UseInt8 - run the int8 plan, using the calibration
+			saved in the model by the QuantizerEngine
+*/
 class ClassifierEngine : public Engine
 {
 public:
@@ -31,6 +41,27 @@ protected:
 	virtual ResultVector runOnBatch(Matrix&& inputs, Matrix&& reference);
 	virtual bool requiresLabeledData() const;
 
+protected:
+	/*! \brief Build the inference plan for the model */
+	virtual void registerModel();
+	/*! \brief Release the inference plan */
+	virtual void closeModel();
+
+protected:
+	/*! \brief Get the network that holds the output labels */
+	const NeuralNetwork& getLabeledNetwork() const;
+
+	/*! \brief Get the label of the most active output of each sample */
+	util::StringVector getLabels(const Matrix& activations) const;
+
+protected:
+	/*! \brief Build a plan for the feature selector and classifier */
+	void buildPlan(neuralnetwork::InferencePlan& plan) const;
+
+protected:
+	/*! \brief The prebuilt forward propagation schedule for the model */
+	neuralnetwork::InferencePlan _plan;
+
 private:
 	bool _shouldUseLabeledData;
 
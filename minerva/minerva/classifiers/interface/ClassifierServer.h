@@ -0,0 +1,78 @@
+/*	\file   ClassifierServer.h
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The header file for the ClassifierServer class.
+*/
+
+#pragma once
+
+// Minerva Includes
+#include <minerva/classifiers/interface/ClassifierEngine.h>
+
+// Standard Library Includes
+#include <memory>
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+/*! \brief A server that answers classification requests over a local socket.
+
+	Each request is a line holding the path of one image, and the response is
+	a line holding its label.  Requests from all connections are coalesced
+	into batches by a dynamic batcher, and the model stays resident for the
+	lifetime of the server.
+	
+	The 'STATS' request returns the throughput, queue depth, and latency
+	counters, 'QUIT' closes the connection, and 'SHUTDOWN' stops the server.
+*/
+class ClassifierServer : public ClassifierEngine
+{
+public:
+	ClassifierServer();
+	virtual ~ClassifierServer();
+
+public:
+	/*! \brief Serve requests on the specified port until stopped. */
+	void serve(unsigned int port);
+	
+	/*! \brief Stop a running server (safe to call from any thread). */
+	void stop();
+
+public:
+	/*! \brief Get a one line summary of the server counters. */
+	std::string getStatistics() const;
+
+private:
+	class Request;
+	class RequestQueue;
+	class Statistics;
+	class ConnectionList;
+
+	typedef std::shared_ptr<Request> RequestPointer;
+	typedef std::vector<RequestPointer> RequestVector;
+
+private:
+	void _acceptConnections();
+	void _serveConnection(int socket);
+	void _runBatch(RequestVector& batch);
+
+private:
+	std::unique_ptr<RequestQueue>   _queue;
+	std::unique_ptr<Statistics>     _statistics;
+	std::unique_ptr<ConnectionList> _connections;
+
+private:
+	std::atomic<int> _listenSocket;
+
+};
+
+}
+
+}
+
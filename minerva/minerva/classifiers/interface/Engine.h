@@ -90,6 +90,9 @@ protected:
 
 	/*! \brief Determines whether or not the engine must use labeled data */	
 	virtual bool requiresLabeledData() const;
+	/*! \brief Determines whether or not the engine updates the model,
+		engines that do are periodically checkpointed and can resume. */
+	virtual bool modifiesModel() const;
 
 protected:
 	/*! \brief Save the model to persistent storage. */
@@ -112,6 +115,7 @@ private:
 
 private:
 	void _setupProducer(const std::string& databasePath);
+	void _reportLoadedModel() const;
 
 protected:
 	std::unique_ptr<Model>              _model;
@@ -0,0 +1,82 @@
+/*	\file   FeatureStore.h
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The header file for the FeatureStore class.
+*/
+
+#pragma once
+
+// Standard Library Includes
+#include <string>
+#include <fstream>
+#include <memory>
+
+// Forward Declarations
+namespace minerva { namespace matrix { class Matrix;           } }
+namespace minerva { namespace util   { class MemoryMappedFile; } }
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+/*! \brief A temporary on-disk table of feature rows.
+
+	Rows are appended while the store is being written, and read back in
+	batches through a memory mapping once it is finished.  Values are
+	optionally stored as 16-bit floats to halve the size of the file.
+	The file is deleted along with the store.
+*/
+class FeatureStore
+{
+public:
+	typedef matrix::Matrix Matrix;
+
+public:
+	FeatureStore(const std::string& path, bool halfPrecision = false);
+	~FeatureStore();
+
+public:
+	FeatureStore(const FeatureStore&) = delete;
+	FeatureStore& operator=(const FeatureStore&) = delete;
+
+public:
+	/*! \brief Append each row of a matrix to the store */
+	void append(const Matrix& features);
+
+	/*! \brief Stop writing and map the store for reading */
+	void finish();
+
+public:
+	/*! \brief Read a batch of rows, the store must be finished */
+	Matrix getRows(size_t begin, size_t count) const;
+
+public:
+	size_t rows()    const;
+	size_t columns() const;
+	bool   empty()   const;
+
+public:
+	const std::string& path() const;
+
+private:
+	typedef std::unique_ptr<util::MemoryMappedFile> MemoryMappedFilePointer;
+
+private:
+	std::string _path;
+	bool        _halfPrecision;
+
+	size_t _rows;
+	size_t _columns;
+
+private:
+	std::ofstream           _stream;
+	MemoryMappedFilePointer _mappedFile;
+
+};
+
+}
+
+}
+
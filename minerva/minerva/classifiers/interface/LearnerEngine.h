@@ -35,6 +35,7 @@ private:
 	virtual ResultVector runOnBatch(Matrix&& input, Matrix&& reference);
 	
 	virtual bool requiresLabeledData() const;
+	virtual bool modifiesModel() const;
 
 
 };
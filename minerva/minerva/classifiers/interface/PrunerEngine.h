@@ -0,0 +1,65 @@
+/*	\file   PrunerEngine.h
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The header file for the PrunerEngine class.
+*/
+
+#pragma once
+
+// Minerva Includes
+#include <minerva/classifiers/interface/Engine.h>
+
+// Standard Library Includes
+#include <memory>
+
+// Forward Declarations
+namespace minerva { namespace neuralnetwork { class NeuralNetworkPruner; } }
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+/*! \brief Prunes a trained model, fine-tunes it on labeled batches with the
+	pruned weights held at zero, and then removes the pruned neurons.
+
+	Knobs:
+		PrunerEngine::Threshold - weights, neurons, and blocks with a root
+			mean square magnitude below this are pruned
+*/
+class PrunerEngine : public Engine
+{
+public:
+	PrunerEngine();
+	virtual ~PrunerEngine();
+
+public:
+	PrunerEngine(const PrunerEngine&) = delete;
+	PrunerEngine& operator=(const PrunerEngine&) = delete;
+
+public:
+	void setThreshold(float threshold);
+
+private:
+	virtual void registerModel();
+	virtual void closeModel();
+
+private:
+	virtual ResultVector runOnBatch(Matrix&& input, Matrix&& reference);
+	
+	virtual bool requiresLabeledData() const;
+	virtual bool modifiesModel() const;
+
+private:
+	float _threshold;
+
+private:
+	std::unique_ptr<neuralnetwork::NeuralNetworkPruner> _pruner;
+
+};
+
+}
+
+}
+
@@ -0,0 +1,73 @@
+/*	\file   QuantizerEngine.h
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The header file for the QuantizerEngine class.
+*/
+
+#pragma once
+
+// Minerva Includes
+#include <minerva/classifiers/interface/ClassifierEngine.h>
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+/*! \brief Calibrates the int8 inference plan of a model on labeled batches,
+	reports its accuracy against fp32 on the batches that follow, and saves
+	the calibration with the model.
+
+	Only the calibration is stored, the int8 weights are derived from the
+	fp32 weights when the model is loaded with ClassifierEngine::UseInt8.
+
+	Knobs:
+		QuantizerEngine::CalibrationSamples - samples used to find the
+			activation ranges, later samples are used for the report
+*/
+class QuantizerEngine : public ClassifierEngine
+{
+public:
+	QuantizerEngine();
+	virtual ~QuantizerEngine();
+
+public:
+	void setCalibrationSamples(size_t samples);
+
+private:
+	virtual void registerModel();
+	virtual void closeModel();
+
+private:
+	virtual ResultVector runOnBatch(Matrix&& input, Matrix&& reference);
+	
+	virtual bool requiresLabeledData() const;
+	virtual bool modifiesModel() const;
+
+private:
+	std::string _getReport() const;
+
+private:
+	neuralnetwork::InferencePlan _quantizedPlan;
+
+private:
+	size_t _calibrationSamples;
+	size_t _calibratedSamples;
+
+private:
+	size_t _evaluatedSamples;
+	size_t _fp32Matches;
+	size_t _int8Matches;
+	size_t _agreements;
+
+private:
+	double _fp32Seconds;
+	double _int8Seconds;
+
+};
+
+}
+
+}
+
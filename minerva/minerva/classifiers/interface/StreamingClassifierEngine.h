@@ -0,0 +1,89 @@
+/*	\file   StreamingClassifierEngine.h
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The header file for the StreamingClassifierEngine class.
+*/
+
+#pragma once
+
+// Minerva Includes
+#include <minerva/classifiers/interface/ClassifierEngine.h>
+
+// Forward Declarations
+namespace minerva { namespace video { class VideoStream; } }
+namespace minerva { namespace video { class ImageVector; } }
+
+// Standard Library Includes
+#include <memory>
+#include <vector>
+#include <string>
+#include <exception>
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+/*! \brief A classifier that labels the frames of a live video stream.
+
+	Frames are read on a separate thread into a bounded queue, and are
+	classified in micro-batches as they arrive.  When classification falls
+	behind, frames are dropped according to the configured policy.
+*/
+class StreamingClassifierEngine : public ClassifierEngine
+{
+public:
+	StreamingClassifierEngine();
+	virtual ~StreamingClassifierEngine();
+
+public:
+	/*! \brief Classify each frame of a video file or device as it arrives. */
+	void runOnVideoStream(const std::string& pathToVideo);
+	/*! \brief Classify each frame of an open stream as it arrives. */
+	void runOnVideoStream(video::VideoStream& stream);
+
+public:
+	/*! \brief Get the end-to-end latency (seconds) at a percentile in [0, 100]. */
+	double getLatencyPercentile(double percentile) const;
+
+	/*! \brief Get the number of frames that were classified. */
+	size_t getClassifiedFrameCount() const;
+	/*! \brief Get the number of frames that were dropped. */
+	size_t getDroppedFrameCount() const;
+	/*! \brief Get the largest number of frames that waited in the queue. */
+	size_t getMaximumQueuedFrameCount() const;
+
+protected:
+	/*! \brief Label a micro-batch of frames with the inference plan. */
+	virtual util::StringVector classifyImages(const video::ImageVector& images);
+
+private:
+	class QueuedFrame;
+	class FrameQueue;
+
+	typedef std::vector<QueuedFrame> QueuedFrameVector;
+	typedef std::vector<double> LatencyVector;
+
+private:
+	void _readFrames(video::VideoStream& stream);
+	void _classifyFrames(QueuedFrameVector& frames);
+	void _reportLatency() const;
+
+private:
+	std::unique_ptr<FrameQueue> _queue;
+
+private:
+	LatencyVector _latencies;
+	size_t        _droppedFrames;
+	size_t        _maximumQueuedFrames;
+
+private:
+	std::exception_ptr _readerException;
+
+};
+
+}
+
+}
+
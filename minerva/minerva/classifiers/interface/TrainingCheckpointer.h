@@ -0,0 +1,86 @@
+/*	\file   TrainingCheckpointer.h
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The header file for the TrainingCheckpointer class.
+*/
+
+#pragma once
+
+// Standard Library Includes
+#include <string>
+#include <future>
+#include <chrono>
+
+// Forward Declarations
+namespace minerva { namespace model { class Model; } }
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+/*! \brief Periodically saves snapshots of a model being trained in the
+	background, and finds the newest one to resume from.
+
+	Checkpoints are written to '<model>.checkpoint', the one before it is
+	kept as '<model>.checkpoint.previous'.
+*/
+class TrainingCheckpointer
+{
+public:
+	typedef model::Model Model;
+
+public:
+	TrainingCheckpointer(const std::string& modelPath);
+	~TrainingCheckpointer();
+
+public:
+	TrainingCheckpointer(const TrainingCheckpointer&) = delete;
+	TrainingCheckpointer& operator=(const TrainingCheckpointer&) = delete;
+
+public:
+	/*! \brief Is a checkpoint due after this many batches? */
+	bool isDue(size_t batches) const;
+	
+	/*! \brief Snapshot the model and save it on a background thread */
+	void checkpoint(const Model& model, const std::string& producerState,
+		size_t batches);
+	
+	/*! \brief Wait for the checkpoint being written, if any.
+	
+		A failed checkpoint is logged rather than thrown, so that training
+		goes on from the last good one.
+	*/
+	void wait();
+
+public:
+	/*! \brief Copy the newest checkpoint that can be read into the model.
+	
+		Returns false if there is no valid checkpoint.
+	*/
+	bool restore(Model& model, std::string& producerState, size_t& batches);
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+private:
+	std::string _modelPath;
+
+private:
+	size_t _batchInterval;
+	double _secondsInterval;
+
+private:
+	size_t            _lastCheckpointBatch;
+	Clock::time_point _lastCheckpointTime;
+
+private:
+	std::future<void> _pendingCheckpoint;
+
+};
+
+}
+
+}
+
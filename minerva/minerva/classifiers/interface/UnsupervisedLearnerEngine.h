@@ -11,6 +11,10 @@
 
 // Standard Library Includes
 #include <map>
+#include <memory>
+
+// Forward Declarations
+namespace minerva { namespace classifiers { class FeatureStore; } }
 
 namespace minerva
 {
@@ -32,14 +36,30 @@ public:
 
 public:
 	void setLayersPerIteration(size_t layers);
+
+	/*! \brief Train each group of layers over the entire database before
+		starting the next one, streaming the features of the previous group
+		from disk rather than recomputing them for every batch. */
+	void setPretrainGreedily(bool greedy);
 	
+
 private:
+	virtual void registerModel();
 	virtual void closeModel();
+	virtual bool modifiesModel() const;
 	
 private:
 	virtual ResultVector runOnBatch(Matrix&& samples, Matrix&& reference);
 
 private:
+	void _trainFirstGroupAndStoreInputs(Matrix&& input);
+	void _pretrainRemainingGroups();
+	std::unique_ptr<FeatureStore> _storeFeatures(const FeatureStore& inputs,
+		size_t layerBegin, size_t layerEnd);
+
+private:
+	NeuralNetwork _formNetwork(size_t layerBegin, size_t layerEnd);
+	void _restoreNetwork(NeuralNetwork& network, size_t layerBegin, size_t layerEnd);
 	NeuralNetwork _formAugmentedNetwork(size_t layerBegin, size_t layerEnd);
 	void _restoreAugmentedNetwork(NeuralNetwork& network, size_t layerBegin);
 	NeuralNetwork& _getOrCreateAugmentor(const std::string& name, size_t layer, NeuralNetwork& network);
@@ -47,6 +67,9 @@ private:
 
 private:
 	size_t _layersPerIteration;
+	bool   _pretrainGreedily;
+	bool   _halfPrecisionFeatures;
+	size_t _batchSize;
 
 private:
 	typedef std::map<std::string, NeuralNetwork> NetworkMap;
@@ -54,6 +77,9 @@ private:
 private:
 	NetworkMap _augmentorNetworks;
 
+private:
+	std::unique_ptr<FeatureStore> _inputStore;
+
 };
 
 }
@@ -0,0 +1,271 @@
+/*! \file   test-feature-store.cpp
+	\author Gregory Diamos
+	\date   Sunday October 18, 2026
+	\brief  A unit test for the on-disk feature store.
+*/
+
+// Minerva Includes
+#include <minerva/classifiers/interface/FeatureStore.h>
+
+#include <minerva/matrix/interface/Matrix.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/ArgumentParser.h>
+
+// Standard Library Includes
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cmath>
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+typedef matrix::Matrix Matrix;
+typedef std::vector<float> FloatVector;
+
+static Matrix toRow(const FloatVector& values)
+{
+	Matrix row(1, values.size());
+
+	std::copy(values.begin(), values.end(), row.data().begin());
+
+	return row;
+}
+
+static Matrix roundTrip(const std::string& path, bool halfPrecision,
+	const FloatVector& values)
+{
+	FeatureStore store(path, halfPrecision);
+
+	store.append(toRow(values));
+	store.finish();
+
+	return store.getRows(0, 1);
+}
+
+static bool isSame(float left, float right)
+{
+	if(std::isnan(left) || std::isnan(right))
+	{
+		return std::isnan(left) && std::isnan(right);
+	}
+
+	// compare the bits to tell -0 from 0
+	return std::memcmp(&left, &right, sizeof(float)) == 0;
+}
+
+static bool matches(const Matrix& result, const FloatVector& expected,
+	const std::string& name)
+{
+	bool passed = true;
+
+	for(size_t i = 0; i < expected.size(); ++i)
+	{
+		float value = result.data()[i];
+
+		if(!isSame(value, expected[i]))
+		{
+			std::cout << "  " << name << " value " << i << " read back as "
+				<< value << ", expected " << expected[i] << "\n";
+			passed = false;
+		}
+	}
+
+	return passed;
+}
+
+static bool reportTest(bool passed, const std::string& name)
+{
+	std::cout << " Feature Store " << name << " Test "
+		<< (passed ? "Passed" : "Failed") << "\n";
+
+	return passed;
+}
+
+static FloatVector specialValues()
+{
+	float infinity = std::numeric_limits<float>::infinity();
+
+	return FloatVector({0.0f, -0.0f, 1.0f, -2.5f, infinity, -infinity,
+		std::numeric_limits<float>::quiet_NaN(),
+		std::numeric_limits<float>::denorm_min(), 1.0e-40f,
+		std::numeric_limits<float>::max(), 3.14159265f});
+}
+
+static bool testSinglePrecision(const std::string& path)
+{
+	auto values = specialValues();
+
+	bool passed = matches(roundTrip(path, false, values), values,
+		"Single precision");
+
+	return reportTest(passed, "Single Precision");
+}
+
+static bool testHalfPrecision(const std::string& path)
+{
+	float infinity = std::numeric_limits<float>::infinity();
+
+	FloatVector values({
+		0.0f, -0.0f, 1.0f, -2.5f, infinity, -infinity,
+		std::numeric_limits<float>::quiet_NaN(),
+		65504.0f,                       // largest half
+		70000.0f,                       // overflows
+		-70000.0f,
+		std::ldexp(1.0f, -14),          // smallest normal half
+		std::ldexp(1.0f, -24),          // smallest denormal half
+		std::ldexp(3.0f, -24),          // denormal half
+		-std::ldexp(5.0f, -24),
+		std::ldexp(1.0f, -26),          // underflows
+		1.0e-40f,                       // float denormal underflows
+		1.0f + std::ldexp(1.0f, -11),   // ties to even, rounds down
+		1.0f + std::ldexp(3.0f, -11),   // ties to even, rounds up
+		2047.0f + 0.75f                 // rounds up into the next exponent
+	});
+
+	FloatVector expected({
+		0.0f, -0.0f, 1.0f, -2.5f, infinity, -infinity,
+		std::numeric_limits<float>::quiet_NaN(),
+		65504.0f,
+		infinity,
+		-infinity,
+		std::ldexp(1.0f, -14),
+		std::ldexp(1.0f, -24),
+		std::ldexp(3.0f, -24),
+		-std::ldexp(5.0f, -24),
+		0.0f,
+		0.0f,
+		1.0f,
+		1.0f + std::ldexp(1.0f, -9),
+		2048.0f
+	});
+
+	bool passed = matches(roundTrip(path, true, values), expected,
+		"Half precision");
+
+	return reportTest(passed, "Half Precision");
+}
+
+static bool testReadAcrossAppends(const std::string& path, bool halfPrecision)
+{
+	size_t columns = 3;
+
+	FeatureStore store(path, halfPrecision);
+
+	bool passed = true;
+
+	for(size_t batch = 0; batch < 4; ++batch)
+	{
+		Matrix rows(batch + 1, columns);
+
+		for(size_t i = 0; i < rows.data().size(); ++i)
+		{
+			rows.data()[i] = batch * 16 + i;
+		}
+
+		store.append(rows);
+	}
+
+	store.finish();
+
+	if(store.rows() != 10 || store.columns() != columns)
+	{
+		std::cout << "  Store holds " << store.rows() << " rows of "
+			<< store.columns() << " columns, expected 10 of " << columns << "\n";
+		passed = false;
+	}
+
+	// rows 1 through 5 span the second and third appends
+	FloatVector expected({
+		16.0f, 17.0f, 18.0f, 19.0f, 20.0f, 21.0f,
+		32.0f, 33.0f, 34.0f, 35.0f, 36.0f, 37.0f, 38.0f, 39.0f, 40.0f});
+
+	auto result = store.getRows(1, 5);
+
+	passed &= result.rows() == 5 && matches(result, expected,
+		"Rows across appends");
+
+	bool threw = false;
+
+	try
+	{
+		store.getRows(8, 3);
+	}
+	catch(const std::exception&)
+	{
+		threw = true;
+	}
+
+	if(!threw)
+	{
+		std::cout << "  Reading past the end did not fail\n";
+		passed = false;
+	}
+
+	return reportTest(passed, std::string("Read Across Appends") +
+		(halfPrecision ? " (Half)" : ""));
+}
+
+static void runTest(const std::string& path)
+{
+	bool passed = testSinglePrecision(path);
+
+	passed &= testHalfPrecision(path);
+	passed &= testReadAcrossAppends(path, false);
+	passed &= testReadAcrossAppends(path, true);
+
+	if(passed)
+	{
+		std::cout << "Test Passed\n";
+	}
+	else
+	{
+		std::cout << "Test Failed\n";
+	}
+}
+
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+
+	bool verbose = false;
+
+	std::string path;
+
+	parser.description("The minerva feature store test.");
+
+	parser.parse("-p", "--path", path, "test-feature-store.features",
+		"The temporary file used by the store.");
+	parser.parse("-v", "--verbose", verbose, false,
+		"Print out log messages during execution");
+
+	parser.parse();
+
+	if(verbose)
+	{
+		minerva::util::enableAllLogs();
+	}
+
+	try
+	{
+		minerva::classifiers::runTest(path);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Feature Store Test Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+	}
+
+	return 0;
+}
+
@@ -0,0 +1,340 @@
+/*! \file   test-streaming-classifier.cpp
+	\author Gregory Diamos
+	\date   Sunday October 18, 2026
+	\brief  A unit test for classifying a stream that outpaces the classifier.
+*/
+
+// Minerva Includes
+#include <minerva/classifiers/interface/StreamingClassifierEngine.h>
+
+#include <minerva/model/interface/Model.h>
+
+#include <minerva/neuralnetwork/interface/NeuralNetwork.h>
+#include <minerva/neuralnetwork/interface/Layer.h>
+
+#include <minerva/results/interface/ResultProcessor.h>
+#include <minerva/results/interface/TimestampedLabelResult.h>
+#include <minerva/results/interface/ResultVector.h>
+
+#include <minerva/video/interface/VideoStream.h>
+#include <minerva/video/interface/ImageVector.h>
+#include <minerva/video/interface/Image.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/ArgumentParser.h>
+
+// Standard Library Includes
+#include <random>
+#include <iostream>
+#include <sstream>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <set>
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+typedef std::set<size_t> FrameSet;
+
+/*! \brief A stream of small generated frames that never waits. */
+class SyntheticVideoStream : public video::VideoStream
+{
+public:
+	explicit SyntheticVideoStream(size_t frames)
+	: _frames(frames), _frame(0)
+	{
+
+	}
+
+public:
+	virtual bool finished() const
+	{
+		return _frame >= _frames;
+	}
+
+	virtual bool getNextFrame(video::Image& image)
+	{
+		if(finished())
+		{
+			return false;
+		}
+
+		image = video::Image(2, 2, 3, 1);
+
+		for(size_t y = 0; y < 2; ++y)
+		{
+			for(size_t x = 0; x < 2; ++x)
+			{
+				for(size_t color = 0; color < 3; ++color)
+				{
+					image.setComponentAt(x, y, color,
+						(_frame * 7 + x + y + color) % 256);
+				}
+			}
+		}
+
+		++_frame;
+
+		return true;
+	}
+
+	virtual size_t getTotalFrames() const
+	{
+		return _frames;
+	}
+
+	virtual bool seek(size_t frame)
+	{
+		return false;
+	}
+
+	virtual size_t getSeekCost(size_t frame) const
+	{
+		return 0;
+	}
+
+private:
+	size_t              _frames;
+	std::atomic<size_t> _frame;
+
+};
+
+/*! \brief A classifier that takes 'delay' seconds per micro-batch.
+
+	The first batch also waits for the whole stream to be read, so that
+	the queue is certain to overflow however fast the machine is.
+*/
+class SlowClassifierEngine : public StreamingClassifierEngine
+{
+public:
+	SlowClassifierEngine(const SyntheticVideoStream& stream, double delay)
+	: _stream(stream), _delay(delay), _isFirstBatch(true)
+	{
+
+	}
+
+protected:
+	virtual util::StringVector classifyImages(const video::ImageVector& images)
+	{
+		while(_isFirstBatch && !_stream.finished())
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		_isFirstBatch = false;
+
+		std::this_thread::sleep_for(std::chrono::duration<double>(_delay));
+
+		return StreamingClassifierEngine::classifyImages(images);
+	}
+
+private:
+	const SyntheticVideoStream& _stream;
+	double                      _delay;
+	bool                        _isFirstBatch;
+
+};
+
+/*! \brief Record the index of each classified frame. */
+class FrameRecorder : public results::ResultProcessor
+{
+public:
+	explicit FrameRecorder(FrameSet& frames)
+	: _frames(frames)
+	{
+
+	}
+
+public:
+	virtual void process(const results::ResultVector& results)
+	{
+		for(auto result : results)
+		{
+			auto labelResult =
+				dynamic_cast<results::TimestampedLabelResult*>(result);
+
+			assertM(labelResult != nullptr, "Expecting timestamped label results.");
+
+			_frames.insert(labelResult->frame);
+		}
+	}
+
+private:
+	FrameSet& _frames;
+
+};
+
+static std::string toString(size_t value)
+{
+	std::stringstream stream;
+
+	stream << value;
+
+	return stream.str();
+}
+
+static model::Model* createModel(std::default_random_engine& engine)
+{
+	auto model = new model::Model;
+
+	neuralnetwork::NeuralNetwork featureSelector;
+
+	featureSelector.addLayer(neuralnetwork::Layer(1, 12, 8));
+	featureSelector.initializeRandomly(engine);
+
+	neuralnetwork::NeuralNetwork classifier;
+
+	classifier.addLayer(neuralnetwork::Layer(1, 8, 2));
+	classifier.initializeRandomly(engine);
+
+	classifier.setLabelForOutputNeuron(0, "dark");
+	classifier.setLabelForOutputNeuron(1, "bright");
+
+	model->setNeuralNetwork("FeatureSelector", featureSelector);
+	model->setNeuralNetwork("Classifier",      classifier);
+
+	return model;
+}
+
+static bool check(bool condition, const std::string& message)
+{
+	if(!condition)
+	{
+		std::cout << "  " << message << "\n";
+	}
+
+	return condition;
+}
+
+static bool testDropPolicy(const std::string& policy, size_t frames,
+	size_t capacity, double delay, std::default_random_engine& engine)
+{
+	util::KnobDatabase::setKnob("StreamingClassifierEngine::DropPolicy", policy);
+	util::KnobDatabase::setKnob("StreamingClassifierEngine::QueueCapacity",
+		toString(capacity));
+	util::KnobDatabase::setKnob("StreamingClassifierEngine::MicroBatchSize", "2");
+
+	SyntheticVideoStream stream(frames);
+	SlowClassifierEngine classifierEngine(stream, delay);
+
+	FrameSet classifiedFrames;
+
+	classifierEngine.setModel(createModel(engine));
+	classifierEngine.setResultProcessor(new FrameRecorder(classifiedFrames));
+
+	classifierEngine.runOnVideoStream(stream);
+
+	size_t classified = classifierEngine.getClassifiedFrameCount();
+	size_t dropped    = classifierEngine.getDroppedFrameCount();
+
+	bool passed = true;
+
+	passed &= check(classified == classifiedFrames.size(),
+		"Classified frame count does not match the results");
+	passed &= check(classified + dropped == frames,
+		"Classified and dropped frames do not add up to the stream");
+	passed &= check(dropped > 0, "No frames were dropped");
+	passed &= check(classifierEngine.getMaximumQueuedFrameCount() <= capacity,
+		"The queue held " +
+		toString(classifierEngine.getMaximumQueuedFrameCount()) +
+		" frames, more than its capacity of " + toString(capacity));
+
+	// the frames that a policy keeps can never be displaced
+	for(size_t i = 0; i < capacity; ++i)
+	{
+		size_t frame = policy == "DropOldest" ? frames - 1 - i : i;
+
+		passed &= check(classifiedFrames.count(frame) != 0,
+			"Frame " + toString(frame) + " should have been kept");
+	}
+
+	double p50 = classifierEngine.getLatencyPercentile(50.0);
+	double p90 = classifierEngine.getLatencyPercentile(90.0);
+	double p99 = classifierEngine.getLatencyPercentile(99.0);
+	double max = classifierEngine.getLatencyPercentile(100.0);
+
+	passed &= check(p50 > 0.0, "The median latency was not reported");
+	passed &= check(p50 <= p90 && p90 <= p99 && p99 <= max,
+		"Latency percentiles are out of order");
+	passed &= check(max >= delay,
+		"The latency does not include the time spent classifying");
+
+	std::cout << " Streaming " << policy << " Test "
+		<< (passed ? "Passed" : "Failed") << " (" << classified
+		<< " classified, " << dropped << " dropped, p50 " << p50
+		<< "s, p99 " << p99 << "s)\n";
+
+	return passed;
+}
+
+static void runTest(size_t frames, size_t capacity, double delay, size_t seed)
+{
+	std::default_random_engine engine(seed);
+
+	bool passed = testDropPolicy("DropOldest", frames, capacity, delay, engine);
+
+	passed &= testDropPolicy("DropNewest", frames, capacity, delay, engine);
+
+	if(passed)
+	{
+		std::cout << "Test Passed\n";
+	}
+	else
+	{
+		std::cout << "Test Failed\n";
+	}
+}
+
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+
+	bool verbose = false;
+
+	size_t frames   = 0;
+	size_t capacity = 0;
+	double delay    = 0.0;
+	size_t seed     = 0;
+
+	parser.description("The minerva streaming classifier test.");
+
+	parser.parse("-f", "--frames", frames, 64,
+		"The number of frames in the stream.");
+	parser.parse("-c", "--capacity", capacity, 4,
+		"The number of frames that the queue can hold.");
+	parser.parse("-d", "--delay", delay, 0.005,
+		"The time (seconds) the classifier spends on each micro-batch.");
+	parser.parse("-s", "--seed", seed, 7,
+		"The seed for the random engine.");
+	parser.parse("-v", "--verbose", verbose, false,
+		"Print out log messages during execution");
+
+	parser.parse();
+
+	if(verbose)
+	{
+		minerva::util::enableAllLogs();
+	}
+
+	try
+	{
+		minerva::classifiers::runTest(frames, capacity, delay, seed);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Streaming Classifier Test Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+	}
+
+	return 0;
+}
+
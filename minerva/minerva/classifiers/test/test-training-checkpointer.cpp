@@ -0,0 +1,404 @@
+/*! \file   test-training-checkpointer.cpp
+	\author Gregory Diamos
+	\date   Sunday October 18, 2026
+	\brief  A unit test for resuming training from a checkpoint.
+*/
+
+// Minerva Includes
+#include <minerva/classifiers/interface/Engine.h>
+
+#include <minerva/model/interface/Model.h>
+
+#include <minerva/neuralnetwork/interface/NeuralNetwork.h>
+#include <minerva/neuralnetwork/interface/Layer.h>
+
+#include <minerva/results/interface/ResultVector.h>
+
+#include <minerva/video/interface/ImageLibrary.h>
+#include <minerva/video/interface/ImageLibraryInterface.h>
+
+#include <minerva/matrix/interface/Matrix.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/ArgumentParser.h>
+
+// Standard Library Includes
+#include <random>
+#include <iostream>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <cstdio>
+#include <vector>
+
+namespace minerva
+{
+
+namespace classifiers
+{
+
+typedef matrix::Matrix Matrix;
+typedef std::vector<Matrix> MatrixVector;
+
+/*! \brief Small images whose pixels are a hash of their path. */
+class SyntheticImageLibrary : public video::ImageLibrary
+{
+public:
+	virtual Header loadHeader(const std::string& path)
+	{
+		return Header(2, 2, 3, 1);
+	}
+
+	virtual DataVector loadData(const std::string& path)
+	{
+		size_t hash = std::hash<std::string>()(path);
+
+		DataVector data(12);
+
+		for(size_t i = 0; i < data.size(); ++i)
+		{
+			data[i] = (hash >> i) % 256;
+		}
+
+		return data;
+	}
+
+public:
+	virtual void saveImage(const std::string& path, const Header& header,
+		const DataVector& data)
+	{
+		throw std::runtime_error("Synthetic images can not be saved.");
+	}
+
+public:
+	virtual void displayOnScreen(size_t x, size_t y, size_t colorComponents,
+		size_t pixelSize, const DataVector& pixels)
+	{
+
+	}
+
+	virtual void deleteWindow()
+	{
+
+	}
+
+	virtual void waitForKey(int delayInMilliseconds)
+	{
+
+	}
+
+	virtual void addTextToStatusBar(const std::string& text)
+	{
+
+	}
+
+public:
+	virtual StringVector getSupportedExtensions() const
+	{
+		return StringVector(1, ".synthetic");
+	}
+
+};
+
+/*! \brief A trainer that records its batches and folds each one into the
+	classifier weights, optionally crashing after a number of batches. */
+class RecordingTrainerEngine : public Engine
+{
+public:
+	RecordingTrainerEngine(MatrixVector& batches, size_t batchesBeforeCrash)
+	: _batches(batches), _batchesBeforeCrash(batchesBeforeCrash)
+	{
+
+	}
+
+protected:
+	virtual bool requiresLabeledData() const
+	{
+		return true;
+	}
+
+	virtual bool modifiesModel() const
+	{
+		return true;
+	}
+
+	virtual ResultVector runOnBatch(Matrix&& input, Matrix&& reference)
+	{
+		if(_batchesBeforeCrash == 0)
+		{
+			throw std::runtime_error("Simulated crash.");
+		}
+
+		--_batchesBeforeCrash;
+
+		_batches.push_back(input);
+
+		float sum = 0.0f;
+
+		for(auto value : input.data())
+		{
+			sum += value;
+		}
+
+		auto& weights = getModel()->getNeuralNetwork("Classifier").front()[0];
+
+		// the weights depend on every batch so far, and on their order
+		for(size_t i = 0; i < weights.data().size(); ++i)
+		{
+			weights.data()[i] = weights.data()[i] * 0.5f + sum * (i + 1);
+		}
+
+		return ResultVector();
+	}
+
+private:
+	MatrixVector& _batches;
+	size_t        _batchesBeforeCrash;
+
+};
+
+static model::Model* createModel(const std::string& path, size_t seed)
+{
+	std::default_random_engine engine(seed);
+
+	auto model = new model::Model;
+
+	neuralnetwork::NeuralNetwork featureSelector;
+
+	featureSelector.addLayer(neuralnetwork::Layer(1, 12, 8));
+	featureSelector.initializeRandomly(engine);
+
+	neuralnetwork::NeuralNetwork classifier;
+
+	classifier.addLayer(neuralnetwork::Layer(1, 8, 2));
+	classifier.initializeRandomly(engine);
+
+	classifier.setLabelForOutputNeuron(0, "dark");
+	classifier.setLabelForOutputNeuron(1, "bright");
+
+	model->setNeuralNetwork("FeatureSelector", featureSelector);
+	model->setNeuralNetwork("Classifier",      classifier);
+
+	model->setPath(path);
+
+	return model;
+}
+
+static void createDatabase(const std::string& path, size_t images)
+{
+	std::ofstream database(path);
+
+	for(size_t i = 0; i < images; ++i)
+	{
+		database << "image" << i << ".synthetic, "
+			<< (i % 2 == 0 ? "dark" : "bright") << "\n";
+	}
+}
+
+static void removeCheckpoints(const std::string& modelPath)
+{
+	std::remove((modelPath + ".checkpoint").c_str());
+	std::remove((modelPath + ".checkpoint.previous").c_str());
+	std::remove((modelPath + ".checkpoint.partial").c_str());
+}
+
+/*! \brief Train on the database, returning the final classifier weights. */
+static Matrix train(const std::string& databasePath,
+	const std::string& modelPath, size_t seed, MatrixVector& batches,
+	size_t batchesBeforeCrash, bool resume)
+{
+	util::KnobDatabase::setKnob("Engine::ResumeFromCheckpoint",
+		resume ? "1" : "0");
+
+	RecordingTrainerEngine engine(batches, batchesBeforeCrash);
+
+	engine.setModel(createModel(modelPath, seed));
+
+	engine.runOnDatabaseFile(databasePath);
+
+	return engine.getModel()->getNeuralNetwork("Classifier").front()[0];
+}
+
+static bool isSame(const Matrix& left, const Matrix& right)
+{
+	return left.rows() == right.rows() && left.columns() == right.columns() &&
+		left.data() == right.data();
+}
+
+static bool reportTest(bool passed, const std::string& name)
+{
+	std::cout << " Training Checkpointer " << name << " Test "
+		<< (passed ? "Passed" : "Failed") << "\n";
+
+	return passed;
+}
+
+static bool testResume(const std::string& databasePath,
+	const std::string& modelPath, size_t seed, size_t batchesBeforeCrash)
+{
+	removeCheckpoints(modelPath);
+
+	MatrixVector uninterruptedBatches;
+
+	auto uninterruptedWeights = train(databasePath, modelPath, seed,
+		uninterruptedBatches, uninterruptedBatches.max_size(), false);
+
+	removeCheckpoints(modelPath);
+
+	bool passed = true;
+
+	MatrixVector crashedBatches;
+
+	try
+	{
+		train(databasePath, modelPath, seed, crashedBatches,
+			batchesBeforeCrash, false);
+
+		std::cout << "  Training did not crash\n";
+		passed = false;
+	}
+	catch(const std::exception&)
+	{
+
+	}
+
+	MatrixVector resumedBatches;
+
+	auto resumedWeights = train(databasePath, modelPath, seed,
+		resumedBatches, resumedBatches.max_size(), true);
+
+	removeCheckpoints(modelPath);
+
+	// checkpoints are written every two batches
+	size_t checkpointedBatches = (batchesBeforeCrash / 2) * 2;
+
+	if(checkpointedBatches + resumedBatches.size() !=
+		uninterruptedBatches.size())
+	{
+		std::cout << "  Resumed training ran " << resumedBatches.size()
+			<< " batches after " << checkpointedBatches
+			<< ", uninterrupted training ran " << uninterruptedBatches.size()
+			<< "\n";
+		passed = false;
+	}
+
+	for(size_t i = 0; passed && i < resumedBatches.size(); ++i)
+	{
+		if(!isSame(resumedBatches[i],
+			uninterruptedBatches[checkpointedBatches + i]))
+		{
+			std::cout << "  Resumed batch " << (checkpointedBatches + i)
+				<< " differs from uninterrupted training\n";
+			passed = false;
+		}
+	}
+
+	if(!isSame(resumedWeights, uninterruptedWeights))
+	{
+		std::cout << "  Resumed weights differ from uninterrupted training\n";
+		passed = false;
+	}
+
+	return reportTest(passed, "Resume");
+}
+
+static bool testFailedCheckpoint(const std::string& databasePath, size_t seed)
+{
+	MatrixVector batches;
+
+	bool passed = true;
+
+	try
+	{
+		train(databasePath, "missing-directory/checkpointed.mdl", seed, batches,
+			batches.max_size(), false);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "  A failed checkpoint stopped training: " << e.what()
+			<< "\n";
+		passed = false;
+	}
+
+	return reportTest(passed, "Failed Checkpoint");
+}
+
+static void runTest(const std::string& path, size_t images,
+	size_t batchesBeforeCrash, size_t seed)
+{
+	video::ImageLibraryInterface::addLibrary(new SyntheticImageLibrary);
+
+	util::KnobDatabase::setKnob("InputDataProducer::BatchSize", "4");
+	util::KnobDatabase::setKnob("TrainingCheckpointer::BatchInterval", "2");
+
+	std::string databasePath = path + ".txt";
+	std::string modelPath    = path + ".mdl";
+
+	createDatabase(databasePath, images);
+
+	bool passed = testResume(databasePath, modelPath, seed, batchesBeforeCrash);
+
+	passed &= testFailedCheckpoint(databasePath, seed);
+
+	std::remove(databasePath.c_str());
+
+	if(passed)
+	{
+		std::cout << "Test Passed\n";
+	}
+	else
+	{
+		std::cout << "Test Failed\n";
+	}
+}
+
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+
+	bool verbose = false;
+
+	std::string path;
+
+	size_t images             = 0;
+	size_t batchesBeforeCrash = 0;
+	size_t seed               = 0;
+
+	parser.description("The minerva training checkpoint and resume test.");
+
+	parser.parse("-p", "--path", path, "test-training-checkpointer",
+		"The prefix of the temporary database and model files.");
+	parser.parse("-i", "--images", images, 40,
+		"The number of images in the database.");
+	parser.parse("-c", "--crash-after", batchesBeforeCrash, 5,
+		"The number of batches trained before the simulated crash.");
+	parser.parse("-s", "--seed", seed, 7,
+		"The seed for the random engine.");
+	parser.parse("-v", "--verbose", verbose, false,
+		"Print out log messages during execution");
+
+	parser.parse();
+
+	if(verbose)
+	{
+		minerva::util::enableAllLogs();
+	}
+
+	try
+	{
+		minerva::classifiers::runTest(path, images, batchesBeforeCrash, seed);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Training Checkpointer Test Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+	}
+
+	return 0;
+}
+
@@ -17,12 +17,18 @@ namespace minerva
 namespace input
 {
 
+static util::Knob<bool> allowSamplingWithReplacementKnob(
+	"InputDataProducer::AllowSamplingWithReplacement", true);
+static util::Knob<double> maximumSamplesToRunKnob(
+	"InputDataProducer::MaximumSamplesToRun", 1e9);
+static util::Knob<int> batchSizeKnob("InputDataProducer::BatchSize", 64);
+
 InputDataProducer::InputDataProducer()
 :  _requiresLabeledData(false), _model(nullptr)
 {
-	_allowSamplingWithReplacement = util::KnobDatabase::getKnobValue("InputDataProducer::AllowSamplingWithReplacement", true);
-	_maximumSamplesToRun          = util::KnobDatabase::getKnobValue("InputDataProducer::MaximumSamplesToRun", 1e9);
-	_batchSize                    = util::KnobDatabase::getKnobValue("InputDataProducer::BatchSize", 64);;
+	_allowSamplingWithReplacement = allowSamplingWithReplacementKnob;
+	_maximumSamplesToRun          = maximumSamplesToRunKnob;
+	_batchSize                    = batchSizeKnob;
 }
 
 InputDataProducer::~InputDataProducer()
@@ -30,6 +36,17 @@ InputDataProducer::~InputDataProducer()
 
 }
 
+std::string InputDataProducer::getState() const
+{
+	// by default, producers start over from the beginning
+	return "";
+}
+
+void InputDataProducer::setState(const std::string& state)
+{
+
+}
+
 void InputDataProducer::setAllowSamplingWithReplacement(bool allowReplacement)
 {
 	_allowSamplingWithReplacement = allowReplacement;
@@ -75,24 +92,48 @@ void InputDataProducer::setModel(const model::Model* model)
 	_model = model;
 }
 
+static const neuralnetwork::NeuralNetwork& getInputNetwork(
+	const model::Model& model)
+{
+	// look networks up by name so that only the one needed is loaded
+	if(model.containsNeuralNetwork("FeatureSelector"))
+	{
+		return model.getNeuralNetwork("FeatureSelector");
+	}
+	
+	return *model.begin();
+}
+
+static const neuralnetwork::NeuralNetwork& getOutputNetwork(
+	const model::Model& model)
+{
+	if(model.containsNeuralNetwork("Classifier"))
+	{
+		return model.getNeuralNetwork("Classifier");
+	}
+	
+	return *model.rbegin();
+}
+
 size_t InputDataProducer::getInputCount() const
 {
-	return _model->begin()->getInputCount();
+	return getInputNetwork(*_model).getInputCount();
 }
 
 size_t InputDataProducer::getInputBlockingFactor() const
 {
-	return _model->begin()->getInputBlockingFactor();
+	return getInputNetwork(*_model).getInputBlockingFactor();
 }
 
 util::StringVector InputDataProducer::getOutputLabels() const
 {
 	util::StringVector labels;
 	
-	for(size_t output = 0;
-		output != _model->rbegin()->getOutputCount(); ++output)
+	auto& network = getOutputNetwork(*_model);
+	
+	for(size_t output = 0; output != network.getOutputCount(); ++output)
 	{
-		labels.push_back(_model->rbegin()->getLabelForOutputNeuron(output));
+		labels.push_back(network.getLabelForOutputNeuron(output));
 	}
 	
 	return labels;
@@ -13,9 +13,17 @@
 
 #include <minerva/util/interface/Knobs.h>
 #include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Profiler.h>
+#include <minerva/util/interface/Metrics.h>
 #include <minerva/util/interface/math.h>
 
+// Standard Library Includes
 #include <map>
+#include <set>
+#include <list>
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
 
 namespace minerva
 {
@@ -23,8 +31,35 @@ namespace minerva
 namespace input
 {
 
+static util::Gauge& remainingSamples = util::Metrics::getGauge(
+	"minerva_producer_remaining_samples", "Samples left in the current epoch.");
+static util::Gauge& openVideoStreams = util::Metrics::getGauge(
+	"minerva_producer_open_video_streams", "Video streams held open for sampling.");
+static util::Gauge& videoDecodeRatio = util::Metrics::getGauge(
+	"minerva_producer_video_frames_decoded_per_frame_used",
+	"Video decode overhead, 1.0 is ideal.");
+
+static util::Knob<bool> seedWithTimeKnob(
+	"InputVisualDataProducer::SeedWithTime", false);
+static util::Knob<bool> stratifiedSamplingKnob(
+	"InputVisualDataProducer::StratifiedSampling", false,
+	"Order each epoch so that every contiguous run holds the labels in "
+	"proportion, batches sampled with replacement are then contiguous runs "
+	"rather than independent draws");
+static util::Knob<size_t> maximumOpenVideoStreamsKnob(
+	"InputVisualDataProducer::MaximumOpenVideoStreams", 32);
+static util::Knob<bool> sequentialVideoDecodeKnob(
+	"InputVisualDataProducer::SequentialVideoDecode", true);
+static util::Knob<bool> sliceInputImagesKnob(
+	"InputVisualDataProducer::SliceInputImagesToFitNetwork", false);
+static util::Knob<bool> sliceOutCenterTileOnlyKnob(
+	"InputVisualDataProducer::SliceOutCenterTileOnly", true);
+
 InputVisualDataProducer::InputVisualDataProducer(const std::string& imageDatabaseFilename)
-: _remainingSamples(0), _colorComponents(3), _initialized(false)
+: _sampleDatabasePath(imageDatabaseFilename), _remainingSamples(0),
+	_imageOrderPosition(0), _isImageOrderStratified(false),
+	_decodedVideoFrames(0), _usedVideoFrames(0),
+	_colorComponents(3), _initialized(false)
 {
 
 }
@@ -39,33 +74,75 @@ typedef video::ImageVector ImageVector;
 typedef video::Video	   Video;
 typedef video::VideoVector VideoVector;
 
-static ImageVector getBatch(ImageVector& images, VideoVector& video,
+typedef std::list<size_t> VideoIndexList;
+typedef std::vector<size_t> IndexVector;
+
+class ImageSampler
+{
+public:
+	ImageSampler(ImageVector& images, IndexVector& order,
+		size_t& position, bool allowReplacement, bool stratified)
+	: images(images), order(order), position(position),
+		allowReplacement(allowReplacement), stratified(stratified)
+	{
+	
+	}
+
+public:
+	ImageVector& images;
+	IndexVector& order;
+	size_t&      position;
+	bool         allowReplacement;
+	bool         stratified;
+
+};
+
+static ImageVector getBatch(ImageSampler& images, VideoVector& video,
 	size_t& remainingSamples, size_t batchSize, std::default_random_engine& generator,
-	bool requiresLabeledData);
+	bool requiresLabeledData, VideoIndexList& openVideoStreams,
+	size_t& decodedFrames, size_t& usedFrames);
 
 InputVisualDataProducer::InputAndReferencePair InputVisualDataProducer::pop()
 {
+	util::ProfilerScope scope("InputVisualDataProducer::pop");
+
 	_initialize();
 	
-	ImageVector batch = getBatch(_images, _videos, _remainingSamples,
-		getBatchSize(), _generator, getRequiresLabeledData());
+	ImageSampler imageSampler(_images, _imageOrder, _imageOrderPosition,
+		getAllowSamplingWithReplacement(), _isImageOrderStratified);
+	
+	ImageVector batch = getBatch(imageSampler, _videos, _remainingSamples,
+		getBatchSize(), _generator, getRequiresLabeledData(), _openVideoStreams,
+		_decodedVideoFrames, _usedVideoFrames);
 	
 	// TODO: specialize this logic
 	auto input = batch.convertToStandardizedMatrix(getInputCount(),
 		getInputBlockingFactor(), _colorComponents);
 	auto reference = batch.getReference(getOutputLabels());
 	
+	remainingSamples.set(_remainingSamples);
+	openVideoStreams.set(_openVideoStreams.size());
+	videoDecodeRatio.set(getVideoFramesDecodedPerFrameUsed());
+	
 	return InputAndReferencePair(std::move(input), std::move(reference));
 }
 
 bool InputVisualDataProducer::empty() const
 {
+	// the database is scanned on the first pop
+	if(!_initialized)
+	{
+		return false;
+	}
+	
 	return _remainingSamples == 0;
 }
 
 void InputVisualDataProducer::reset()
 {
-	_remainingSamples = getUniqueSampleCount();
+	_remainingSamples = std::min(getUniqueSampleCount(), getMaximumSamplesToRun());
+	
+	_startImageEpoch();
 }
 
 size_t InputVisualDataProducer::getUniqueSampleCount() const
@@ -73,18 +150,89 @@ size_t InputVisualDataProducer::getUniqueSampleCount() const
 	return _images.size() + _videos.size();
 }
 
+std::string InputVisualDataProducer::getState() const
+{
+	if(!_initialized)
+	{
+		return "";
+	}
+	
+	std::stringstream stream;
+	
+	stream << _remainingSamples << " " << _imageOrderPosition << " "
+		<< _generator << " " << _imageOrder.size();
+	
+	for(auto index : _imageOrder)
+	{
+		stream << " " << index;
+	}
+	
+	return stream.str();
+}
+
+void InputVisualDataProducer::setState(const std::string& state)
+{
+	if(state.empty())
+	{
+		return;
+	}
+	
+	_initialize();
+	
+	std::stringstream stream(state);
+	
+	size_t remainingSamples = 0;
+	size_t position         = 0;
+	size_t size             = 0;
+	
+	std::default_random_engine generator;
+	
+	// engines read their state without skipping whitespace
+	stream >> remainingSamples >> position >> std::ws >> generator >> size;
+	
+	IndexVector order(size);
+	
+	for(auto& index : order)
+	{
+		stream >> index;
+	}
+	
+	if(stream.fail() || size != _images.size() || position > size)
+	{
+		throw std::runtime_error("Saved producer state does not match "
+			"the database '" + _sampleDatabasePath + "'.");
+	}
+	
+	_remainingSamples   = remainingSamples;
+	_imageOrderPosition = position;
+	_generator          = generator;
+	_imageOrder         = std::move(order);
+	
+	util::log("InputVisualDataProducer") << "Resuming with "
+		<< _remainingSamples << " samples remaining\n";
+}
+
+double InputVisualDataProducer::getVideoFramesDecodedPerFrameUsed() const
+{
+	if(_usedVideoFrames == 0)
+	{
+		return 0.0;
+	}
+	
+	return (_decodedVideoFrames + 0.0) / _usedVideoFrames;
+}
+
 static void parseImageDatabase(ImageVector& images, VideoVector& video,
 	const std::string& path, bool requiresLabeledData, size_t inputs, size_t colors);
 
 void InputVisualDataProducer::_initialize()
 {
-	if (!_initialized)
+	if(_initialized)
 	{
 		return;
 	}
 	
-	bool shouldSeedWithTime = util::KnobDatabase::getKnobValue(
-		"InputVisualDataProducer::SeedWithTime", false);
+	bool shouldSeedWithTime = seedWithTimeKnob;
 	
 	if(shouldSeedWithTime)
 	{
@@ -103,6 +251,38 @@ void InputVisualDataProducer::_initialize()
 	_initialized = true;
 }
 
+static IndexVector getStratifiedOrder(const ImageVector& images,
+	std::default_random_engine& generator);
+
+void InputVisualDataProducer::_startImageEpoch()
+{
+	bool shouldStratify = stratifiedSamplingKnob;
+	
+	_isImageOrderStratified = shouldStratify;
+	
+	if(shouldStratify)
+	{
+		_imageOrder = getStratifiedOrder(_images, _generator);
+	}
+	else
+	{
+		_imageOrder.resize(_images.size());
+		
+		for(size_t i = 0; i < _imageOrder.size(); ++i)
+		{
+			_imageOrder[i] = i;
+		}
+		
+		std::shuffle(_imageOrder.begin(), _imageOrder.end(), _generator);
+	}
+	
+	_imageOrderPosition = 0;
+	
+	util::log("InputVisualDataProducer") << "Starting a new epoch over "
+		<< _imageOrder.size() << " images" << (shouldStratify ? " (stratified)" : "")
+		<< "\n";
+}
+
 static void sliceOutTilesToFitTheModel(ImageVector& images,
 	size_t inputCount, size_t colorComponents);
 	
@@ -166,13 +346,16 @@ static void parseImageDatabase(ImageVector& images, VideoVector& videos,
 }
 
 static void getVideoBatch(ImageVector& batch, VideoVector& videos,
-	size_t& remainingSamples, size_t batchSize, std::default_random_engine& generator, bool requiresLabeledData);
-static void getImageBatch(ImageVector& batch, ImageVector& images,
+	size_t& remainingSamples, size_t batchSize, std::default_random_engine& generator,
+	bool requiresLabeledData, VideoIndexList& openVideoStreams,
+	size_t& decodedFrames, size_t& usedFrames);
+static void getImageBatch(ImageVector& batch, ImageSampler& images,
 	size_t& remainingSamples, size_t batchSize, std::default_random_engine& generator);
 
-static ImageVector getBatch(ImageVector& images, VideoVector& videos,
+static ImageVector getBatch(ImageSampler& images, VideoVector& videos,
 	size_t& remainingSamples, size_t batchSize, std::default_random_engine& generator,
-	bool requiresLabeledData)
+	bool requiresLabeledData, VideoIndexList& openVideoStreams,
+	size_t& decodedFrames, size_t& usedFrames)
 {
 	std::uniform_int_distribution<size_t> distribution(0, batchSize);
 
@@ -181,7 +364,8 @@ static ImageVector getBatch(ImageVector& images, VideoVector& videos,
 
 	ImageVector batch;
 	
-	getVideoBatch(batch, videos, remainingSamples, videoBatchSize, generator, requiresLabeledData);
+	getVideoBatch(batch, videos, remainingSamples, videoBatchSize, generator,
+		requiresLabeledData, openVideoStreams, decodedFrames, usedFrames);
 	getImageBatch(batch, images, remainingSamples, imageBatchSize, generator);
 
 	return batch;
@@ -193,16 +377,9 @@ static VideoAndFrameVector pickRandomFrames(VideoVector& videos,
 	unsigned int frameCount, bool requiresLabeledData,
 	std::default_random_engine& generator);
 
-static void getVideoBatch(ImageVector& batch, VideoVector& videos,
-	size_t& remainingSamples, size_t batchSize,
-	std::default_random_engine& generator, bool requiresLabeledData)
+static void getFramesBySeeking(ImageVector& batch, VideoVector& videos,
+	const VideoAndFrameVector& frames)
 {
-	util::log("InputVisualDataProducer") << "Filling video batch\n";
-
-	size_t frameCount = std::min(batchSize, remainingSamples);
-	
-	auto frames = pickRandomFrames(videos, frameCount, requiresLabeledData, generator);
-
 	for(auto frame : frames)
 	{
 		unsigned int video  = frame.first;
@@ -213,6 +390,128 @@ static void getVideoBatch(ImageVector& batch, VideoVector& videos,
 		
 		batch.push_back(videos[video].getSpecificFrame(offset));
 	}
+}
+
+static void getFramesBySequentialDecode(ImageVector& batch, VideoVector& videos,
+	const VideoAndFrameVector& frames)
+{
+	typedef std::map<unsigned int, std::set<unsigned int>> VideoToFrameSetMap;
+	typedef std::pair<unsigned int, unsigned int> VideoAndFrame;
+	typedef std::map<VideoAndFrame, Image> FrameToImageMap;
+	
+	// group the requested frames by video, in increasing frame order
+	VideoToFrameSetMap framesPerVideo;
+	
+	for(auto frame : frames)
+	{
+		framesPerVideo[frame.first].insert(frame.second);
+	}
+	
+	// decode each video in a single forward pass
+	FrameToImageMap decodedImages;
+	
+	for(auto& videoAndFrames : framesPerVideo)
+	{
+		auto& video = videos[videoAndFrames.first];
+		
+		Video::FrameVector sortedFrames(videoAndFrames.second.begin(),
+			videoAndFrames.second.end());
+		
+		util::log("InputVisualDataProducer") << " Getting " << sortedFrames.size()
+			<< " frames from video " << video.path() << "\n"; 
+		
+		auto images = video.getSpecificFrames(sortedFrames);
+		
+		for(size_t i = 0; i < images.size(); ++i)
+		{
+			decodedImages.insert(std::make_pair(
+				VideoAndFrame(videoAndFrames.first, sortedFrames[i]),
+				std::move(images[i])));
+		}
+	}
+	
+	// restore the originally sampled order
+	for(auto frame : frames)
+	{
+		batch.push_back(decodedImages[frame]);
+	}
+}
+
+static void updateOpenVideoStreams(VideoIndexList& openVideoStreams,
+	VideoVector& videos, const VideoAndFrameVector& frames)
+{
+	size_t maximumOpenStreams = maximumOpenVideoStreamsKnob;
+	
+	// move the most recently used videos to the front
+	for(auto frame : frames)
+	{
+		auto existing = std::find(openVideoStreams.begin(),
+			openVideoStreams.end(), frame.first);
+		
+		if(existing != openVideoStreams.end())
+		{
+			openVideoStreams.erase(existing);
+		}
+		
+		openVideoStreams.push_front(frame.first);
+	}
+	
+	// close the least recently used streams
+	while(openVideoStreams.size() > maximumOpenStreams)
+	{
+		videos[openVideoStreams.back()].close();
+		
+		openVideoStreams.pop_back();
+	}
+}
+
+static size_t getTotalDecodedFrames(const VideoVector& videos)
+{
+	size_t frames = 0;
+	
+	for(auto& video : videos)
+	{
+		frames += video.getDecodedFrameCount();
+	}
+	
+	return frames;
+}
+
+static void getVideoBatch(ImageVector& batch, VideoVector& videos,
+	size_t& remainingSamples, size_t batchSize,
+	std::default_random_engine& generator, bool requiresLabeledData,
+	VideoIndexList& openVideoStreams, size_t& decodedFrames, size_t& usedFrames)
+{
+	util::log("InputVisualDataProducer") << "Filling video batch\n";
+
+	size_t frameCount = std::min(batchSize, remainingSamples);
+	
+	auto frames = pickRandomFrames(videos, frameCount, requiresLabeledData, generator);
+
+	bool useSequentialDecode = sequentialVideoDecodeKnob;
+	
+	size_t decodedFramesBefore = getTotalDecodedFrames(videos);
+	
+	if(useSequentialDecode)
+	{
+		getFramesBySequentialDecode(batch, videos, frames);
+	}
+	else
+	{
+		getFramesBySeeking(batch, videos, frames);
+	}
+	
+	size_t decodedFramesInBatch = getTotalDecodedFrames(videos) - decodedFramesBefore;
+	
+	decodedFrames += decodedFramesInBatch;
+	usedFrames    += frames.size();
+	
+	util::log("InputVisualDataProducer") << " Decoded " << decodedFramesInBatch
+		<< " video frames for " << frames.size() << " used frames ("
+		<< ((decodedFrames + 0.0) / std::max(usedFrames, (size_t)1))
+		<< " decoded per used overall)\n";
+	
+	updateOpenVideoStreams(openVideoStreams, videos, frames);
 	
 	remainingSamples -= frames.size();
 }
@@ -286,19 +585,48 @@ static VideoAndFrameVector pickRandomFrames(VideoVector& videos,
 	return positions;
 }
 
-typedef std::vector<unsigned int> IntVector;
-
-IntVector getRandomOrder(unsigned int size, std::default_random_engine& generator)
+static IndexVector getStratifiedOrder(const ImageVector& images,
+	std::default_random_engine& generator)
 {
-	IntVector order(size);
-
-	for(unsigned int i = 0; i < size; ++i)
+	typedef std::map<std::string, IndexVector> LabelToIndexMap;
+	typedef std::pair<double, size_t> KeyAndIndex;
+	typedef std::vector<KeyAndIndex> KeyAndIndexVector;
+	
+	LabelToIndexMap imagesPerLabel;
+	
+	for(size_t i = 0; i < images.size(); ++i)
 	{
-		order[i] = i;
+		imagesPerLabel[images[i].label()].push_back(i);
+	}
+	
+	// spread each label evenly over the epoch, so that every contiguous
+	//  batch holds the labels in proportion to the whole database
+	std::uniform_real_distribution<double> jitter(0.0, 1.0);
+	
+	KeyAndIndexVector keys;
+	
+	for(auto& labelAndIndices : imagesPerLabel)
+	{
+		auto& indices = labelAndIndices.second;
+		
+		std::shuffle(indices.begin(), indices.end(), generator);
+		
+		for(size_t rank = 0; rank < indices.size(); ++rank)
+		{
+			keys.push_back(KeyAndIndex((rank + jitter(generator)) / indices.size(),
+				indices[rank]));
+		}
+	}
+	
+	std::sort(keys.begin(), keys.end());
+	
+	IndexVector order;
+	
+	for(auto& key : keys)
+	{
+		order.push_back(key.second);
 	}
 	
-	std::shuffle(order.begin(), order.end(), generator);	
-
 	return order;
 }
 
@@ -389,16 +717,14 @@ static void sliceOutAllTiles(ImageVector& images, size_t inputCount, size_t colo
 static void sliceOutTilesToFitTheModel(ImageVector& images,
 	size_t inputCount, size_t colorComponents)
 {
-	bool shouldSlice = util::KnobDatabase::getKnobValue(
-		"InputVisualDataProducer::SliceInputImagesToFitNetwork", false);
+	bool shouldSlice = sliceInputImagesKnob;
 
 	if(!shouldSlice)
 	{
 		return;
 	}
 
-	bool shouldSliceCenter = util::KnobDatabase::getKnobValue(
-		"InputVisualDataProducer::SliceOutCenterTileOnly", true);
+	bool shouldSliceCenter = sliceOutCenterTileOnlyKnob;
 	
 	if(shouldSliceCenter)
 	{
@@ -411,21 +737,62 @@ static void sliceOutTilesToFitTheModel(ImageVector& images,
 }
 
 
-static void getImageBatch(ImageVector& batch, ImageVector& images,
+static void getImageBatch(ImageVector& batch, ImageSampler& sampler,
 	size_t& remainingSamples, size_t maxBatchSize, std::default_random_engine& generator)
 {
-	util::log("InputVisualDataProducer") << "Collecting image batche\n";
+	util::log("InputVisualDataProducer") << "Collecting image batch\n";
 
-	// shuffle the inputs
-	auto randomImageOrder = getRandomOrder(images.size(), generator);
+	if(sampler.order.empty())
+	{
+		return;
+	}
 
-	auto batchSize = std::min(images.size(),
-		(size_t)maxBatchSize);
+	auto batchSize = std::min(maxBatchSize, remainingSamples);
 
-	for(size_t i = 0; i < batchSize; ++i)
+	if(sampler.allowReplacement && sampler.stratified)
+	{
+		// a contiguous run of the stratified order from a random offset,
+		//  which keeps the labels in proportion; images that are close in
+		//  the order tend to share batches
+		std::uniform_int_distribution<size_t> distribution(0, sampler.order.size() - 1);
+		
+		size_t offset = distribution(generator);
+		
+		for(size_t i = 0; i < batchSize; ++i)
+		{
+			batch.push_back(sampler.images[sampler.order[(offset + i) % sampler.order.size()]]);
+			batch.back().load();
+		}
+	}
+	else if(sampler.allowReplacement)
 	{
-		batch.push_back(images[randomImageOrder[i]]);
-		batch.back().load();
+		// a partial Fisher-Yates shuffle draws distinct images for each
+		//  batch, independently of every other batch
+		batchSize = std::min(batchSize, sampler.order.size());
+		
+		for(size_t i = 0; i < batchSize; ++i)
+		{
+			std::uniform_int_distribution<size_t> distribution(i,
+				sampler.order.size() - 1);
+			
+			std::swap(sampler.order[i], sampler.order[distribution(generator)]);
+			
+			batch.push_back(sampler.images[sampler.order[i]]);
+			batch.back().load();
+		}
+	}
+	else
+	{
+		// hand out disjoint batches from the epoch order
+		batchSize = std::min(batchSize, sampler.order.size() - sampler.position);
+		
+		for(size_t i = 0; i < batchSize; ++i)
+		{
+			batch.push_back(sampler.images[sampler.order[sampler.position + i]]);
+			batch.back().load();
+		}
+		
+		sampler.position += batchSize;
 	}
 
 	remainingSamples -= batchSize;
@@ -15,6 +15,7 @@ namespace minerva { namespace model  { class Model;  } }
 
 // Standard Library Includes
 #include <utility>
+#include <string>
 
 namespace minerva
 {
@@ -50,6 +51,12 @@ public:
 	
 	/*! \brief Get the total number of unique samples that can be produced. */
 	virtual size_t getUniqueSampleCount() const = 0;
+
+public:
+	/*! \brief Save the position in the stream, so that a run can resume. */
+	virtual std::string getState() const;
+	/*! \brief Continue from a position saved by getState(). */
+	virtual void setState(const std::string& state);
 	
 public:
 	void setAllowSamplingWithReplacement(bool allowReplacement);
@@ -12,6 +12,11 @@
 #include <minerva/video/interface/ImageVector.h>
 #include <minerva/video/interface/Video.h>
 
+// Standard Library Includes
+#include <list>
+#include <vector>
+#include <random>
+
 namespace minerva
 {
 
@@ -43,8 +48,23 @@ public:
 	/*! \brief Get the total number of unique samples that can be produced. */
 	virtual size_t getUniqueSampleCount() const;
 
+public:
+	/*! \brief Save the epoch order, position and random state. */
+	virtual std::string getState() const;
+	/*! \brief Continue from a position saved by getState(). */
+	virtual void setState(const std::string& state);
+
+public:
+	/*! \brief Get the number of video frames decoded for each frame used. */
+	double getVideoFramesDecodedPerFrameUsed() const;
+
 private:
 	void _initialize();
+	void _startImageEpoch();
+
+private:
+	typedef std::list<size_t> VideoIndexList;
+	typedef std::vector<size_t> IndexVector;
 
 private:
 	video::VideoVector _videos;
@@ -56,6 +76,18 @@ private:
 private:
 	size_t _remainingSamples;
 
+private:
+	IndexVector _imageOrder;
+	size_t      _imageOrderPosition;
+	bool        _isImageOrderStratified;
+
+private:
+	VideoIndexList _openVideoStreams;
+
+private:
+	size_t _decodedVideoFrames;
+	size_t _usedVideoFrames;
+
 private:
 	size_t _colorComponents;
 
@@ -10,6 +10,7 @@
 #include <minerva/matrix/interface/Matrix.h>
 
 #include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Profiler.h>
 
 // Standard Library Includes
 #include <cassert>
@@ -217,21 +218,38 @@ void BlockSparseMatrix::setRowSparse()
 BlockSparseMatrix BlockSparseMatrix::multiply(
 	const BlockSparseMatrix& m) const
 {
+	util::ProfilerScope scope("BlockSparseMatrix::multiply",
+		2 * rows() * columnsPerBlock() * m.columnsPerBlock());
+
 	return BlockSparseMatrix(_implementation->multiply(m._implementation));
 }
 
 BlockSparseMatrix BlockSparseMatrix::convolutionalMultiply(
 	const BlockSparseMatrix& m, size_t step) const
 {
-	return BlockSparseMatrix(_implementation->convolutionalMultiply(
+	util::ProfilerScope scope("BlockSparseMatrix::convolutionalMultiply");
+
+	BlockSparseMatrix result(_implementation->convolutionalMultiply(
 		m._implementation, step));
+
+	scope.addFloatingPointOperations(
+		2 * result.rows() * result.columns() * m.rowsPerBlock());
+
+	return result;
 }
 
 BlockSparseMatrix BlockSparseMatrix::reverseConvolutionalMultiply(
 	const BlockSparseMatrix& m) const
 {
-	return BlockSparseMatrix(_implementation->reverseConvolutionalMultiply(
+	util::ProfilerScope scope("BlockSparseMatrix::reverseConvolutionalMultiply");
+
+	BlockSparseMatrix result(_implementation->reverseConvolutionalMultiply(
 		m._implementation));
+
+	scope.addFloatingPointOperations(
+		2 * result.rows() * result.columns() * m.columnsPerBlock());
+
+	return result;
 }
 
 BlockSparseMatrix BlockSparseMatrix::multiply(float f) const
@@ -331,6 +349,27 @@ void BlockSparseMatrix::sigmoidDerivativeSelf()
 	_implementation->sigmoidDerivativeSelf();
 }
 
+void BlockSparseMatrix::activationDerivativeSelf(ActivationFunction::Type type)
+{
+	_implementation->activationDerivativeSelf(type);
+}
+
+void BlockSparseMatrix::addBiasAndActivateSelf(const BlockSparseMatrix& bias,
+	ActivationFunction::Type type)
+{
+	_implementation->addBiasAndActivateSelf(bias._implementation, type, nullptr);
+}
+
+void BlockSparseMatrix::addBiasAndActivateSelf(const BlockSparseMatrix& bias,
+	ActivationFunction::Type type, BlockSparseMatrix& derivative)
+{
+	derivative = BlockSparseMatrix(blocks(), rowsPerBlock(), columnsPerBlock(),
+		isRowSparse());
+	
+	_implementation->addBiasAndActivateSelf(bias._implementation, type,
+		derivative._implementation);
+}
+
 void BlockSparseMatrix::minSelf(float value)
 {
 	_implementation->minSelf(value);
@@ -13,6 +13,7 @@
 
 #include <minerva/util/interface/Knobs.h>
 #include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Metrics.h>
 
 // Standard Library Includes
 #include <map>
@@ -24,6 +25,11 @@ namespace minerva
 namespace matrix
 {
 
+static util::Counter& cacheHits = util::Metrics::getCounter(
+	"minerva_cuda_cache_hits_total", "Device copies of matrices that were reused.");
+static util::Counter& cacheMisses = util::Metrics::getCounter(
+	"minerva_cuda_cache_misses_total", "Matrices copied to the device.");
+
 class PoolAllocation
 {
 public:
@@ -280,6 +286,8 @@ public:
 			allocation = createNewAllocation(matrix);
 			
 			cacheAllocation(matrix, allocation);
+			
+			cacheMisses.increment();
 		}
 		else
 		{
@@ -290,6 +298,12 @@ public:
 				cacheAllocation(matrix, allocation);
 				
 				allocation->hostDirty = false;
+				
+				cacheMisses.increment();
+			}
+			else
+			{
+				cacheHits.increment();
 			}
 		}
 	
@@ -311,6 +325,8 @@ public:
 			allocation = createNewAllocation(matrix);
 			
 			cacheAllocation(matrix, allocation);
+			
+			cacheMisses.increment();
 		}
 		else
 		{
@@ -321,6 +337,12 @@ public:
 				cacheAllocation(matrix, allocation);
 				
 				allocation->hostDirty = false;
+				
+				cacheMisses.increment();
+			}
+			else
+			{
+				cacheHits.increment();
 			}
 		}
 	
@@ -618,6 +618,53 @@ void CudaBlockSparseMatrix::sigmoidDerivativeSelf()
 	CudaBlockSparseCache::release(this);
 }
 
+void CudaBlockSparseMatrix::activationDerivativeSelf(ActivationFunction::Type type)
+{
+	auto devicePointer = CudaBlockSparseCache::acquire(this);
+	
+	CudaSparseMatrixLibrary::activationDerivativeSelf(devicePointer, type, size());
+	
+	CudaBlockSparseCache::release(this);
+}
+
+void CudaBlockSparseMatrix::addBiasAndActivateSelf(const Value* bias,
+	ActivationFunction::Type type, Value* derivative)
+{
+	_performTransposeIfNecessary();
+	_performTransposeIfNecessary(bias);
+	
+	auto devicePointer = CudaBlockSparseCache::acquire(this);
+	
+	float* biasPointer       = nullptr;
+	float* derivativePointer = nullptr;
+	
+	if(!bias->empty())
+	{
+		biasPointer = CudaBlockSparseCache::acquireReadOnly(bias);
+	}
+	
+	if(derivative != nullptr)
+	{
+		derivativePointer = CudaBlockSparseCache::acquireClobber(derivative);
+	}
+	
+	CudaSparseMatrixLibrary::addBiasAndActivate(devicePointer, derivativePointer,
+		biasPointer, type, blocks(), bias->blocks(), rowsPerBlock(),
+		columnsPerBlock());
+	
+	CudaBlockSparseCache::release(this);
+	
+	if(!bias->empty())
+	{
+		CudaBlockSparseCache::release(bias);
+	}
+	
+	if(derivative != nullptr)
+	{
+		CudaBlockSparseCache::release(derivative);
+	}
+}
+
 void CudaBlockSparseMatrix::minSelf(float value)
 {
 	auto devicePointer = CudaBlockSparseCache::acquire(this);
@@ -499,6 +499,12 @@ void CudaSparseMatrixLibrary::convolutionalAddBroadcastRow(float* result, const
 	launchKernel("convolutionalAddBroadcastRow", result, left, right, leftBlocks, rightBlocks, rows, columns);
 }
 
+void CudaSparseMatrixLibrary::addBiasAndActivate(float* result, float* derivative, const float* bias,
+	size_t activation, size_t resultBlocks, size_t biasBlocks, size_t rows, size_t columns)
+{
+	launchKernel("addBiasAndActivate", result, derivative, bias, activation, resultBlocks, biasBlocks, rows, columns);
+}
+
 void CudaSparseMatrixLibrary::multiply(float* result, const float* left, float value, size_t size)
 {
 	launchKernel("multiplyFloat", result, left, value, size);
@@ -640,6 +646,11 @@ void CudaSparseMatrixLibrary::sigmoidDerivativeSelf(float* result, size_t size)
 	launchKernel("sigmoidDerivativeSelf", result, size);
 }
 
+void CudaSparseMatrixLibrary::activationDerivativeSelf(float* result, size_t activation, size_t size)
+{
+	launchKernel("activationDerivativeSelf", result, activation, size);
+}
+
 void CudaSparseMatrixLibrary::maxSelf(float* result, float value, size_t size)
 {
 	launchKernel("minSelf", result, value, size);
@@ -4865,7 +4865,621 @@ static const char ptx[] = {
   0x42, 0x34, 0x31, 0x5f, 0x31, 0x3b, 0x0a, 0x0a, 0x42, 0x42, 0x34, 0x31,
   0x5f, 0x32, 0x3a, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x20, 0x31, 0x20,
   0x36, 0x34, 0x34, 0x20, 0x32, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x3b, 0x0a,
-  0x7d, 0x0a, 0x0a, 0x0a
+  0x7d, 0x0a, 0x0a, 0x0a, 0x2e, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65,
+  0x20, 0x2e, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x61, 0x63, 0x74, 0x69,
+  0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61,
+  0x74, 0x69, 0x76, 0x65, 0x53, 0x65, 0x6c, 0x66, 0x28, 0x0a, 0x09, 0x2e,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x61,
+  0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x44, 0x65, 0x72,
+  0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x53, 0x65, 0x6c, 0x66, 0x5f,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x5f, 0x30, 0x2c, 0x0a, 0x09, 0x2e, 0x70,
+  0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x61, 0x63,
+  0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x44, 0x65, 0x72, 0x69,
+  0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x53, 0x65, 0x6c, 0x66, 0x5f, 0x70,
+  0x61, 0x72, 0x61, 0x6d, 0x5f, 0x31, 0x2c, 0x0a, 0x09, 0x2e, 0x70, 0x61,
+  0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x61, 0x63, 0x74,
+  0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x44, 0x65, 0x72, 0x69, 0x76,
+  0x61, 0x74, 0x69, 0x76, 0x65, 0x53, 0x65, 0x6c, 0x66, 0x5f, 0x70, 0x61,
+  0x72, 0x61, 0x6d, 0x5f, 0x32, 0x0a, 0x29, 0x0a, 0x7b, 0x0a, 0x09, 0x2e,
+  0x72, 0x65, 0x67, 0x20, 0x2e, 0x70, 0x72, 0x65, 0x64, 0x20, 0x09, 0x25,
+  0x70, 0x3c, 0x31, 0x32, 0x3e, 0x3b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67,
+  0x20, 0x2e, 0x62, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x3c, 0x37, 0x3e,
+  0x3b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x66, 0x33, 0x32,
+  0x20, 0x09, 0x25, 0x66, 0x3c, 0x31, 0x34, 0x3e, 0x3b, 0x0a, 0x09, 0x2e,
+  0x72, 0x65, 0x67, 0x20, 0x2e, 0x62, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72,
+  0x64, 0x3c, 0x31, 0x36, 0x3e, 0x3b, 0x0a, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25,
+  0x72, 0x64, 0x31, 0x31, 0x2c, 0x20, 0x5b, 0x61, 0x63, 0x74, 0x69, 0x76,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74,
+  0x69, 0x76, 0x65, 0x53, 0x65, 0x6c, 0x66, 0x5f, 0x70, 0x61, 0x72, 0x61,
+  0x6d, 0x5f, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x75,
+  0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x2c, 0x20, 0x25, 0x6e, 0x74,
+  0x69, 0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x75,
+  0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x2c, 0x20, 0x25, 0x63, 0x74,
+  0x61, 0x69, 0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e,
+  0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x2c, 0x20, 0x25, 0x74,
+  0x69, 0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x6c,
+  0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x36, 0x2c, 0x20,
+  0x25, 0x72, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x2c, 0x20, 0x25, 0x72,
+  0x34, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x36, 0x34, 0x2e,
+  0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x64, 0x31, 0x35, 0x2c, 0x20,
+  0x25, 0x72, 0x36, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x67,
+  0x65, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x31, 0x2c, 0x20,
+  0x25, 0x72, 0x64, 0x31, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x31, 0x31,
+  0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x31, 0x20, 0x62, 0x72, 0x61, 0x20,
+  0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x33, 0x3b, 0x0a, 0x09, 0x6c,
+  0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x36, 0x34, 0x20,
+  0x09, 0x25, 0x72, 0x64, 0x31, 0x30, 0x2c, 0x20, 0x5b, 0x61, 0x63, 0x74,
+  0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x44, 0x65, 0x72, 0x69, 0x76,
+  0x61, 0x74, 0x69, 0x76, 0x65, 0x53, 0x65, 0x6c, 0x66, 0x5f, 0x70, 0x61,
+  0x72, 0x61, 0x6d, 0x5f, 0x31, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25,
+  0x72, 0x64, 0x31, 0x32, 0x2c, 0x20, 0x5b, 0x61, 0x63, 0x74, 0x69, 0x76,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74,
+  0x69, 0x76, 0x65, 0x53, 0x65, 0x6c, 0x66, 0x5f, 0x70, 0x61, 0x72, 0x61,
+  0x6d, 0x5f, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x61, 0x2e,
+  0x74, 0x6f, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x75, 0x36,
+  0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x64,
+  0x31, 0x32, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x75, 0x33, 0x32,
+  0x20, 0x09, 0x25, 0x72, 0x31, 0x2c, 0x20, 0x25, 0x6e, 0x63, 0x74, 0x61,
+  0x69, 0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c,
+  0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35, 0x2c, 0x20,
+  0x25, 0x72, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x3b, 0x0a, 0x09, 0x63,
+  0x76, 0x74, 0x2e, 0x75, 0x36, 0x34, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09,
+  0x25, 0x72, 0x64, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x35, 0x3b, 0x0a, 0x09,
+  0x73, 0x68, 0x6c, 0x2e, 0x62, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64,
+  0x31, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x31, 0x35, 0x2c, 0x20, 0x32,
+  0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09,
+  0x25, 0x72, 0x64, 0x31, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x31, 0x2c,
+  0x20, 0x25, 0x72, 0x64, 0x31, 0x33, 0x3b, 0x0a, 0x09, 0x73, 0x68, 0x6c,
+  0x2e, 0x62, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x35, 0x2c, 0x20,
+  0x25, 0x72, 0x64, 0x32, 0x2c, 0x20, 0x32, 0x3b, 0x0a, 0x09, 0x73, 0x65,
+  0x74, 0x70, 0x2e, 0x67, 0x74, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25,
+  0x70, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x31, 0x30, 0x2c, 0x20, 0x32,
+  0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x65, 0x71, 0x2e, 0x73,
+  0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x64,
+  0x31, 0x30, 0x2c, 0x20, 0x31, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70,
+  0x2e, 0x65, 0x71, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x36,
+  0x2c, 0x20, 0x25, 0x72, 0x64, 0x31, 0x30, 0x2c, 0x20, 0x32, 0x3b, 0x0a,
+  0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
+  0x31, 0x31, 0x2c, 0x20, 0x30, 0x66, 0x33, 0x46, 0x38, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x65, 0x71,
+  0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x33, 0x2c, 0x20, 0x25,
+  0x72, 0x64, 0x31, 0x30, 0x2c, 0x20, 0x33, 0x3b, 0x0a, 0x09, 0x62, 0x72,
+  0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x32, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x31, 0x3a, 0x0a,
+  0x09, 0x73, 0x75, 0x62, 0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20,
+  0x09, 0x25, 0x66, 0x31, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x31, 0x2c,
+  0x20, 0x25, 0x66, 0x31, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x72,
+  0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x33, 0x2c,
+  0x20, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x32, 0x3b, 0x0a,
+  0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x32, 0x3a, 0x0a, 0x09, 0x73, 0x74,
+  0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20,
+  0x09, 0x5b, 0x25, 0x72, 0x64, 0x31, 0x34, 0x5d, 0x2c, 0x20, 0x25, 0x66,
+  0x31, 0x33, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x36, 0x34,
+  0x20, 0x09, 0x25, 0x72, 0x64, 0x31, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x64,
+  0x31, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x32, 0x3b, 0x0a, 0x09, 0x61,
+  0x64, 0x64, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x31,
+  0x34, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x31, 0x34, 0x2c, 0x20, 0x25, 0x72,
+  0x64, 0x35, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x6c, 0x74,
+  0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x31, 0x31, 0x2c, 0x20,
+  0x25, 0x72, 0x64, 0x31, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x31, 0x31,
+  0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x31, 0x31, 0x20, 0x62, 0x72, 0x61,
+  0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x3b, 0x0a, 0x09, 0x62,
+  0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x31, 0x33, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x3a,
+  0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e,
+  0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x5b, 0x25,
+  0x72, 0x64, 0x31, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x32,
+  0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x36,
+  0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x35, 0x20, 0x62, 0x72, 0x61, 0x20,
+  0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x39, 0x3b, 0x0a, 0x09, 0x40, 0x25,
+  0x70, 0x36, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x35, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69,
+  0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x31, 0x3b, 0x0a, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x35, 0x3a, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70,
+  0x2e, 0x67, 0x74, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x39,
+  0x2c, 0x20, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x6c, 0x70,
+  0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x33, 0x2c, 0x20,
+  0x30, 0x66, 0x33, 0x46, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x20,
+  0x30, 0x66, 0x33, 0x43, 0x32, 0x33, 0x44, 0x37, 0x30, 0x41, 0x2c, 0x20,
+  0x25, 0x70, 0x39, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e,
+  0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x32, 0x3b, 0x0a,
+  0x4c, 0x42, 0x42, 0x30, 0x5f, 0x36, 0x3a, 0x0a, 0x09, 0x40, 0x25, 0x70,
+  0x33, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x31, 0x30, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x65, 0x71,
+  0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x34, 0x2c, 0x20, 0x25,
+  0x72, 0x64, 0x31, 0x30, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x40, 0x25,
+  0x70, 0x34, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x38, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69,
+  0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x31, 0x3b, 0x0a, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x38, 0x3a, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e,
+  0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x2c,
+  0x20, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x3b, 0x0a, 0x09,
+  0x73, 0x75, 0x62, 0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
+  0x25, 0x66, 0x31, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x31, 0x2c, 0x20,
+  0x25, 0x66, 0x38, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e,
+  0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x32, 0x3b, 0x0a,
+  0x4c, 0x42, 0x42, 0x30, 0x5f, 0x39, 0x3a, 0x0a, 0x09, 0x73, 0x65, 0x74,
+  0x70, 0x2e, 0x67, 0x74, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70,
+  0x31, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x30, 0x66, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x73, 0x65,
+  0x6c, 0x70, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x33,
+  0x2c, 0x20, 0x30, 0x66, 0x33, 0x46, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x2c, 0x20, 0x25, 0x70, 0x31, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61,
+  0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31,
+  0x32, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x30, 0x3a, 0x0a,
+  0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x67, 0x74, 0x2e, 0x66, 0x33, 0x32,
+  0x20, 0x09, 0x25, 0x70, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x2c, 0x20,
+  0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a,
+  0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x6c, 0x74, 0x2e, 0x66, 0x33, 0x32,
+  0x20, 0x09, 0x25, 0x70, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x2c, 0x20,
+  0x30, 0x66, 0x33, 0x46, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a,
+  0x09, 0x73, 0x65, 0x6c, 0x70, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
+  0x66, 0x31, 0x30, 0x2c, 0x20, 0x30, 0x66, 0x33, 0x45, 0x34, 0x43, 0x43,
+  0x43, 0x43, 0x44, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x2c, 0x20, 0x25, 0x70, 0x38, 0x3b, 0x0a, 0x09, 0x73,
+  0x65, 0x6c, 0x70, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31,
+  0x33, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x30, 0x2c, 0x20, 0x30, 0x66, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x20, 0x25, 0x70, 0x37,
+  0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09,
+  0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x32, 0x3b, 0x0a, 0x4c, 0x42, 0x42,
+  0x30, 0x5f, 0x31, 0x33, 0x3a, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x3b, 0x0a,
+  0x7d, 0x0a, 0x0a, 0x0a, 0x2e, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65,
+  0x20, 0x2e, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x61, 0x64, 0x64, 0x42,
+  0x69, 0x61, 0x73, 0x41, 0x6e, 0x64, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61,
+  0x74, 0x65, 0x28, 0x0a, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20,
+  0x2e, 0x75, 0x36, 0x34, 0x20, 0x61, 0x64, 0x64, 0x42, 0x69, 0x61, 0x73,
+  0x41, 0x6e, 0x64, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x5f,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x5f, 0x30, 0x2c, 0x0a, 0x09, 0x2e, 0x70,
+  0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x61, 0x64,
+  0x64, 0x42, 0x69, 0x61, 0x73, 0x41, 0x6e, 0x64, 0x41, 0x63, 0x74, 0x69,
+  0x76, 0x61, 0x74, 0x65, 0x5f, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x5f, 0x31,
+  0x2c, 0x0a, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75,
+  0x36, 0x34, 0x20, 0x61, 0x64, 0x64, 0x42, 0x69, 0x61, 0x73, 0x41, 0x6e,
+  0x64, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x5f, 0x70, 0x61,
+  0x72, 0x61, 0x6d, 0x5f, 0x32, 0x2c, 0x0a, 0x09, 0x2e, 0x70, 0x61, 0x72,
+  0x61, 0x6d, 0x20, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x61, 0x64, 0x64, 0x42,
+  0x69, 0x61, 0x73, 0x41, 0x6e, 0x64, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61,
+  0x74, 0x65, 0x5f, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x5f, 0x33, 0x2c, 0x0a,
+  0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x36, 0x34,
+  0x20, 0x61, 0x64, 0x64, 0x42, 0x69, 0x61, 0x73, 0x41, 0x6e, 0x64, 0x41,
+  0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x5f, 0x70, 0x61, 0x72, 0x61,
+  0x6d, 0x5f, 0x34, 0x2c, 0x0a, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d,
+  0x20, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x61, 0x64, 0x64, 0x42, 0x69, 0x61,
+  0x73, 0x41, 0x6e, 0x64, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65,
+  0x5f, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x5f, 0x35, 0x2c, 0x0a, 0x09, 0x2e,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x61,
+  0x64, 0x64, 0x42, 0x69, 0x61, 0x73, 0x41, 0x6e, 0x64, 0x41, 0x63, 0x74,
+  0x69, 0x76, 0x61, 0x74, 0x65, 0x5f, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x5f,
+  0x36, 0x2c, 0x0a, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e,
+  0x75, 0x36, 0x34, 0x20, 0x61, 0x64, 0x64, 0x42, 0x69, 0x61, 0x73, 0x41,
+  0x6e, 0x64, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x5f, 0x70,
+  0x61, 0x72, 0x61, 0x6d, 0x5f, 0x37, 0x0a, 0x29, 0x0a, 0x7b, 0x0a, 0x09,
+  0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x70, 0x72, 0x65, 0x64, 0x20, 0x09,
+  0x25, 0x70, 0x3c, 0x32, 0x39, 0x3e, 0x3b, 0x0a, 0x09, 0x2e, 0x72, 0x65,
+  0x67, 0x20, 0x2e, 0x62, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x3c, 0x31,
+  0x36, 0x3e, 0x3b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x66,
+  0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x3c, 0x34, 0x32, 0x3e, 0x3b, 0x0a,
+  0x09, 0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x62, 0x36, 0x34, 0x20, 0x09,
+  0x25, 0x72, 0x64, 0x3c, 0x35, 0x36, 0x3e, 0x3b, 0x0a, 0x0a, 0x09, 0x6c,
+  0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x36, 0x34, 0x20,
+  0x09, 0x25, 0x72, 0x64, 0x33, 0x33, 0x2c, 0x20, 0x5b, 0x61, 0x64, 0x64,
+  0x42, 0x69, 0x61, 0x73, 0x41, 0x6e, 0x64, 0x41, 0x63, 0x74, 0x69, 0x76,
+  0x61, 0x74, 0x65, 0x5f, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x5f, 0x37, 0x5d,
+  0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e,
+  0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x33, 0x31, 0x2c, 0x20,
+  0x5b, 0x61, 0x64, 0x64, 0x42, 0x69, 0x61, 0x73, 0x41, 0x6e, 0x64, 0x41,
+  0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x5f, 0x70, 0x61, 0x72, 0x61,
+  0x6d, 0x5f, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x75,
+  0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x2c, 0x20, 0x25, 0x6e, 0x74,
+  0x69, 0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61,
+  0x72, 0x61, 0x6d, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64,
+  0x33, 0x37, 0x2c, 0x20, 0x5b, 0x61, 0x64, 0x64, 0x42, 0x69, 0x61, 0x73,
+  0x41, 0x6e, 0x64, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x5f,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x5f, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6d,
+  0x6f, 0x76, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x2c,
+  0x20, 0x25, 0x63, 0x74, 0x61, 0x69, 0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09,
+  0x6d, 0x6f, 0x76, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34,
+  0x2c, 0x20, 0x25, 0x74, 0x69, 0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09, 0x6d,
+  0x61, 0x64, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25,
+  0x72, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x32,
+  0x2c, 0x20, 0x25, 0x72, 0x34, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e,
+  0x75, 0x36, 0x34, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x64,
+  0x35, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x36, 0x3b, 0x0a, 0x09, 0x6d, 0x75,
+  0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72,
+  0x64, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x33, 0x2c, 0x20, 0x25,
+  0x72, 0x64, 0x33, 0x37, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c,
+  0x6f, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x37, 0x2c,
+  0x20, 0x25, 0x72, 0x64, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x31,
+  0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x6c, 0x65, 0x2e, 0x75,
+  0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x64,
+  0x37, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x35, 0x32, 0x3b, 0x0a, 0x09, 0x40,
+  0x25, 0x70, 0x31, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42,
+  0x30, 0x5f, 0x34, 0x30, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61,
+  0x72, 0x61, 0x6d, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64,
+  0x33, 0x32, 0x2c, 0x20, 0x5b, 0x61, 0x64, 0x64, 0x42, 0x69, 0x61, 0x73,
+  0x41, 0x6e, 0x64, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x5f,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x5f, 0x35, 0x5d, 0x3b, 0x0a, 0x09, 0x6c,
+  0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x36, 0x34, 0x20,
+  0x09, 0x25, 0x72, 0x64, 0x33, 0x30, 0x2c, 0x20, 0x5b, 0x61, 0x64, 0x64,
+  0x42, 0x69, 0x61, 0x73, 0x41, 0x6e, 0x64, 0x41, 0x63, 0x74, 0x69, 0x76,
+  0x61, 0x74, 0x65, 0x5f, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x5f, 0x33, 0x5d,
+  0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e,
+  0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x33, 0x34, 0x2c, 0x20,
+  0x5b, 0x61, 0x64, 0x64, 0x42, 0x69, 0x61, 0x73, 0x41, 0x6e, 0x64, 0x41,
+  0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x5f, 0x70, 0x61, 0x72, 0x61,
+  0x6d, 0x5f, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61,
+  0x72, 0x61, 0x6d, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64,
+  0x33, 0x35, 0x2c, 0x20, 0x5b, 0x61, 0x64, 0x64, 0x42, 0x69, 0x61, 0x73,
+  0x41, 0x6e, 0x64, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x5f,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x5f, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x63,
+  0x76, 0x74, 0x61, 0x2e, 0x74, 0x6f, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x31, 0x2c,
+  0x20, 0x25, 0x72, 0x64, 0x33, 0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25,
+  0x72, 0x64, 0x33, 0x36, 0x2c, 0x20, 0x5b, 0x61, 0x64, 0x64, 0x42, 0x69,
+  0x61, 0x73, 0x41, 0x6e, 0x64, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74,
+  0x65, 0x5f, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x5f, 0x31, 0x5d, 0x3b, 0x0a,
+  0x09, 0x63, 0x76, 0x74, 0x61, 0x2e, 0x74, 0x6f, 0x2e, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64,
+  0x32, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x36, 0x3b, 0x0a, 0x09, 0x63,
+  0x76, 0x74, 0x61, 0x2e, 0x74, 0x6f, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x33, 0x2c,
+  0x20, 0x25, 0x72, 0x64, 0x33, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76,
+  0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x2c, 0x20, 0x25,
+  0x6e, 0x63, 0x74, 0x61, 0x69, 0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09, 0x6d,
+  0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25,
+  0x72, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x32,
+  0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x36, 0x34, 0x2e, 0x75,
+  0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x64, 0x34, 0x2c, 0x20, 0x25, 0x72,
+  0x35, 0x3b, 0x0a, 0x09, 0x73, 0x68, 0x6c, 0x2e, 0x62, 0x36, 0x34, 0x20,
+  0x09, 0x25, 0x72, 0x64, 0x35, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x35,
+  0x32, 0x2c, 0x20, 0x32, 0x3b, 0x0a, 0x09, 0x73, 0x68, 0x6c, 0x2e, 0x62,
+  0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x31, 0x31, 0x2c, 0x20, 0x25,
+  0x72, 0x64, 0x34, 0x2c, 0x20, 0x32, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74,
+  0x70, 0x2e, 0x65, 0x71, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70,
+  0x32, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x32, 0x2c, 0x20, 0x30, 0x3b,
+  0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x67, 0x74, 0x2e, 0x73, 0x36,
+  0x34, 0x20, 0x09, 0x25, 0x70, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33,
+  0x30, 0x2c, 0x20, 0x32, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e,
+  0x65, 0x71, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x39, 0x2c,
+  0x20, 0x25, 0x72, 0x64, 0x33, 0x30, 0x2c, 0x20, 0x31, 0x3b, 0x0a, 0x09,
+  0x73, 0x65, 0x74, 0x70, 0x2e, 0x65, 0x71, 0x2e, 0x73, 0x36, 0x34, 0x20,
+  0x09, 0x25, 0x70, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x30,
+  0x2c, 0x20, 0x32, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x33,
+  0x32, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x31, 0x30, 0x2c,
+  0x20, 0x25, 0x72, 0x64, 0x33, 0x31, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74,
+  0x2e, 0x75, 0x33, 0x32, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72,
+  0x31, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x33, 0x3b, 0x0a, 0x09,
+  0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42, 0x42,
+  0x30, 0x5f, 0x32, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33, 0x37,
+  0x3a, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
+  0x25, 0x66, 0x33, 0x37, 0x2c, 0x20, 0x30, 0x66, 0x33, 0x46, 0x38, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x73, 0x75, 0x62, 0x2e, 0x72,
+  0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x38, 0x2c,
+  0x20, 0x25, 0x66, 0x33, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x30, 0x3b,
+  0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32,
+  0x20, 0x09, 0x25, 0x66, 0x34, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x30,
+  0x2c, 0x20, 0x25, 0x66, 0x33, 0x38, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x33, 0x38, 0x3a, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x36,
+  0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x35, 0x30, 0x2c, 0x20, 0x25, 0x72,
+  0x64, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x35, 0x31, 0x3b, 0x0a, 0x09,
+  0x73, 0x74, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x66, 0x33,
+  0x32, 0x20, 0x09, 0x5b, 0x25, 0x72, 0x64, 0x35, 0x30, 0x5d, 0x2c, 0x20,
+  0x25, 0x66, 0x34, 0x31, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33,
+  0x39, 0x3a, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x36, 0x34, 0x20,
+  0x09, 0x25, 0x72, 0x64, 0x35, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x35,
+  0x32, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x34, 0x3b, 0x0a, 0x09, 0x61, 0x64,
+  0x64, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x35, 0x31,
+  0x2c, 0x20, 0x25, 0x72, 0x64, 0x35, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x64,
+  0x31, 0x31, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x6c, 0x74,
+  0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x32, 0x38, 0x2c, 0x20,
+  0x25, 0x72, 0x64, 0x35, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x37, 0x3b,
+  0x0a, 0x09, 0x40, 0x25, 0x70, 0x32, 0x38, 0x20, 0x62, 0x72, 0x61, 0x20,
+  0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x3b, 0x0a, 0x09, 0x62, 0x72,
+  0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x34, 0x30, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x3a, 0x0a,
+  0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72,
+  0x64, 0x31, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x2c, 0x20, 0x25,
+  0x72, 0x64, 0x35, 0x31, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
+  0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x64, 0x31, 0x34, 0x5d, 0x3b, 0x0a,
+  0x09, 0x40, 0x25, 0x70, 0x32, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x31, 0x33, 0x3b, 0x0a, 0x09, 0x6f, 0x72, 0x2e,
+  0x62, 0x36, 0x34, 0x20, 0x20, 0x09, 0x25, 0x72, 0x64, 0x33, 0x38, 0x2c,
+  0x20, 0x25, 0x72, 0x64, 0x35, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x36,
+  0x3b, 0x0a, 0x09, 0x61, 0x6e, 0x64, 0x2e, 0x62, 0x36, 0x34, 0x20, 0x20,
+  0x09, 0x25, 0x72, 0x64, 0x33, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33,
+  0x38, 0x2c, 0x20, 0x2d, 0x34, 0x32, 0x39, 0x34, 0x39, 0x36, 0x37, 0x32,
+  0x39, 0x36, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x6e, 0x65,
+  0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x33, 0x2c, 0x20, 0x25,
+  0x72, 0x64, 0x33, 0x39, 0x2c, 0x20, 0x30, 0x3b, 0x0a, 0x09, 0x40, 0x25,
+  0x70, 0x33, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x35, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69,
+  0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x34, 0x3b, 0x0a, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x35, 0x3a, 0x0a, 0x09, 0x64, 0x69, 0x76, 0x2e, 0x75,
+  0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x35, 0x33, 0x2c, 0x20, 0x25,
+  0x72, 0x64, 0x35, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x36, 0x3b, 0x0a,
+  0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x36, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x34,
+  0x3a, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x33, 0x32, 0x2e, 0x75,
+  0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x64,
+  0x36, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x33, 0x32, 0x2e,
+  0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x38, 0x2c, 0x20, 0x25, 0x72,
+  0x64, 0x35, 0x32, 0x3b, 0x0a, 0x09, 0x64, 0x69, 0x76, 0x2e, 0x75, 0x33,
+  0x32, 0x20, 0x09, 0x25, 0x72, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x38, 0x2c,
+  0x20, 0x25, 0x72, 0x37, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75,
+  0x36, 0x34, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x64, 0x35,
+  0x33, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x36, 0x3a, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e,
+  0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x32, 0x30, 0x2c, 0x20,
+  0x25, 0x72, 0x64, 0x35, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x32,
+  0x3b, 0x0a, 0x09, 0x6f, 0x72, 0x2e, 0x62, 0x36, 0x34, 0x20, 0x20, 0x09,
+  0x25, 0x72, 0x64, 0x34, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x32, 0x30,
+  0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x31, 0x3b, 0x0a, 0x09, 0x61, 0x6e,
+  0x64, 0x2e, 0x62, 0x36, 0x34, 0x20, 0x20, 0x09, 0x25, 0x72, 0x64, 0x34,
+  0x32, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x34, 0x31, 0x2c, 0x20, 0x2d, 0x34,
+  0x32, 0x39, 0x34, 0x39, 0x36, 0x37, 0x32, 0x39, 0x36, 0x3b, 0x0a, 0x09,
+  0x73, 0x65, 0x74, 0x70, 0x2e, 0x6e, 0x65, 0x2e, 0x73, 0x36, 0x34, 0x20,
+  0x09, 0x25, 0x70, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x34, 0x32, 0x2c,
+  0x20, 0x30, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x34, 0x20, 0x62, 0x72,
+  0x61, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x38, 0x3b, 0x0a, 0x09,
+  0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42, 0x42,
+  0x30, 0x5f, 0x37, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x38, 0x3a,
+  0x0a, 0x09, 0x64, 0x69, 0x76, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25,
+  0x72, 0x64, 0x35, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x32, 0x30, 0x2c,
+  0x20, 0x25, 0x72, 0x64, 0x33, 0x31, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61,
+  0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x39,
+  0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x37, 0x3a, 0x0a, 0x09, 0x63,
+  0x76, 0x74, 0x2e, 0x75, 0x33, 0x32, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09,
+  0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x32, 0x30, 0x3b,
+  0x0a, 0x09, 0x64, 0x69, 0x76, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
+  0x72, 0x31, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x25,
+  0x72, 0x31, 0x30, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x36,
+  0x34, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x64, 0x35, 0x34,
+  0x2c, 0x20, 0x25, 0x72, 0x31, 0x32, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x39, 0x3a, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e,
+  0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x34, 0x30, 0x2c, 0x20,
+  0x25, 0x72, 0x64, 0x35, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x36, 0x3b,
+  0x0a, 0x09, 0x73, 0x75, 0x62, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25,
+  0x72, 0x64, 0x31, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x35, 0x32, 0x2c,
+  0x20, 0x25, 0x72, 0x64, 0x34, 0x30, 0x3b, 0x0a, 0x09, 0x6f, 0x72, 0x2e,
+  0x62, 0x36, 0x34, 0x20, 0x20, 0x09, 0x25, 0x72, 0x64, 0x34, 0x33, 0x2c,
+  0x20, 0x25, 0x72, 0x64, 0x31, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33,
+  0x33, 0x3b, 0x0a, 0x09, 0x61, 0x6e, 0x64, 0x2e, 0x62, 0x36, 0x34, 0x20,
+  0x20, 0x09, 0x25, 0x72, 0x64, 0x34, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x64,
+  0x34, 0x33, 0x2c, 0x20, 0x2d, 0x34, 0x32, 0x39, 0x34, 0x39, 0x36, 0x37,
+  0x32, 0x39, 0x36, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x6e,
+  0x65, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x35, 0x2c, 0x20,
+  0x25, 0x72, 0x64, 0x34, 0x34, 0x2c, 0x20, 0x30, 0x3b, 0x0a, 0x09, 0x40,
+  0x25, 0x70, 0x35, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42,
+  0x30, 0x5f, 0x31, 0x31, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75,
+  0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x30, 0x3b,
+  0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x31, 0x3a, 0x0a, 0x09, 0x72,
+  0x65, 0x6d, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x35,
+  0x35, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x31, 0x39, 0x2c, 0x20, 0x25, 0x72,
+  0x64, 0x33, 0x33, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e,
+  0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x32, 0x3b, 0x0a,
+  0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x30, 0x3a, 0x0a, 0x09, 0x63, 0x76,
+  0x74, 0x2e, 0x75, 0x33, 0x32, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25,
+  0x72, 0x31, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x31, 0x39, 0x3b, 0x0a,
+  0x09, 0x72, 0x65, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
+  0x31, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x34, 0x2c, 0x20, 0x25, 0x72,
+  0x31, 0x33, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x36, 0x34,
+  0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x64, 0x35, 0x35, 0x2c,
+  0x20, 0x25, 0x72, 0x31, 0x35, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x31, 0x32, 0x3a, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e,
+  0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x32, 0x34, 0x2c, 0x20,
+  0x25, 0x72, 0x64, 0x35, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x33,
+  0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09,
+  0x25, 0x72, 0x64, 0x34, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x32, 0x34,
+  0x2c, 0x20, 0x25, 0x72, 0x64, 0x35, 0x35, 0x3b, 0x0a, 0x09, 0x73, 0x68,
+  0x6c, 0x2e, 0x62, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x34, 0x36,
+  0x2c, 0x20, 0x25, 0x72, 0x64, 0x34, 0x35, 0x2c, 0x20, 0x32, 0x3b, 0x0a,
+  0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72,
+  0x64, 0x34, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x31, 0x2c, 0x20, 0x25,
+  0x72, 0x64, 0x34, 0x36, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
+  0x31, 0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x64, 0x34, 0x37, 0x5d, 0x3b,
+  0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32,
+  0x20, 0x09, 0x25, 0x66, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x2c, 0x20,
+  0x25, 0x66, 0x31, 0x38, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31,
+  0x33, 0x3a, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x36, 0x20, 0x62, 0x72, 0x61,
+  0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x37, 0x3b, 0x0a, 0x09,
+  0x40, 0x25, 0x70, 0x39, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x32, 0x32, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x31,
+  0x30, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x31, 0x36, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69,
+  0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x34, 0x3b, 0x0a, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x31, 0x36, 0x3a, 0x0a, 0x09, 0x73, 0x65, 0x74,
+  0x70, 0x2e, 0x67, 0x74, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70,
+  0x31, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x2c, 0x20, 0x30, 0x66, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x6d, 0x75,
+  0x6c, 0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
+  0x32, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x2c, 0x20, 0x30, 0x66, 0x33,
+  0x43, 0x32, 0x33, 0x44, 0x37, 0x30, 0x41, 0x3b, 0x0a, 0x09, 0x73, 0x65,
+  0x6c, 0x70, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x30,
+  0x2c, 0x20, 0x25, 0x66, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x39, 0x2c,
+  0x20, 0x25, 0x70, 0x31, 0x35, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e,
+  0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x37,
+  0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x37, 0x3a, 0x0a, 0x09,
+  0x73, 0x65, 0x74, 0x70, 0x2e, 0x65, 0x71, 0x2e, 0x73, 0x36, 0x34, 0x20,
+  0x09, 0x25, 0x70, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x30, 0x2c,
+  0x20, 0x33, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x37, 0x20, 0x62, 0x72,
+  0x61, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x33, 0x3b, 0x0a,
+  0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x65, 0x71, 0x2e, 0x73, 0x36, 0x34,
+  0x20, 0x09, 0x25, 0x70, 0x38, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x30,
+  0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x38, 0x20, 0x62,
+  0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x39, 0x3b,
+  0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x32, 0x34, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x31, 0x39, 0x3a, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x72, 0x6e,
+  0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x2c, 0x20, 0x25,
+  0x66, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x3b, 0x0a, 0x09, 0x73, 0x65,
+  0x74, 0x70, 0x2e, 0x6c, 0x74, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
+  0x70, 0x31, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x2c, 0x20, 0x30, 0x66,
+  0x43, 0x32, 0x34, 0x38, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x6d,
+  0x6f, 0x76, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x30,
+  0x2c, 0x20, 0x30, 0x66, 0x42, 0x46, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x31, 0x31, 0x20, 0x62, 0x72, 0x61,
+  0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x37, 0x3b, 0x0a, 0x09,
+  0x73, 0x65, 0x74, 0x70, 0x2e, 0x67, 0x74, 0x2e, 0x66, 0x33, 0x32, 0x20,
+  0x09, 0x25, 0x70, 0x31, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x2c, 0x20,
+  0x30, 0x66, 0x34, 0x32, 0x34, 0x38, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a,
+  0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
+  0x34, 0x30, 0x2c, 0x20, 0x30, 0x66, 0x33, 0x46, 0x38, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x31, 0x32, 0x20, 0x62,
+  0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x37, 0x3b,
+  0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32,
+  0x20, 0x09, 0x25, 0x66, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x2c,
+  0x20, 0x30, 0x66, 0x42, 0x46, 0x42, 0x38, 0x41, 0x41, 0x33, 0x42, 0x3b,
+  0x0a, 0x09, 0x65, 0x78, 0x32, 0x2e, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x78,
+  0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x32, 0x2c, 0x20,
+  0x25, 0x66, 0x32, 0x31, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x72,
+  0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x33, 0x2c,
+  0x20, 0x25, 0x66, 0x32, 0x32, 0x2c, 0x20, 0x30, 0x66, 0x33, 0x46, 0x38,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x72, 0x63, 0x70, 0x2e,
+  0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x34,
+  0x2c, 0x20, 0x25, 0x66, 0x32, 0x33, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64,
+  0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32,
+  0x35, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x32,
+  0x34, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x72, 0x6e, 0x2e, 0x66,
+  0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20, 0x25, 0x66,
+  0x32, 0x35, 0x2c, 0x20, 0x30, 0x66, 0x42, 0x46, 0x38, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69,
+  0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x37, 0x3b, 0x0a, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x32, 0x32, 0x3a, 0x0a, 0x09, 0x6d, 0x61, 0x78,
+  0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20,
+  0x25, 0x66, 0x33, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e,
+  0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x37, 0x3b, 0x0a,
+  0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x33, 0x3a, 0x0a, 0x09, 0x6d, 0x75,
+  0x6c, 0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
+  0x32, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x2c, 0x20, 0x30, 0x66, 0x33,
+  0x45, 0x34, 0x43, 0x43, 0x43, 0x43, 0x44, 0x3b, 0x0a, 0x09, 0x61, 0x64,
+  0x64, 0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
+  0x32, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x36, 0x2c, 0x20, 0x30, 0x66,
+  0x33, 0x46, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x73,
+  0x65, 0x74, 0x70, 0x2e, 0x6c, 0x74, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
+  0x25, 0x70, 0x31, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x37, 0x2c, 0x20,
+  0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a,
+  0x09, 0x73, 0x65, 0x6c, 0x70, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
+  0x66, 0x32, 0x38, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x37, 0x2c, 0x20, 0x25,
+  0x70, 0x31, 0x33, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x67,
+  0x74, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x31, 0x34, 0x2c,
+  0x20, 0x25, 0x66, 0x32, 0x38, 0x2c, 0x20, 0x30, 0x66, 0x33, 0x46, 0x38,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x6c, 0x70,
+  0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20,
+  0x30, 0x66, 0x33, 0x46, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x20,
+  0x25, 0x66, 0x32, 0x38, 0x2c, 0x20, 0x25, 0x70, 0x31, 0x34, 0x3b, 0x0a,
+  0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x32, 0x37, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x32, 0x34, 0x3a, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x6c, 0x74,
+  0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x31, 0x36, 0x2c, 0x20,
+  0x25, 0x66, 0x33, 0x2c, 0x20, 0x30, 0x66, 0x43, 0x32, 0x34, 0x38, 0x30,
+  0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x66, 0x33,
+  0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20, 0x30, 0x66, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x40, 0x25,
+  0x70, 0x31, 0x36, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42,
+  0x30, 0x5f, 0x32, 0x37, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e,
+  0x67, 0x74, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x31, 0x37,
+  0x2c, 0x20, 0x25, 0x66, 0x33, 0x2c, 0x20, 0x30, 0x66, 0x34, 0x32, 0x34,
+  0x38, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e,
+  0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20, 0x30,
+  0x66, 0x33, 0x46, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09,
+  0x40, 0x25, 0x70, 0x31, 0x37, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x32, 0x37, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c,
+  0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39,
+  0x2c, 0x20, 0x25, 0x66, 0x33, 0x2c, 0x20, 0x30, 0x66, 0x42, 0x46, 0x42,
+  0x38, 0x41, 0x41, 0x33, 0x42, 0x3b, 0x0a, 0x09, 0x65, 0x78, 0x32, 0x2e,
+  0x61, 0x70, 0x70, 0x72, 0x6f, 0x78, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
+  0x25, 0x66, 0x33, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x3b, 0x0a, 0x09,
+  0x61, 0x64, 0x64, 0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
+  0x25, 0x66, 0x33, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x32, 0x2c, 0x20,
+  0x30, 0x66, 0x33, 0x46, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a,
+  0x09, 0x72, 0x63, 0x70, 0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32, 0x20,
+  0x09, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x33, 0x3b,
+  0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x37, 0x3a, 0x0a, 0x09, 0x6d,
+  0x6f, 0x76, 0x2e, 0x75, 0x36, 0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x34,
+  0x38, 0x2c, 0x20, 0x30, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x61, 0x2e,
+  0x74, 0x6f, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x75, 0x36,
+  0x34, 0x20, 0x09, 0x25, 0x72, 0x64, 0x34, 0x39, 0x2c, 0x20, 0x25, 0x72,
+  0x64, 0x34, 0x38, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x65,
+  0x71, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x31, 0x38, 0x2c,
+  0x20, 0x25, 0x72, 0x64, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x34, 0x39,
+  0x3b, 0x0a, 0x09, 0x73, 0x74, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x5b, 0x25, 0x72, 0x64, 0x31, 0x34,
+  0x5d, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x30, 0x3b, 0x0a, 0x09, 0x40, 0x25,
+  0x70, 0x31, 0x38, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42,
+  0x30, 0x5f, 0x33, 0x39, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x36, 0x20,
+  0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33, 0x32,
+  0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x39, 0x20, 0x62, 0x72, 0x61, 0x20,
+  0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33, 0x35, 0x3b, 0x0a, 0x09, 0x40,
+  0x25, 0x70, 0x31, 0x30, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x33, 0x31, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e,
+  0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33, 0x37,
+  0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33, 0x31, 0x3a, 0x0a, 0x09,
+  0x73, 0x65, 0x74, 0x70, 0x2e, 0x67, 0x74, 0x2e, 0x66, 0x33, 0x32, 0x20,
+  0x09, 0x25, 0x70, 0x32, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x30, 0x2c,
+  0x20, 0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b,
+  0x0a, 0x09, 0x73, 0x65, 0x6c, 0x70, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
+  0x25, 0x66, 0x34, 0x31, 0x2c, 0x20, 0x30, 0x66, 0x33, 0x46, 0x38, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x2c, 0x20, 0x30, 0x66, 0x33, 0x43, 0x32, 0x33,
+  0x44, 0x37, 0x30, 0x41, 0x2c, 0x20, 0x25, 0x70, 0x32, 0x36, 0x3b, 0x0a,
+  0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x33, 0x38, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x33, 0x32, 0x3a, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x65, 0x71,
+  0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x32, 0x30, 0x2c, 0x20,
+  0x25, 0x72, 0x64, 0x33, 0x30, 0x2c, 0x20, 0x33, 0x3b, 0x0a, 0x09, 0x40,
+  0x25, 0x70, 0x32, 0x30, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x33, 0x36, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70,
+  0x2e, 0x65, 0x71, 0x2e, 0x73, 0x36, 0x34, 0x20, 0x09, 0x25, 0x70, 0x32,
+  0x31, 0x2c, 0x20, 0x25, 0x72, 0x64, 0x33, 0x30, 0x2c, 0x20, 0x34, 0x3b,
+  0x0a, 0x09, 0x40, 0x25, 0x70, 0x32, 0x31, 0x20, 0x62, 0x72, 0x61, 0x20,
+  0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33, 0x34, 0x3b, 0x0a, 0x09, 0x62,
+  0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x33, 0x37, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33, 0x34,
+  0x3a, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33,
+  0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x34,
+  0x30, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x30, 0x3b, 0x0a, 0x09, 0x6d, 0x6f,
+  0x76, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x35, 0x2c,
+  0x20, 0x30, 0x66, 0x33, 0x46, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b,
+  0x0a, 0x09, 0x73, 0x75, 0x62, 0x2e, 0x72, 0x6e, 0x2e, 0x66, 0x33, 0x32,
+  0x20, 0x09, 0x25, 0x66, 0x34, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x35,
+  0x2c, 0x20, 0x25, 0x66, 0x33, 0x34, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61,
+  0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33,
+  0x38, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33, 0x35, 0x3a, 0x0a,
+  0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x67, 0x74, 0x2e, 0x66, 0x33, 0x32,
+  0x20, 0x09, 0x25, 0x70, 0x32, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x30,
+  0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x3b, 0x0a, 0x09, 0x73, 0x65, 0x6c, 0x70, 0x2e, 0x66, 0x33, 0x32, 0x20,
+  0x09, 0x25, 0x66, 0x34, 0x31, 0x2c, 0x20, 0x30, 0x66, 0x33, 0x46, 0x38,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x20, 0x25, 0x70, 0x32, 0x37, 0x3b,
+  0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x33, 0x38, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x33, 0x36, 0x3a, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x67,
+  0x74, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x32, 0x34, 0x2c,
+  0x20, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70,
+  0x2e, 0x6c, 0x74, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x32,
+  0x35, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20, 0x30, 0x66, 0x33,
+  0x46, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x09, 0x73, 0x65,
+  0x6c, 0x70, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x36,
+  0x2c, 0x20, 0x30, 0x66, 0x33, 0x45, 0x34, 0x43, 0x43, 0x43, 0x43, 0x44,
+  0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x2c, 0x20, 0x25, 0x70, 0x32, 0x35, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x6c,
+  0x70, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x31, 0x2c,
+  0x20, 0x25, 0x66, 0x33, 0x36, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x20, 0x25, 0x70, 0x32, 0x34, 0x3b,
+  0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x33, 0x38, 0x3b, 0x0a, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x34, 0x30, 0x3a, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x0a
   , 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
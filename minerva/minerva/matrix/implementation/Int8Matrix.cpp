@@ -0,0 +1,404 @@
+/*	\file   Int8Matrix.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The source file for the Int8Matrix class and int8 kernels.
+*/
+
+// Minerva Includes
+#include <minerva/matrix/interface/Int8Matrix.h>
+
+#include <minerva/util/interface/Knobs.h>
+
+// Standard Library Includes
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define MINERVA_HAS_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+// AVX-VNNI intrinsics first appeared in these compilers
+#if defined(MINERVA_HAS_X86_KERNELS) && \
+	((defined(__clang__) && __clang_major__ >= 13) || \
+	(!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 11))
+#define MINERVA_HAS_VNNI_KERNEL 1
+#endif
+
+namespace minerva
+{
+
+namespace matrix
+{
+
+Int8Matrix::Int8Matrix()
+: _rows(0), _columns(0)
+{
+
+}
+
+Int8Matrix::Int8Matrix(const int8_t* data, size_t rows, size_t columns)
+: _rows(rows), _columns(columns)
+{
+	_data.resize(paddedRows() * paddedColumns(), 0);
+
+	size_t stride = paddedColumns();
+
+	for(size_t row = 0; row < rows; ++row)
+	{
+		for(size_t column = 0; column < columns; ++column)
+		{
+			_data[((row / 4) * stride + column) * 4 + row % 4] =
+				data[row * columns + column];
+		}
+	}
+}
+
+size_t Int8Matrix::rows() const
+{
+	return _rows;
+}
+
+size_t Int8Matrix::columns() const
+{
+	return _columns;
+}
+
+size_t Int8Matrix::paddedRows() const
+{
+	return (_rows + 3) / 4 * 4;
+}
+
+size_t Int8Matrix::paddedColumns() const
+{
+	return (_columns + 7) / 8 * 8;
+}
+
+const int8_t* Int8Matrix::data() const
+{
+	return _data.data();
+}
+
+enum Int8Kernel
+{
+	ScalarKernel,
+	Avx2Kernel,
+	VnniKernel
+};
+
+static void multiplyScalar(int32_t* c, size_t cStride, const uint8_t* a,
+	size_t aStride, size_t rows, const Int8Matrix& b)
+{
+	size_t groups  = b.paddedRows() / 4;
+	size_t columns = b.columns();
+	size_t stride  = b.paddedColumns();
+
+	const int8_t* bData = b.data();
+
+	for(size_t row = 0; row < rows; ++row)
+	{
+		const uint8_t* aRow = a + row * aStride;
+		int32_t*       cRow = c + row * cStride;
+
+		for(size_t column = 0; column < columns; ++column)
+		{
+			int32_t sum = 0;
+
+			for(size_t group = 0; group < groups; ++group)
+			{
+				const uint8_t* aValues = aRow + 4 * group;
+				const int8_t*  bValues = bData + (group * stride + column) * 4;
+
+				sum += aValues[0] * bValues[0] + aValues[1] * bValues[1] +
+					aValues[2] * bValues[2] + aValues[3] * bValues[3];
+			}
+
+			cRow[column] = sum;
+		}
+	}
+}
+
+#ifdef MINERVA_HAS_X86_KERNELS
+
+__attribute__((target("avx2")))
+static inline void storeColumns(int32_t* cRow, size_t column, size_t columns,
+	__m256i value)
+{
+	if(column >= columns)
+	{
+		return;
+	}
+
+	if(column + 8 <= columns)
+	{
+		_mm256_storeu_si256((__m256i*)(cRow + column), value);
+		return;
+	}
+
+	int32_t values[8];
+
+	_mm256_storeu_si256((__m256i*)values, value);
+
+	std::copy(values, values + (columns - column), cRow + column);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i broadcastQuad(const uint8_t* values)
+{
+	int32_t quad = 0;
+
+	std::memcpy(&quad, values, sizeof(quad));
+
+	return _mm256_set1_epi32(quad);
+}
+
+/*! \brief u8 x s8 pairs summed to 16 bits (maddubs), then to 32 bits (madd) */
+__attribute__((target("avx2")))
+static void multiplyAvx2(int32_t* c, size_t cStride, const uint8_t* a,
+	size_t aStride, size_t rows, const Int8Matrix& b)
+{
+	size_t groups  = b.paddedRows() / 4;
+	size_t columns = b.columns();
+	size_t stride  = b.paddedColumns();
+
+	const int8_t* bData = b.data();
+
+	const __m256i ones = _mm256_set1_epi16(1);
+
+	for(size_t row = 0; row < rows; ++row)
+	{
+		const uint8_t* aRow = a + row * aStride;
+		int32_t*       cRow = c + row * cStride;
+
+		size_t column = 0;
+
+		// four accumulators share each broadcast of the input
+		for(; column + 32 <= stride; column += 32)
+		{
+			__m256i sum0 = _mm256_setzero_si256();
+			__m256i sum1 = _mm256_setzero_si256();
+			__m256i sum2 = _mm256_setzero_si256();
+			__m256i sum3 = _mm256_setzero_si256();
+
+			for(size_t group = 0; group < groups; ++group)
+			{
+				__m256i input = broadcastQuad(aRow + 4 * group);
+
+				const __m256i* weights =
+					(const __m256i*)(bData + (group * stride + column) * 4);
+
+				sum0 = _mm256_add_epi32(sum0, _mm256_madd_epi16(
+					_mm256_maddubs_epi16(input, _mm256_loadu_si256(weights + 0)), ones));
+				sum1 = _mm256_add_epi32(sum1, _mm256_madd_epi16(
+					_mm256_maddubs_epi16(input, _mm256_loadu_si256(weights + 1)), ones));
+				sum2 = _mm256_add_epi32(sum2, _mm256_madd_epi16(
+					_mm256_maddubs_epi16(input, _mm256_loadu_si256(weights + 2)), ones));
+				sum3 = _mm256_add_epi32(sum3, _mm256_madd_epi16(
+					_mm256_maddubs_epi16(input, _mm256_loadu_si256(weights + 3)), ones));
+			}
+
+			storeColumns(cRow, column,      columns, sum0);
+			storeColumns(cRow, column +  8, columns, sum1);
+			storeColumns(cRow, column + 16, columns, sum2);
+			storeColumns(cRow, column + 24, columns, sum3);
+		}
+
+		for(; column < stride; column += 8)
+		{
+			__m256i sum = _mm256_setzero_si256();
+
+			for(size_t group = 0; group < groups; ++group)
+			{
+				__m256i input = broadcastQuad(aRow + 4 * group);
+
+				__m256i weights = _mm256_loadu_si256(
+					(const __m256i*)(bData + (group * stride + column) * 4));
+
+				sum = _mm256_add_epi32(sum, _mm256_madd_epi16(
+					_mm256_maddubs_epi16(input, weights), ones));
+			}
+
+			storeColumns(cRow, column, columns, sum);
+		}
+	}
+}
+
+#endif
+
+#ifdef MINERVA_HAS_VNNI_KERNEL
+
+/*! \brief The same schedule as the AVX2 kernel, with one dpbusd per group */
+__attribute__((target("avx2,avxvnni")))
+static void multiplyVnni(int32_t* c, size_t cStride, const uint8_t* a,
+	size_t aStride, size_t rows, const Int8Matrix& b)
+{
+	size_t groups  = b.paddedRows() / 4;
+	size_t columns = b.columns();
+	size_t stride  = b.paddedColumns();
+
+	const int8_t* bData = b.data();
+
+	for(size_t row = 0; row < rows; ++row)
+	{
+		const uint8_t* aRow = a + row * aStride;
+		int32_t*       cRow = c + row * cStride;
+
+		size_t column = 0;
+
+		for(; column + 32 <= stride; column += 32)
+		{
+			__m256i sum0 = _mm256_setzero_si256();
+			__m256i sum1 = _mm256_setzero_si256();
+			__m256i sum2 = _mm256_setzero_si256();
+			__m256i sum3 = _mm256_setzero_si256();
+
+			for(size_t group = 0; group < groups; ++group)
+			{
+				__m256i input = broadcastQuad(aRow + 4 * group);
+
+				const __m256i* weights =
+					(const __m256i*)(bData + (group * stride + column) * 4);
+
+				sum0 = _mm256_dpbusd_avx_epi32(sum0, input,
+					_mm256_loadu_si256(weights + 0));
+				sum1 = _mm256_dpbusd_avx_epi32(sum1, input,
+					_mm256_loadu_si256(weights + 1));
+				sum2 = _mm256_dpbusd_avx_epi32(sum2, input,
+					_mm256_loadu_si256(weights + 2));
+				sum3 = _mm256_dpbusd_avx_epi32(sum3, input,
+					_mm256_loadu_si256(weights + 3));
+			}
+
+			storeColumns(cRow, column,      columns, sum0);
+			storeColumns(cRow, column +  8, columns, sum1);
+			storeColumns(cRow, column + 16, columns, sum2);
+			storeColumns(cRow, column + 24, columns, sum3);
+		}
+
+		for(; column < stride; column += 8)
+		{
+			__m256i sum = _mm256_setzero_si256();
+
+			for(size_t group = 0; group < groups; ++group)
+			{
+				__m256i input = broadcastQuad(aRow + 4 * group);
+
+				sum = _mm256_dpbusd_avx_epi32(sum, input, _mm256_loadu_si256(
+					(const __m256i*)(bData + (group * stride + column) * 4)));
+			}
+
+			storeColumns(cRow, column, columns, sum);
+		}
+	}
+}
+
+#endif
+
+static bool isSupported(Int8Kernel kernel)
+{
+	switch(kernel)
+	{
+	#ifdef MINERVA_HAS_VNNI_KERNEL
+	case VnniKernel: return __builtin_cpu_supports("avxvnni");
+	#endif
+	#ifdef MINERVA_HAS_X86_KERNELS
+	case Avx2Kernel: return __builtin_cpu_supports("avx2");
+	#endif
+	case ScalarKernel: return true;
+	default: return false;
+	}
+}
+
+static Int8Kernel getBestKernel()
+{
+	static Int8Kernel best = isSupported(VnniKernel) ? VnniKernel :
+		(isSupported(Avx2Kernel) ? Avx2Kernel : ScalarKernel);
+
+	return best;
+}
+
+static util::Knob<std::string> kernelKnob("Int8Matrix::Kernel", "",
+	"Force the int8 multiply kernel (vnni, avx2, or scalar)");
+
+static Int8Kernel getKernel()
+{
+	// avoid the string knob lock in the common case
+	if(!kernelKnob.isSet())
+	{
+		return getBestKernel();
+	}
+
+	auto name = kernelKnob.get();
+
+	if(name.empty())
+	{
+		return getBestKernel();
+	}
+
+	Int8Kernel kernel = ScalarKernel;
+
+	if(name == "vnni")
+	{
+		kernel = VnniKernel;
+	}
+	else if(name == "avx2")
+	{
+		kernel = Avx2Kernel;
+	}
+	else if(name != "scalar")
+	{
+		throw std::runtime_error("Unknown int8 kernel '" + name +
+			"', expecting 'vnni', 'avx2', or 'scalar'.");
+	}
+
+	if(!isSupported(kernel))
+	{
+		throw std::runtime_error("The int8 kernel '" + name +
+			"' is not supported on this machine.");
+	}
+
+	return kernel;
+}
+
+void int8Multiply(int32_t* c, size_t cStride, const uint8_t* a,
+	size_t aStride, size_t rows, const Int8Matrix& b)
+{
+	switch(getKernel())
+	{
+	#ifdef MINERVA_HAS_VNNI_KERNEL
+	case VnniKernel:
+	{
+		multiplyVnni(c, cStride, a, aStride, rows, b);
+		break;
+	}
+	#endif
+	#ifdef MINERVA_HAS_X86_KERNELS
+	case Avx2Kernel:
+	{
+		multiplyAvx2(c, cStride, a, aStride, rows, b);
+		break;
+	}
+	#endif
+	default:
+	{
+		multiplyScalar(c, cStride, a, aStride, rows, b);
+		break;
+	}
+	}
+}
+
+std::string getInt8KernelName()
+{
+	switch(getKernel())
+	{
+	case VnniKernel: return "vnni";
+	case Avx2Kernel: return "avx2";
+	default:         return "scalar";
+	}
+}
+
+}
+
+}
+
@@ -11,18 +11,41 @@
 #include <minerva/matrix/interface/CublasMatrix.h>
 #include <minerva/matrix/interface/AtlasMatrix.h>
 
+#include <minerva/util/interface/Profiler.h>
+#include <minerva/util/interface/Metrics.h>
+
 namespace minerva
 {
 
 namespace matrix
 {
 
+// matrices may be created during static initialization, so the metrics are
+//  looked up on first use rather than at file scope
+static util::Counter& getAllocatedBytesCounter()
+{
+	static util::Counter& counter = util::Metrics::getCounter(
+		"minerva_matrix_allocated_bytes_total", "Bytes allocated for matrices.");
+
+	return counter;
+}
+
+static util::Counter& getAllocationsCounter()
+{
+	static util::Counter& counter = util::Metrics::getCounter(
+		"minerva_matrix_allocations_total", "Matrices allocated.");
+
+	return counter;
+}
 
 MatrixImplementation::MatrixImplementation(
 	size_t rows, size_t columns, const FloatVector& d)
 : _data(d), _rows(rows), _columns(columns)
 {
-
+	util::Profiler::recordAllocation(rows * columns * sizeof(float));
+	
+	getAllocatedBytesCounter().increment(rows * columns * sizeof(float));
+	getAllocationsCounter().increment();
 }
 
 MatrixImplementation::~MatrixImplementation()
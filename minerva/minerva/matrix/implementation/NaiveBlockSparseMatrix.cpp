@@ -462,6 +462,72 @@ void NaiveBlockSparseMatrix::sigmoidDerivativeSelf()
 	}
 }
 
+void NaiveBlockSparseMatrix::activationDerivativeSelf(ActivationFunction::Type type)
+{
+	// TODO: in parallel
+	for(auto& matrix : *this)
+	{
+		for(auto& value : matrix.data())
+		{
+			value = ActivationFunction::applyDerivative(type, value);
+		}
+	}
+}
+
+void NaiveBlockSparseMatrix::addBiasAndActivateSelf(const Value* bias,
+	ActivationFunction::Type type, Value* derivative)
+{
+	// TODO: in parallel
+	for(size_t block = 0; block < blocks(); ++block)
+	{
+		auto& matrix = (*this)[block];
+		
+		size_t rows    = matrix.rows();
+		size_t columns = matrix.columns();
+		
+		float* data = matrix.data().data();
+		
+		// bias blocks map onto blocks as in convolutionalAddBroadcastRow
+		const float* biasData = bias->empty() ? nullptr :
+			(*bias)[(block * bias->blocks()) / blocks()].data().data();
+		
+		float* derivativeData = derivative == nullptr ? nullptr :
+			(*derivative)[block].data().data();
+		
+		// finish each row while it is still in cache
+		for(size_t row = 0; row < rows; ++row)
+		{
+			float* rowData = data + row * columns;
+			
+			if(biasData != nullptr)
+			{
+				for(size_t column = 0; column < columns; ++column)
+				{
+					rowData[column] += biasData[column];
+				}
+			}
+			
+			for(size_t column = 0; column < columns; ++column)
+			{
+				rowData[column] = ActivationFunction::apply(type, rowData[column]);
+			}
+			
+			if(derivativeData == nullptr)
+			{
+				continue;
+			}
+			
+			float* derivativeRow = derivativeData + row * columns;
+			
+			for(size_t column = 0; column < columns; ++column)
+			{
+				derivativeRow[column] = ActivationFunction::applyDerivative(type,
+					rowData[column]);
+			}
+		}
+	}
+}
+
 void NaiveBlockSparseMatrix::minSelf(float v)
 {
 	// TODO: in parallel
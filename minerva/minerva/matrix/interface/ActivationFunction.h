@@ -0,0 +1,119 @@
+/*! \file   ActivationFunction.h
+	\author Gregory Diamos
+	\date   Sunday October 18, 2026
+	\brief  The header file for the ActivationFunction class.
+*/
+
+#pragma once
+
+// Standard Library Includes
+#include <algorithm>
+#include <cmath>
+
+namespace minerva
+{
+
+namespace matrix
+{
+
+/*! \brief The element-wise activation functions of a neural network layer.
+
+	This is the only host definition of each formula, the matrix backends
+	and the layers all call it.  The device kernels in
+	cuda/sparse-matrix/CudaBlockSparseMatrix.cu mirror it.
+*/
+class ActivationFunction
+{
+public:
+	enum Type
+	{
+		Sigmoid,
+		RectifiedLinear,
+		LeakyRectifiedLinear,
+		HardSigmoid,
+		Tanh
+	};
+
+public:
+	/*! \brief Apply the function to a single value */
+	inline static float apply(Type type, float value);
+
+	/*! \brief The derivative of the function, computed from its output
+		alone, with no transcendental call */
+	inline static float applyDerivative(Type type, float output);
+
+public:
+	/*! \brief The slope of a leaky rectified linear unit below zero */
+	inline static float getLeakyRectifiedLinearSlope();
+
+};
+
+inline float ActivationFunction::apply(Type type, float value)
+{
+	switch(type)
+	{
+	case RectifiedLinear:
+	{
+		return value > 0.0f ? value : 0.0f;
+	}
+	case LeakyRectifiedLinear:
+	{
+		return value > 0.0f ? value : getLeakyRectifiedLinearSlope() * value;
+	}
+	case HardSigmoid:
+	{
+		return std::min(1.0f, std::max(0.0f, 0.2f * value + 0.5f));
+	}
+	case Tanh:
+	{
+		return std::tanh(value);
+	}
+	default:
+	{
+		if(value < -50.0f) return 0.0f;
+		if(value >  50.0f) return 1.0f;
+
+		return 1.0f / (1.0f + std::exp(-value));
+	}
+	}
+}
+
+inline float ActivationFunction::applyDerivative(Type type, float output)
+{
+	switch(type)
+	{
+	case RectifiedLinear:
+	{
+		return output > 0.0f ? 1.0f : 0.0f;
+	}
+	case LeakyRectifiedLinear:
+	{
+		// the output keeps the sign of the input
+		return output > 0.0f ? 1.0f : getLeakyRectifiedLinearSlope();
+	}
+	case HardSigmoid:
+	{
+		return (output > 0.0f && output < 1.0f) ? 0.2f : 0.0f;
+	}
+	case Tanh:
+	{
+		// f(x) = tanh(x), dy/dx = 1 - f(x)^2
+		return 1.0f - output * output;
+	}
+	default:
+	{
+		// f(x) = 1/(1+e^-x), dy/dx = f(x) * (1 - f(x))
+		return output * (1.0f - output);
+	}
+	}
+}
+
+inline float ActivationFunction::getLeakyRectifiedLinearSlope()
+{
+	return 0.01f;
+}
+
+}
+
+}
+
@@ -6,6 +6,9 @@
 
 #pragma once
 
+// Minerva Includes
+#include <minerva/matrix/interface/ActivationFunction.h>
+
 // Standard Library Includes
 #include <vector>
 #include <cstdint>
@@ -121,6 +124,13 @@ public:
 	void logSelf();
     void sigmoidSelf();
     void sigmoidDerivativeSelf();
+	void activationDerivativeSelf(ActivationFunction::Type type);
+
+	// the bias is broadcast as in convolutionalAddBroadcastRow
+	void addBiasAndActivateSelf(const BlockSparseMatrix& bias,
+		ActivationFunction::Type type);
+	void addBiasAndActivateSelf(const BlockSparseMatrix& bias,
+		ActivationFunction::Type type, BlockSparseMatrix& derivative);
 	void minSelf(float f);
 	void maxSelf(float f);
 	void assignSelf(float f);
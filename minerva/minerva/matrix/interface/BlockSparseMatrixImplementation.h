@@ -6,6 +6,9 @@
 
 #pragma once
 
+// Minerva Includes
+#include <minerva/matrix/interface/ActivationFunction.h>
+
 // Standard Library Includes
 #include <vector>
 #include <random>
@@ -67,6 +70,9 @@ public:
 	virtual void logSelf() = 0;
     virtual void sigmoidSelf() = 0;
     virtual void sigmoidDerivativeSelf() = 0;
+	virtual void activationDerivativeSelf(ActivationFunction::Type type) = 0;
+	virtual void addBiasAndActivateSelf(const Value* bias,
+		ActivationFunction::Type type, Value* derivative) = 0;
 	virtual void minSelf(float v) = 0;
 	virtual void maxSelf(float v) = 0;
 	virtual void assignSelf(float v) = 0;
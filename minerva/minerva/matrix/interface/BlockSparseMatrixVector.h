@@ -90,7 +90,7 @@ public:
 
 public:
 	void push_back(const BlockSparseMatrix&  );
-	void push_back(const BlockSparseMatrix&& );
+	void push_back(BlockSparseMatrix&& );
 
 public:
 	BlockSparseMatrix& back();
@@ -64,6 +64,9 @@ public:
 	virtual void logSelf();
     virtual void sigmoidSelf();
     virtual void sigmoidDerivativeSelf();
+	virtual void activationDerivativeSelf(ActivationFunction::Type type);
+	virtual void addBiasAndActivateSelf(const Value* bias,
+		ActivationFunction::Type type, Value* derivative);
 	
 	virtual void minSelf(float value);
 	virtual void maxSelf(float value);
@@ -36,6 +36,8 @@ public:
 		size_t rightRowsPerBlock, size_t rightColumnsPerBlock);
 	static void convolutionalAddBroadcastRow(float* result, const float* left, const float* right,
 		size_t leftBlocks, size_t rightBlocks, size_t rows, size_t columns);
+	static void addBiasAndActivate(float* result, float* derivative, const float* bias,
+		size_t activation, size_t resultBlocks, size_t biasBlocks, size_t rows, size_t columns);
 	
 
 public:
@@ -65,6 +67,7 @@ public:
 	static void logSelf(float* result, size_t size);
 	static void sigmoidSelf(float* result, size_t size);
 	static void sigmoidDerivativeSelf(float* result, size_t size);
+	static void activationDerivativeSelf(float* result, size_t activation, size_t size);
 	static void minSelf(float* result, float value, size_t size);
 	static void maxSelf(float* result, float value, size_t size);
 	static void assignSelf(float* result, float value, size_t size);
@@ -0,0 +1,71 @@
+/*	\file   Int8Matrix.h
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The header file for the Int8Matrix class and int8 kernels.
+*/
+
+#pragma once
+
+// Standard Library Includes
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace minerva
+{
+
+namespace matrix
+{
+
+/*! \brief A row major int8 matrix, packed for the int8 multiply kernels.
+
+	Groups of four consecutive rows are interleaved so that each 32-bit lane
+	holds four values of one column, rows are padded to a multiple of four
+	and columns to a multiple of eight with zeros.
+*/
+class Int8Matrix
+{
+public:
+	Int8Matrix();
+	Int8Matrix(const int8_t* data, size_t rows, size_t columns);
+
+public:
+	size_t rows()    const;
+	size_t columns() const;
+
+public:
+	size_t paddedRows()    const;
+	size_t paddedColumns() const;
+
+public:
+	const int8_t* data() const;
+
+private:
+	size_t _rows;
+	size_t _columns;
+
+private:
+	std::vector<int8_t> _data;
+
+};
+
+/*! \brief c = a * b, accumulated in 32 bits.
+
+	'a' holds 'rows' rows of at least b.paddedRows() values, 'aStride' bytes
+	apart.  The values must be below 128 so that the pairwise 16-bit sums of
+	the AVX2 kernel cannot saturate; every kernel then gives identical results.
+
+	The kernel is chosen from the CPU features, or by the knob
+	Int8Matrix::Kernel ("vnni", "avx2", or "scalar").
+*/
+void int8Multiply(int32_t* c, size_t cStride, const uint8_t* a,
+	size_t aStride, size_t rows, const Int8Matrix& b);
+
+/*! \brief The name of the kernel that int8Multiply will use */
+std::string getInt8KernelName();
+
+}
+
+}
+
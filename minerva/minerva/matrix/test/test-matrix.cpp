@@ -7,14 +7,20 @@
 // Minerva Includes
 #include <minerva/matrix/interface/Matrix.h>
 #include <minerva/matrix/interface/BlockSparseMatrix.h>
+#include <minerva/matrix/interface/Int8Matrix.h>
+#include <minerva/matrix/interface/ActivationFunction.h>
+#include <minerva/util/interface/Knobs.h>
 #include <minerva/util/interface/debug.h>
 
 // Standard Library Includes
 #include <iostream>
+#include <random>
+#include <cmath>
 
 // Global Typedefs
 typedef minerva::matrix::Matrix Matrix;
 typedef minerva::matrix::BlockSparseMatrix BlockSparseMatrix;
+typedef minerva::matrix::ActivationFunction ActivationFunction;
 
 /*
 	A simple matrix test
@@ -421,6 +427,104 @@ bool testSparseConvolutionalAddBroadcastRow()
 	return computed == c;
 }
 
+bool isClose(const BlockSparseMatrix& left, const BlockSparseMatrix& right)
+{
+	auto leftMatrix  = left.toMatrix();
+	auto rightMatrix = right.toMatrix();
+	
+	if(leftMatrix.rows() != rightMatrix.rows() ||
+		leftMatrix.columns() != rightMatrix.columns())
+	{
+		return false;
+	}
+	
+	for(size_t i = 0; i < leftMatrix.data().size(); ++i)
+	{
+		// the device sigmoid uses a fast approximate exp
+		if(std::fabs(leftMatrix.data()[i] - rightMatrix.data()[i]) > 1.0e-4f)
+		{
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+/*
+	Adding a broadcast bias, applying each activation, and its derivative,
+	in one pass should match the separate operations.
+*/
+bool testSparseAddBiasAndActivate()
+{
+	std::default_random_engine engine;
+	
+	BlockSparseMatrix a(4, 3, 5, false);
+	BlockSparseMatrix bias(2, 1, 5, false);
+	
+	a.assignUniformRandomValues(engine, -3.0f, 3.0f);
+	bias.assignUniformRandomValues(engine, -1.0f, 1.0f);
+	
+	const ActivationFunction::Type types[] = {ActivationFunction::Sigmoid,
+		ActivationFunction::RectifiedLinear,
+		ActivationFunction::LeakyRectifiedLinear,
+		ActivationFunction::HardSigmoid, ActivationFunction::Tanh};
+	
+	bool passed = true;
+	
+	for(auto type : types)
+	{
+		auto reference = a.convolutionalAddBroadcastRow(bias);
+		
+		for(auto& block : reference)
+		{
+			for(auto& value : block.data())
+			{
+				value = ActivationFunction::apply(type, value);
+			}
+		}
+		
+		auto referenceDerivative = reference;
+		
+		for(auto& block : referenceDerivative)
+		{
+			for(auto& value : block.data())
+			{
+				value = ActivationFunction::applyDerivative(type, value);
+			}
+		}
+		
+		auto computed = a;
+		
+		BlockSparseMatrix computedDerivative;
+		
+		computed.addBiasAndActivateSelf(bias, type, computedDerivative);
+		
+		auto separateDerivative = computed;
+		
+		separateDerivative.activationDerivativeSelf(type);
+		
+		if(!isClose(computed, reference) ||
+			!isClose(computedDerivative, referenceDerivative) ||
+			!isClose(separateDerivative, referenceDerivative))
+		{
+			std::cout << " Block Sparse Matrix Add Bias And Activate Test Failed "
+				"for activation " << type << ":\n";
+			std::cout << "  result matrix " << computed.toMatrix().toString();
+			std::cout << "  does not match reference matrix "
+				<< reference.toMatrix().toString();
+			
+			passed = false;
+		}
+	}
+	
+	if(passed)
+	{
+		std::cout << " Block Sparse Matrix Add Bias And Activate Test Passed\n";
+	}
+	
+	return passed;
+}
+
 bool testSparseReduceTileSumAlongRows()
 {
 	BlockSparseMatrix a(4, 2, 2, true);
@@ -587,6 +691,94 @@ bool testSparseReduceSumAlongRows()
 	return computed == c;
 }
 
+/*
+	Each available int8 kernel against a naive multiply, with sizes that
+	exercise the row and column padding.
+*/
+bool testInt8Multiply()
+{
+	const size_t rows    = 5;
+	const size_t inner   = 37;
+	const size_t columns = 45;
+	
+	std::default_random_engine engine;
+	
+	std::uniform_int_distribution<int> aDistribution(0, 127);
+	std::uniform_int_distribution<int> bDistribution(-127, 127);
+	
+	std::vector<uint8_t> a(rows * inner);
+	std::vector<int8_t>  b(inner * columns);
+	
+	for(auto& value : a) value = aDistribution(engine);
+	for(auto& value : b) value = bDistribution(engine);
+	
+	std::vector<int32_t> reference(rows * columns, 0);
+	
+	for(size_t row = 0; row < rows; ++row)
+	{
+		for(size_t column = 0; column < columns; ++column)
+		{
+			for(size_t i = 0; i < inner; ++i)
+			{
+				reference[row * columns + column] +=
+					a[row * inner + i] * b[i * columns + column];
+			}
+		}
+	}
+	
+	minerva::matrix::Int8Matrix packed(b.data(), inner, columns);
+	
+	// the kernels read whole groups of four rows
+	size_t stride = packed.paddedRows();
+	
+	std::vector<uint8_t> paddedA(rows * stride, 0);
+	
+	for(size_t row = 0; row < rows; ++row)
+	{
+		std::copy(a.begin() + row * inner, a.begin() + (row + 1) * inner,
+			paddedA.begin() + row * stride);
+	}
+	
+	bool passed = true;
+	
+	const char* kernels[] = {"scalar", "avx2", "vnni"};
+	
+	for(auto kernel : kernels)
+	{
+		minerva::util::KnobDatabase::setKnob("Int8Matrix::Kernel", kernel);
+		
+		std::vector<int32_t> computed(rows * columns, 0);
+		
+		try
+		{
+			minerva::matrix::int8Multiply(computed.data(), columns,
+				paddedA.data(), stride, rows, packed);
+		}
+		catch(const std::exception& e)
+		{
+			std::cout << " Int8 Multiply Test skipped the " << kernel
+				<< " kernel: " << e.what() << "\n";
+			continue;
+		}
+		
+		if(computed != reference)
+		{
+			std::cout << " Int8 Multiply Test Failed for the " << kernel
+				<< " kernel\n";
+			passed = false;
+		}
+		else
+		{
+			std::cout << " Int8 Multiply Test Passed for the " << kernel
+				<< " kernel\n";
+		}
+	}
+	
+	minerva::util::KnobDatabase::setKnob("Int8Matrix::Kernel", "");
+	
+	return passed;
+}
+
 int main(int argc, char** argv)
 {
 	minerva::util::enableAllLogs();
@@ -602,9 +794,11 @@ int main(int argc, char** argv)
     passed &= testSparseConvolutionalMultiply();
     passed &= testSparseConvolutionalMultiply2();
     passed &= testSparseConvolutionalAddBroadcastRow();
+    passed &= testSparseAddBiasAndActivate();
     passed &= testSparseReduceTileSumAlongRows();
     passed &= testSparseReverseConvolutionalMultiply();
     passed &= testSparseReduceSumAlongRows();
+    passed &= testInt8Multiply();
 
 	if(not passed)
 	{
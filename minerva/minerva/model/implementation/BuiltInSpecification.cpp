@@ -54,7 +54,8 @@ std::string BuiltInSpecifications::getConvolutionalFastModelSpecification(size_t
 		"			{\n"
 		"				\"tiles\" : 128,\n"
 		"				\"inputsPerTile\" : 48,\n"
-		"				\"outputsPerTile\" : 12\n"
+		"				\"outputsPerTile\" : 12,\n"
+		"				\"pooling\" : \"max\"\n"
 		"			},\n"
 		"			{\n"
 		"				\"tiles\" : 32,\n"
@@ -12,13 +12,19 @@
 #include <minerva/matrix/interface/Matrix.h>
 
 #include <minerva/util/interface/TarArchive.h>
+#include <minerva/util/interface/MemoryMappedFile.h>
+#include <minerva/util/interface/Knobs.h>
 
 #include <minerva/util/interface/debug.h>
 #include <minerva/util/interface/json.h>
 
 // Standard Library Includes
 #include <sstream>
+#include <fstream>
 #include <map>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
 
 namespace minerva
 {
@@ -27,17 +33,76 @@ namespace model
 {
 
 Model::Model(const std::string& path)
-: _path(path), _loaded(false), _xPixels(0), _yPixels(0), _colors(3)
+: _path(path), _loaded(false), _xPixels(0), _yPixels(0), _colors(3),
+  _loadedBytes(0)
 {
 
 }
 
 Model::Model()
-: _path("unknown-path"), _loaded(true), _xPixels(0), _yPixels(0), _colors(3)
+: _path("unknown-path"), _loaded(true), _xPixels(0), _yPixels(0), _colors(3),
+  _loadedBytes(0)
 {
 
 }
 
+Model::Model(const Model& model)
+: _path(model._path), _loaded(model._loaded),
+  _neuralNetworks(model._neuralNetworks), _xPixels(model._xPixels),
+  _yPixels(model._yPixels), _colors(model._colors),
+  _attributes(model._attributes),
+  _pendingNeuralNetworks(model._pendingNeuralNetworks),
+  _mappedFile(model._mappedFile), _loadedBytes(model._loadedBytes)
+{
+	// the names must refer to the copied networks
+	for(auto& network : model._neuralNetworkMap)
+	{
+		auto position = _neuralNetworks.begin();
+		
+		std::advance(position, std::distance(
+			model._neuralNetworks.begin(), const_iterator(network.second)));
+		
+		_neuralNetworkMap.insert(std::make_pair(network.first, position));
+	}
+}
+
+Model& Model::operator=(const Model& model)
+{
+	if(&model == this)
+	{
+		return *this;
+	}
+	
+	Model copy(model);
+	
+	std::swap(_path,                  copy._path);
+	std::swap(_loaded,                copy._loaded);
+	std::swap(_neuralNetworks,        copy._neuralNetworks);
+	std::swap(_neuralNetworkMap,      copy._neuralNetworkMap);
+	std::swap(_xPixels,               copy._xPixels);
+	std::swap(_yPixels,               copy._yPixels);
+	std::swap(_colors,                copy._colors);
+	std::swap(_attributes,            copy._attributes);
+	std::swap(_pendingNeuralNetworks, copy._pendingNeuralNetworks);
+	std::swap(_mappedFile,            copy._mappedFile);
+	std::swap(_loadedBytes,           copy._loadedBytes);
+	
+	return *this;
+}
+
+const std::string& Model::path() const
+{
+	return _path;
+}
+
+void Model::setPath(const std::string& path)
+{
+	// networks that have not been loaded yet are read from the old path
+	_loadAllNeuralNetworks();
+	
+	_path = path;
+}
+
 const Model::NeuralNetwork& Model::getNeuralNetwork(
 	const std::string& name) const
 {
@@ -46,6 +111,9 @@ const Model::NeuralNetwork& Model::getNeuralNetwork(
 	assertM(network != _neuralNetworkMap.end(), "Invalid neural network name "
 		+ name);
 	
+	// reading the weights on demand does not change the logical contents
+	const_cast<Model*>(this)->_loadNeuralNetwork(name);
+	
 	return *network->second;
 }
 
@@ -57,6 +125,8 @@ Model::NeuralNetwork& Model::getNeuralNetwork(
 	assertM(network != _neuralNetworkMap.end(), "Invalid neural network name "
 		+ name);
 	
+	_loadNeuralNetwork(name);
+	
 	return *network->second;
 }
 
@@ -65,11 +135,51 @@ bool Model::containsNeuralNetwork(const std::string& name) const
 	return _neuralNetworkMap.count(name) != 0;
 }
 
+Model::StringVector Model::getNeuralNetworkNames() const
+{
+	StringVector names;
+	
+	for(auto& network : _neuralNetworkMap)
+	{
+		names.push_back(network.first);
+	}
+	
+	return names;
+}
+
+void Model::setAttribute(const std::string& name, const std::string& value)
+{
+	// attributes are stored as json strings without escapes
+	assertM(value.find_first_of("\"\\\n") == std::string::npos,
+		"Model attribute " + name + " contains characters that can't be saved.");
+	
+	_attributes[name] = value;
+}
+
+std::string Model::getAttribute(const std::string& name) const
+{
+	auto attribute = _attributes.find(name);
+	
+	if(attribute == _attributes.end())
+	{
+		return "";
+	}
+	
+	return attribute->second;
+}
+
+bool Model::hasAttribute(const std::string& name) const
+{
+	return _attributes.count(name) != 0;
+}
+
 void Model::setNeuralNetwork(
 	const std::string& name, const NeuralNetwork& n)
 {
 	assert(n.areConnectionsValid());
 	
+	_pendingNeuralNetworks.erase(name);
+	
 	if(!containsNeuralNetwork(name))
 	{
 		_neuralNetworkMap[name] = _neuralNetworks.insert(_neuralNetworks.end(), n);
@@ -103,11 +213,318 @@ unsigned int Model::colors() const
 	return _colors;
 }
 
+/*
+	The mapped format is a single uncompressed file laid out as:
+	
+		MappedModelHeader
+		json header (matrices are referenced by tensor table index strings)
+		TensorTableEntry[tensors]
+		raw float payloads, each aligned to MappedModelAlignment bytes
+*/
+static const char   MappedModelMagic[8]  = {'M','N','R','V','M','D','L','1'};
+static const uint32_t MappedModelVersion = 1;
+static const uint64_t MappedModelAlignment = 64;
+
+struct MappedModelHeader
+{
+	char     magic[8];
+	uint32_t version;
+	uint32_t alignment;
+	uint64_t headerOffset;
+	uint64_t headerSize;
+	uint64_t tableOffset;
+	uint64_t tensors;
+	uint64_t reserved[2];
+};
+
+struct TensorTableEntry
+{
+	uint64_t rows;
+	uint64_t columns;
+	uint64_t offset;
+	uint64_t reserved;
+};
+
+static_assert(sizeof(MappedModelHeader) == 64, "Unexpected padding.");
+static_assert(sizeof(TensorTableEntry)  == 32, "Unexpected padding.");
+
+static uint64_t align(uint64_t offset)
+{
+	return ((offset + MappedModelAlignment - 1) / MappedModelAlignment) *
+		MappedModelAlignment;
+}
+
+static void pad(std::ostream& stream, uint64_t& offset)
+{
+	uint64_t aligned = align(offset);
+	
+	for(; offset < aligned; ++offset)
+	{
+		stream.put('\0');
+	}
+}
+
+static bool isMappedModel(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	
+	char magic[sizeof(MappedModelMagic)];
+	
+	file.read(magic, sizeof(magic));
+	
+	if(file.gcount() != sizeof(magic)) return false;
+	
+	return std::memcmp(magic, MappedModelMagic, sizeof(magic)) == 0;
+}
+
+static const MappedModelHeader& getMappedModelHeader(
+	const util::MemoryMappedFile& file)
+{
+	if(file.size() < sizeof(MappedModelHeader))
+	{
+		throw std::runtime_error("Mapped model '" + file.path() +
+			"' is truncated.");
+	}
+	
+	auto header = reinterpret_cast<const MappedModelHeader*>(file.data());
+	
+	if(header->version != MappedModelVersion)
+	{
+		throw std::runtime_error("Mapped model '" + file.path() +
+			"' has an unsupported version.");
+	}
+	
+	if(header->alignment != MappedModelAlignment)
+	{
+		throw std::runtime_error("Mapped model '" + file.path() +
+			"' has an unsupported alignment.");
+	}
+	
+	// the sizes are untrusted, compare them without overflowing
+	if(header->headerOffset > file.size() ||
+		header->headerSize > file.size() - header->headerOffset ||
+		header->tableOffset > file.size() ||
+		header->tensors > (file.size() - header->tableOffset) /
+		sizeof(TensorTableEntry))
+	{
+		throw std::runtime_error("Mapped model '" + file.path() +
+			"' is truncated.");
+	}
+	
+	return *header;
+}
+
+static uint64_t getTensorBytes(uint64_t rows, uint64_t columns,
+	const std::string& path)
+{
+	if(columns != 0 && rows > std::numeric_limits<uint64_t>::max() /
+		sizeof(float) / columns)
+	{
+		throw std::runtime_error("Model '" + path +
+			"' has a tensor that is too large.");
+	}
+	
+	return rows * columns * sizeof(float);
+}
+
 void Model::save() const
 {
-	typedef matrix::Matrix Matrix;
-	typedef std::map<std::string, const Matrix*> MatrixMap;
+	std::string format = util::KnobDatabase::getKnobValue(
+		"Model::SaveFormat", "archive");
+	
+	if(format == "mapped")
+	{
+		save(MappedFormat);
+	}
+	else if(format == "archive")
+	{
+		save(ArchiveFormat);
+	}
+	else
+	{
+		throw std::runtime_error("Invalid model save format '" + format + "'.");
+	}
+}
+
+void Model::save(Format format) const
+{
+	// the file being written may be the one that weights are read from
+	const_cast<Model*>(this)->_loadAllNeuralNetworks();
+	
+	if(format == MappedFormat)
+	{
+		_saveMapped();
+	}
+	else
+	{
+		_saveArchive();
+	}
+}
+
+std::future<void> Model::saveAsynchronously() const
+{
+	const_cast<Model*>(this)->_loadAllNeuralNetworks();
 	
+	// the snapshot owns copies of the weights, so training may continue
+	auto snapshot = std::make_shared<Model>(*this);
+	
+	util::log("Model") << "Saving snapshot of '" << _path
+		<< "' in the background\n";
+	
+	return std::async(std::launch::async, [snapshot]()
+	{
+		snapshot->save();
+	});
+}
+
+void Model::load()
+{
+	if(_loaded) return;
+	
+	_loaded = true;
+	
+	clear();
+	
+	util::log("Model") << "Loading classification-model from '"
+		<< _path << "'\n";
+	
+	try
+	{
+		if(isMappedModel(_path))
+		{
+			_mappedFile.reset(new util::MemoryMappedFile(_path));
+			
+			auto& mappedHeader = getMappedModelHeader(*_mappedFile);
+			
+			// parse the header in place
+			_loadHeader(_mappedFile->data() + mappedHeader.headerOffset,
+				mappedHeader.headerSize);
+		}
+		else
+		{
+			std::stringstream header;
+			
+			util::TarArchive tar(_path, "r:gz");
+	
+			tar.extractFile("model.json", header);
+			
+			auto text = header.str();
+			
+			_loadHeader(text.data(), text.size());
+		}
+		
+		if(!util::KnobDatabase::getKnobValue("Model::LazyLoading", true))
+		{
+			_loadAllNeuralNetworks();
+		}
+	}
+	catch(...)
+	{
+		clear();
+		
+		_loaded = false;
+		
+		throw;
+	}
+}
+
+Model::StringVector Model::getLoadedNeuralNetworkNames() const
+{
+	StringVector names;
+	
+	for(auto& network : _neuralNetworkMap)
+	{
+		if(_pendingNeuralNetworks.count(network.first) == 0)
+		{
+			names.push_back(network.first);
+		}
+	}
+	
+	return names;
+}
+
+size_t Model::getLoadedBytes() const
+{
+	return _loadedBytes;
+}
+
+void Model::clear()
+{
+	_neuralNetworks.clear();
+	_neuralNetworkMap.clear();
+	_pendingNeuralNetworks.clear();
+	_attributes.clear();
+	
+	_mappedFile.reset();
+}
+	
+Model::iterator Model::begin()
+{
+	_loadAllNeuralNetworks();
+	
+	return _neuralNetworks.begin();
+}
+
+Model::const_iterator Model::begin() const
+{
+	const_cast<Model*>(this)->_loadAllNeuralNetworks();
+	
+	return _neuralNetworks.begin();
+}
+
+Model::iterator Model::end()
+{
+	return _neuralNetworks.end();
+}
+
+Model::const_iterator Model::end() const
+{
+	return _neuralNetworks.end();
+}
+
+Model::reverse_iterator Model::rbegin()
+{
+	_loadAllNeuralNetworks();
+	
+	return _neuralNetworks.rbegin();
+}
+
+Model::const_reverse_iterator Model::rbegin() const
+{
+	const_cast<Model*>(this)->_loadAllNeuralNetworks();
+	
+	return _neuralNetworks.rbegin();
+}
+
+Model::reverse_iterator Model::rend()
+{
+	return _neuralNetworks.rend();
+}
+
+Model::const_reverse_iterator Model::rend() const
+{
+	return _neuralNetworks.rend();
+}
+
+static std::string getMatrixReference(const std::string& filename,
+	size_t index, bool referenceByIndex)
+{
+	// references are always strings, the parser packs arrays of numbers
+	if(!referenceByIndex)
+	{
+		return "\"" + filename + "\"";
+	}
+
+	std::stringstream stream;
+	
+	stream << "\"" << index << "\"";
+	
+	return stream.str();
+}
+
+std::string Model::_getHeader(ConstMatrixPointerVector& matrices,
+	StringVector& filenames, bool referenceByIndex) const
+{
 	std::stringstream stream;
 	
 	stream << "{\n";
@@ -120,10 +537,26 @@ void Model::save() const
 	stream << "\t\"colors\": "  << colors()  << ",\n";
 
 	stream << "\n";
+	
+	stream << "\t\"attributes\": {";
+	
+	for(auto attribute = _attributes.begin();
+		attribute != _attributes.end(); ++attribute)
+	{
+		if(attribute != _attributes.begin())
+		{
+			stream << ",";
+		}
+		
+		stream << "\n\t\t\"" << attribute->first << "\": \""
+			<< attribute->second << "\"";
+	}
+	
+	stream << "},\n";
 
-	stream << "\t\"neuralnetworks\" : [\n";
+	stream << "\n";
 
-	MatrixMap filenameToMatrices;
+	stream << "\t\"neuralnetworks\" : [\n";
 
 	for(auto network = _neuralNetworkMap.begin();
 		network != _neuralNetworkMap.end(); ++network)
@@ -162,6 +595,26 @@ void Model::save() const
 			
 			stream << "\t\t\t\t\t\"name\": \"layer" << index << "\",\n";
 			stream << "\t\t\t\t\t\"step\": " << layer->blockStep() << ",\n";
+			
+			if(layer->isWeightShared())
+			{
+				stream << "\t\t\t\t\t\"sharedTiles\": " << layer->tiles() << ",\n";
+			}
+			
+			if(!layer->isPooling() && layer->getActivation() != neuralnetwork::Layer::Sigmoid)
+			{
+				stream << "\t\t\t\t\t\"activation\": \""
+					<< layer->getActivationName() << "\",\n";
+			}
+			
+			if(layer->isPooling())
+			{
+				stream << "\t\t\t\t\t\"pooling\": \"" << layer->getPoolingName() << "\",\n";
+				stream << "\t\t\t\t\t\"tiles\": " << layer->tiles() << ",\n";
+				stream << "\t\t\t\t\t\"outputsPerTile\": "
+					<< layer->getOutputBlockingFactor() << ",\n";
+			}
+			
 			stream << "\t\t\t\t\t\"weights\" : [\n";
 			
 			for(auto matrix = layer->begin(); matrix != layer->end(); ++matrix)
@@ -179,10 +632,11 @@ void Model::save() const
 				filename << network->first << "-layer" << index
 					<< "-matrix" << matrixIndex << ".bin";
 			
-				stream << "\t\t\t\t\t\t\"" << filename.str() << "\"";
+				stream << "\t\t\t\t\t\t" << getMatrixReference(filename.str(),
+					matrices.size(), referenceByIndex);
 				
-				filenameToMatrices.insert(
-					std::make_pair(filename.str(), &*matrix));
+				matrices.push_back(&*matrix);
+				filenames.push_back(filename.str());
 			}
 
 			stream << "],\n";
@@ -203,11 +657,11 @@ void Model::save() const
 				filename << network->first << "-layer" << index
 					<< "-bias-matrix" << matrixIndex << ".bin";
 			
-				stream << "\t\t\t\t\t\t\"" << filename.str() << "\"";
+				stream << "\t\t\t\t\t\t" << getMatrixReference(filename.str(),
+					matrices.size(), referenceByIndex);
 				
-				filenameToMatrices.insert(
-					std::make_pair(filename.str(), &*matrix));
-
+				matrices.push_back(&*matrix);
+				filenames.push_back(filename.str());
 			}
 			
 			stream << "]\n";
@@ -241,245 +695,426 @@ void Model::save() const
 
 	stream << "}\n";
 	
-	util::TarArchive tar(_path, "w:gz");
+	return stream.str();
+}
+
+void Model::_saveArchive() const
+{
+	ConstMatrixPointerVector matrices;
+	StringVector             filenames;
 	
-	tar.addFile("model.json", stream);
+	std::string header = _getHeader(matrices, filenames, false);
 	
-	for(auto matrix : filenameToMatrices)
+	std::string compression = util::KnobDatabase::getKnobValue(
+		"Model::ArchiveCompression", "gzip");
+	
+	if(compression != "gzip" && compression != "zstd")
 	{
-		std::stringstream stream;
-		
-		uint64_t rows    = matrix.second->rows();
-		uint64_t columns = matrix.second->columns();
+		throw std::runtime_error("Invalid model archive compression '" +
+			compression + "'.");
+	}
+	
+	util::TarArchive tar(_path, compression == "zstd" ? "w:zst" : "w:gz");
+	
+	tar.addFile("model.json",
+		{util::TarArchive::Buffer(header.data(), header.size())});
+	
+	for(size_t index = 0; index != matrices.size(); ++index)
+	{
+		auto matrix = matrices[index];
 		
-		stream.write((const char*)&rows,    sizeof(uint64_t));
-		stream.write((const char*)&columns, sizeof(uint64_t));
-
-		auto data = matrix.second->data();
-
-		stream.write((const char*)data.data(), matrix.second->size() * sizeof(float));
+		uint64_t rows    = matrix->rows();
+		uint64_t columns = matrix->columns();
 		
-		tar.addFile(matrix.first, stream);
+		// the payload is written straight from the matrix storage
+		tar.addFile(filenames[index], {
+			util::TarArchive::Buffer(&rows,    sizeof(uint64_t)),
+			util::TarArchive::Buffer(&columns, sizeof(uint64_t)),
+			util::TarArchive::Buffer(matrix->data().data(),
+				matrix->size() * sizeof(float))});
 	}
 }
 
-void Model::load()
+void Model::_saveMapped() const
 {
-	if(_loaded) return;
+	ConstMatrixPointerVector matrices;
+	StringVector             filenames;
 	
-	_loaded = true;
+	std::string json = _getHeader(matrices, filenames, true);
 	
-	_neuralNetworks.clear();
+	MappedModelHeader header;
 	
-	util::log("Model") << "Loading classification-model from '"
-		<< _path << "'\n";
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, MappedModelMagic, sizeof(header.magic));
+	
+	header.version      = MappedModelVersion;
+	header.alignment    = MappedModelAlignment;
+	header.headerOffset = sizeof(MappedModelHeader);
+	header.headerSize   = json.size();
+	header.tableOffset  = align(header.headerOffset + header.headerSize);
+	header.tensors      = matrices.size();
+	
+	std::vector<TensorTableEntry> table(matrices.size());
+	
+	uint64_t offset = align(header.tableOffset +
+		table.size() * sizeof(TensorTableEntry));
+	
+	for(size_t index = 0; index != matrices.size(); ++index)
+	{
+		auto& entry = table[index];
+		
+		std::memset(&entry, 0, sizeof(entry));
+		
+		entry.rows    = matrices[index]->rows();
+		entry.columns = matrices[index]->columns();
+		entry.offset  = offset;
+		
+		offset = align(offset + entry.rows * entry.columns * sizeof(float));
+	}
+	
+	std::ofstream file(_path, std::ios::binary | std::ios::trunc);
+	
+	if(!file.is_open())
+	{
+		throw std::runtime_error("Failed to open '" + _path +
+			"' for writing.");
+	}
+	
+	uint64_t position = 0;
+	
+	file.write((const char*)&header, sizeof(header));
+	position += sizeof(header);
+	
+	file.write(json.data(), json.size());
+	position += json.size();
 	
-	util::TarArchive tar(_path, "r:gz");
+	pad(file, position);
 	
-	std::stringstream header;
+	file.write((const char*)table.data(), table.size() * sizeof(TensorTableEntry));
+	position += table.size() * sizeof(TensorTableEntry);
 	
-	tar.extractFile("model.json", header);
+	for(size_t index = 0; index != matrices.size(); ++index)
+	{
+		pad(file, position);
+		
+		assert(position == table[index].offset);
+		
+		auto& data = matrices[index]->data();
+		
+		file.write((const char*)data.data(), data.size() * sizeof(float));
+		position += data.size() * sizeof(float);
+	}
+	
+	if(!file.good())
+	{
+		throw std::runtime_error("Failed to write model to '" + _path + "'.");
+	}
+	
+	util::log("Model") << "Saved mapped model with " << matrices.size()
+		<< " tensors (" << position << " bytes) to '" << _path << "'\n";
+}
+
+class Model::PendingNeuralNetwork
+{
+public:
+	class PendingLayer
+	{
+	public:
+		size_t       step;
+		size_t       sharedTiles;
+		std::string  pooling;
+		std::string  activation;
+		size_t       tiles;
+		size_t       outputsPerTile;
+		StringVector weights;
+		StringVector biases;
+	};
+	
+	typedef std::vector<PendingLayer> PendingLayerVector;
+
+public:
+	std::string        costFunction;
+	PendingLayerVector layers;
+	StringVector       outputNames;
+
+};
+
+void Model::_loadHeader(const char* data, size_t size)
+{
+	util::json::Document document;
 	
-	util::json::Parser parser;
-	auto headerObject = parser.parse_object(header);
+	auto headerObject = document.parse(data, size);
 
 	util::log("Model") << " loading header\n";
 	
-	try
+	util::json::Visitor headerVisitor(headerObject);
+	
+	_xPixels = (int) headerVisitor["xPixels"];		
+	_yPixels = (int) headerVisitor["yPixels"];	
+	_colors  = (int) headerVisitor["colors" ];
+
+	util::log("Model") << "  (" << _xPixels << " xPixels, "
+		<< _yPixels << " yPixels, " << _colors << " colors)\n";
+	
+	// older models do not have attributes
+	auto& header = headerObject->as_object();
+	
+	auto attributes = header.find("attributes");
+	
+	if(attributes != header.end())
 	{
-		util::json::Visitor headerVisitor(headerObject);
-		
-		_xPixels = (int) headerVisitor["xPixels"];		
-		_yPixels = (int) headerVisitor["yPixels"];	
-		_colors  = (int) headerVisitor["colors" ];
+		for(auto& attribute : attributes->second->as_object())
+		{
+			_attributes[attribute.first] =
+				(std::string)util::json::Visitor(attribute.second);
+		}
+	}
+	
+	util::json::Visitor networksVisitor(
+		headerVisitor["neuralnetworks"]);		
 
-		util::log("Model") << "  (" << _xPixels << " xPixels, "
-			<< _yPixels << " yPixels, " << _colors << " colors)\n";
+	for(auto networkObject = networksVisitor.begin_array();
+		networkObject != networksVisitor.end_array(); ++networkObject)
+	{
+		util::json::Visitor networkVisitor(*networkObject);
 		
-		util::json::Visitor networksVisitor(
-			headerVisitor["neuralnetworks"]);		
-	
-		for(auto networkObject = networksVisitor.begin_array();
-			networkObject != networksVisitor.end_array(); ++networkObject)
+		std::string name = networkVisitor["name"];
+		
+		util::log("Model") << "  neural network '"
+			<< name << "'\n";
+		
+		auto pending = std::make_shared<PendingNeuralNetwork>();
+		
+		pending->costFunction = (std::string)networkVisitor["costFunction"];
+		
+		util::json::Visitor layersVisitor(networkVisitor["layers"]);	
+		
+		for(auto layerObject = layersVisitor.begin_array();
+			layerObject != layersVisitor.end_array(); ++layerObject)
 		{
-			util::json::Visitor networkVisitor(*networkObject);
+			util::json::Visitor layerVisitor(*layerObject);
 			
-			std::string name = networkVisitor["name"];
-			std::string costFunctionType = networkVisitor["costFunction"];
-
-			util::log("Model") << "  neural network '"
-				<< name << "'\n";
+			pending->layers.push_back(PendingNeuralNetwork::PendingLayer());
 			
-			util::json::Visitor layersVisitor(networkVisitor["layers"]);	
+			auto& layer = pending->layers.back();
 			
-			auto network = _neuralNetworks.insert(_neuralNetworks.end(),
-				NeuralNetwork());
-			_neuralNetworkMap.insert(std::make_pair(name, network));
-		
-            if(costFunctionType == "sparse")
-            {
-                network->setUseSparseCostFunction(true);
-            }
-            else
-            {
-                network->setUseSparseCostFunction(false);
-            }
-
-			for(auto layerObject = layersVisitor.begin_array();
-				layerObject != layersVisitor.end_array(); ++layerObject)
+			layer.step = (int)layerVisitor["step"];
+			
+			// older models do not share weights
+			layer.sharedTiles = 0;
+			
+			if(layerVisitor.find("sharedTiles") != 0)
 			{
-				network->addLayer(neuralnetwork::Layer());
-				
-				auto& layer = network->back();
+				layer.sharedTiles = (int)layerVisitor["sharedTiles"];
+			}
+			
+			// older models only use the sigmoid
+			layer.activation = "sigmoid";
+			
+			if(layerVisitor.find("activation") != 0)
+			{
+				layer.activation = (std::string)layerVisitor["activation"];
+			}
+			
+			// pooling layers have no weights to infer their shape from
+			layer.tiles          = 0;
+			layer.outputsPerTile = 0;
+			
+			if(layerVisitor.find("pooling") != 0)
+			{
+				layer.pooling        = (std::string)layerVisitor["pooling"];
+				layer.tiles          = (int)layerVisitor["tiles"];
+				layer.outputsPerTile = (int)layerVisitor["outputsPerTile"];
+			}
+			
+			util::json::Visitor weightsVisitor(layerVisitor["weights"]);	
 				
-				util::json::Visitor layerVisitor(*layerObject);
-
-				util::log("Model") << "   layer "
-					<< (std::string)layerVisitor["name"] << "\n";
+			for(auto weightMatrixObject = weightsVisitor.begin_array();
+				weightMatrixObject != weightsVisitor.end_array();
+				++weightMatrixObject)
+			{
+				layer.weights.push_back(
+					util::json::Visitor(*weightMatrixObject));
+			}
+			
+			util::json::Visitor biasesVisitor(layerVisitor["biases"]);	
+		
+			for(auto biasMatrixObject = biasesVisitor.begin_array();
+				biasMatrixObject != biasesVisitor.end_array();
+				++biasMatrixObject)
+			{
+				layer.biases.push_back(
+					util::json::Visitor(*biasMatrixObject));
+			}
+		}
+		
+		util::json::Visitor outputsVisitor(networkVisitor["output-names"]);	
+		
+		for(auto outputObject = outputsVisitor.begin_array();
+			outputObject != outputsVisitor.end_array(); ++outputObject)
+		{
+			pending->outputNames.push_back(
+				util::json::Visitor(*outputObject));
+		}
+		
+		_neuralNetworkMap.insert(std::make_pair(name,
+			_neuralNetworks.insert(_neuralNetworks.end(), NeuralNetwork())));
+		_pendingNeuralNetworks.insert(std::make_pair(name, pending));
+	}
+}
 
-				size_t step = (int)layerVisitor["step"];
+void Model::_loadNeuralNetwork(const std::string& name)
+{
+	auto pending = _pendingNeuralNetworks.find(name);
+	
+	if(pending == _pendingNeuralNetworks.end()) return;
+	
+	auto& network = *_neuralNetworkMap[name];
+	
+	size_t previouslyLoadedBytes = _loadedBytes;
+	
+	if(_mappedFile)
+	{
+		auto& file   = *_mappedFile;
+		auto& header = getMappedModelHeader(file);
 		
-				layer.setBlockStep(step);
-				
-				util::json::Visitor matrixArrayVisitor(layerVisitor["weights"]);	
-					
-				for(auto weightMatrixObject = matrixArrayVisitor.begin_array();
-					weightMatrixObject != matrixArrayVisitor.end_array();
-					++weightMatrixObject)
-				{
-					util::json::Visitor weightMatrixVisitor(
-						*weightMatrixObject);
-					
-					std::string filename = weightMatrixVisitor;
-					
-					std::stringstream stream;
-					
-					tar.extractFile(filename, stream);
-					
-					uint64_t rows    = 0;
-					uint64_t columns = 0;
-					
-					stream.read((char*)&rows,    sizeof(uint64_t));
-					stream.read((char*)&columns, sizeof(uint64_t));
-
-					util::log("Model") << "    matrix(" << rows
-						<< " rows, " << columns << " columns)\n";
-					
-					layer.push_back(matrix::Matrix());
-					
-					auto& matrix = layer.back();
-					
-					matrix.resize(rows, columns);
-					
-					stream.read((char*)matrix.data().data(), rows * columns * sizeof(float));
-				}
-				
-				matrixArrayVisitor = util::json::Visitor(layerVisitor["biases"]);	
+		auto table = reinterpret_cast<const TensorTableEntry*>(
+			file.data() + header.tableOffset);
+		
+		_loadNeuralNetwork(network, *pending->second,
+			[&](matrix::Matrix& matrix, const std::string& reference)
+		{
+			uint64_t index = std::stoull(reference);
 			
-				for(auto weightMatrixObject = matrixArrayVisitor.begin_array();
-					weightMatrixObject != matrixArrayVisitor.end_array();
-					++weightMatrixObject)
-				{
-					util::json::Visitor weightMatrixVisitor(
-						*weightMatrixObject);
-					
-					std::string filename = weightMatrixVisitor;
-					
-					std::stringstream stream;
-					
-					tar.extractFile(filename, stream);
-					
-					uint64_t rows    = 0;
-					uint64_t columns = 0;
-					
-					stream.read((char*)&rows,    sizeof(uint64_t));
-					stream.read((char*)&columns, sizeof(uint64_t));
-
-					util::log("Model") << "    bias matrix(" << rows
-						<< " rows, " << columns << " columns)\n";
-					
-					layer.push_back_bias(matrix::Matrix());
-					
-					auto& matrix = layer.back_bias();
-					
-					matrix.resize(rows, columns);
-					
-					stream.read((char*)matrix.data().data(), rows * columns * sizeof(float));
-				}
+			if(index >= header.tensors)
+			{
+				throw std::runtime_error("Mapped model '" + _path +
+					"' references an invalid tensor.");
 			}
 			
-			util::json::Visitor outputsVisitor(networkVisitor["output-names"]);	
+			auto& entry = table[index];
+			
+			uint64_t bytes = getTensorBytes(entry.rows, entry.columns, _path);
 			
-			for(auto outputObject = outputsVisitor.begin_array();
-				outputObject != outputsVisitor.end_array(); ++outputObject)
+			if(entry.offset > file.size() || bytes > file.size() - entry.offset)
 			{
-				util::json::Visitor outputVisitor(*outputObject);
-				
-				network->setLabelForOutputNeuron(
-					std::distance(outputsVisitor.begin_array(), outputObject),
-					outputVisitor);
+				throw std::runtime_error("Mapped model '" + _path +
+					"' is truncated.");
 			}
 			
-		}
+			matrix.resize(entry.rows, entry.columns);
+			
+			std::memcpy(matrix.data().data(), file.data() + entry.offset,
+				bytes);
+		});
 	}
-	catch(...)
+	else
 	{
-		delete headerObject;
-		_loaded = false;
-	
-		throw;
+		util::TarArchive tar(_path, "r:gz");
+		
+		_loadNeuralNetwork(network, *pending->second,
+			[&](matrix::Matrix& matrix, const std::string& filename)
+		{
+			std::stringstream stream;
+			
+			tar.extractFile(filename, stream);
+			
+			uint64_t rows    = 0;
+			uint64_t columns = 0;
+			
+			stream.read((char*)&rows,    sizeof(uint64_t));
+			stream.read((char*)&columns, sizeof(uint64_t));
+			
+			uint64_t bytes = getTensorBytes(rows, columns, _path);
+			
+			if(!stream.good() || bytes != stream.str().size() -
+				2 * sizeof(uint64_t))
+			{
+				throw std::runtime_error("Model '" + _path + "' has a "
+					"truncated tensor '" + filename + "'.");
+			}
+			
+			matrix.resize(rows, columns);
+			
+			stream.read((char*)matrix.data().data(), bytes);
+		});
 	}
 	
-	delete headerObject;
-}
+	_pendingNeuralNetworks.erase(pending);
 	
-void Model::clear()
-{
-	_neuralNetworks.clear();
-}
+	util::log("Model") << "Loaded neural network '" << name << "' ("
+		<< (_loadedBytes - previouslyLoadedBytes) << " bytes) from '" << _path << "'\n";
 	
-Model::iterator Model::begin()
-{
-	return _neuralNetworks.begin();
-}
-
-Model::const_iterator Model::begin() const
-{
-	return _neuralNetworks.begin();
-}
-
-Model::iterator Model::end()
-{
-	return _neuralNetworks.end();
-}
-
-Model::const_iterator Model::end() const
-{
-	return _neuralNetworks.end();
-}
-
-Model::reverse_iterator Model::rbegin()
-{
-	return _neuralNetworks.rbegin();
-}
-
-Model::const_reverse_iterator Model::rbegin() const
-{
-	return _neuralNetworks.rbegin();
+	// nothing else will be read from the file
+	if(_pendingNeuralNetworks.empty())
+	{
+		_mappedFile.reset();
+	}
 }
 
-Model::reverse_iterator Model::rend()
+void Model::_loadAllNeuralNetworks()
 {
-	return _neuralNetworks.rend();
+	while(!_pendingNeuralNetworks.empty())
+	{
+		_loadNeuralNetwork(_pendingNeuralNetworks.begin()->first);
+	}
 }
 
-Model::const_reverse_iterator Model::rend() const
+void Model::_loadNeuralNetwork(NeuralNetwork& network,
+	const PendingNeuralNetwork& pending, const MatrixLoader& loader)
 {
-	return _neuralNetworks.rend();
+	network.setUseSparseCostFunction(pending.costFunction == "sparse");
+	
+	for(auto& pendingLayer : pending.layers)
+	{
+		if(!pendingLayer.pooling.empty())
+		{
+			network.addLayer(neuralnetwork::Layer(
+				neuralnetwork::Layer::getPoolingTypeForName(pendingLayer.pooling),
+				pendingLayer.tiles, pendingLayer.step, pendingLayer.outputsPerTile));
+			
+			continue;
+		}
+		
+		network.addLayer(neuralnetwork::Layer());
+		
+		auto& layer = network.back();
+		
+		layer.setBlockStep(pendingLayer.step);
+		layer.setSharedTiles(pendingLayer.sharedTiles);
+		layer.setActivation(neuralnetwork::Layer::getActivationForName(
+			pendingLayer.activation));
+		
+		for(auto& reference : pendingLayer.weights)
+		{
+			layer.push_back(matrix::Matrix());
+			
+			auto& matrix = layer.back();
+			
+			loader(matrix, reference);
+			
+			_loadedBytes += matrix.size() * sizeof(float);
+		}
+		
+		for(auto& reference : pendingLayer.biases)
+		{
+			layer.push_back_bias(matrix::Matrix());
+			
+			auto& matrix = layer.back_bias();
+			
+			loader(matrix, reference);
+			
+			_loadedBytes += matrix.size() * sizeof(float);
+		}
+	}
+	
+	for(unsigned int output = 0; output != pending.outputNames.size(); ++output)
+	{
+		network.setLabelForOutputNeuron(output, pending.outputNames[output]);
+	}
 }
 
 }
 
 }
 
-
@@ -33,7 +33,7 @@ private:
 	
 
 private:
-	std::unique_ptr<util::json::Object> _specification;
+	util::json::Document _specification;
 
 	std::default_random_engine _randomEngine;
 };
@@ -67,18 +67,14 @@ ModelSpecificationImplementation::ModelSpecificationImplementation()
 
 void ModelSpecificationImplementation::parseSpecification(const std::string& specification)
 {
-	util::json::Parser parser;
-
-	std::stringstream jsonStream(specification);
-
-	_specification.reset(parser.parse_object(jsonStream));
+	_specification.parse(specification);
 }
 
 void ModelSpecificationImplementation::initializeModel(Model& model)
 {
 	model.clear();
 	
-	util::json::Visitor objectVisitor(_specification.get());
+	util::json::Visitor objectVisitor(_specification.root());
 	
 	if(objectVisitor.find("xPixels") == 0)
 	{
@@ -212,7 +208,39 @@ void ModelSpecificationImplementation::initializeModel(Model& model)
 				tileSpacing = (int)layerVisitor["tileSpacing"];
 			}
 			
-			network.addLayer(neuralnetwork::Layer(tiles, inputsPerTile, outputsPerTile, tileSpacing));
+			if(layerVisitor.find("pooling") != 0)
+			{
+				auto type = neuralnetwork::Layer::getPoolingTypeForName(
+					(std::string)layerVisitor["pooling"]);
+				
+				if(outputsPerTile == 0 || inputsPerTile % outputsPerTile != 0)
+				{
+					throw std::runtime_error("Pooling layer 'inputsPerTile' must "
+						"be a multiple of 'outputsPerTile'.");
+				}
+				
+				network.addLayer(neuralnetwork::Layer(type, tiles, inputsPerTile,
+					outputsPerTile));
+				
+				continue;
+			}
+			
+			// one filter bank applied at every tile, rather than one per tile
+			bool sharedWeights = false;
+			
+			if(layerVisitor.find("sharedWeights") != 0)
+			{
+				sharedWeights = (bool)layerVisitor["sharedWeights"];
+			}
+			
+			network.addLayer(neuralnetwork::Layer(tiles, inputsPerTile, outputsPerTile, tileSpacing,
+				sharedWeights));
+			
+			if(layerVisitor.find("activation") != 0)
+			{
+				network.back().setActivation(neuralnetwork::Layer::getActivationForName(
+					(std::string)layerVisitor["activation"]));
+			}
 		}
 		
 		if(networkObject == --networksVisitor.end_array())
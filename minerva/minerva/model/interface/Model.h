@@ -13,6 +13,13 @@
 #include <string>
 #include <map>
 #include <list>
+#include <vector>
+#include <functional>
+#include <memory>
+#include <future>
+
+// Forward Declarations
+namespace minerva { namespace util { class MemoryMappedFile; } }
 
 namespace minerva
 {
@@ -29,17 +36,42 @@ public:
 	typedef NeuralNetworkList::const_iterator const_iterator;
 	typedef NeuralNetworkList::reverse_iterator reverse_iterator;
 	typedef NeuralNetworkList::const_reverse_iterator const_reverse_iterator;
+	typedef std::vector<std::string> StringVector;
+
+public:
+	/*! \brief The on-disk container used to store a model */
+	enum Format
+	{
+		ArchiveFormat, // compressed tar of json and matrix files
+		MappedFormat   // single uncompressed file that can be mapped
+	};
 
 public:
 	Model(const std::string& path);
 	Model();
 
+public:
+	Model(const Model& );
+	Model& operator=(const Model& );
+
+public:
+	const std::string& path() const;
+	void setPath(const std::string& path);
+
 public:
 	const NeuralNetwork& getNeuralNetwork(const std::string& name) const;
 	NeuralNetwork&  getNeuralNetwork(const std::string& name);
 
 public:
 	bool containsNeuralNetwork(const std::string& name) const;
+	StringVector getNeuralNetworkNames() const;
+
+public:
+	/*! \brief Attach a named string that is saved along with the model */
+	void setAttribute(const std::string& name, const std::string& value);
+	/*! \brief Get a saved attribute, or an empty string if it is not set */
+	std::string getAttribute(const std::string& name) const;
+	bool hasAttribute(const std::string& name) const;
 
 public:
 	void setNeuralNetwork(const std::string& name, const NeuralNetwork& n);
@@ -51,9 +83,24 @@ public:
 	unsigned int colors()  const;
 
 public:
+	/*! \brief Save using the format selected by Model::SaveFormat */
 	void save() const;
+	void save(Format format) const;
+	/*! \brief Snapshot the weights and save them on a background thread */
+	std::future<void> saveAsynchronously() const;
+	/*! \brief Load from either format, detected from the file contents.
+	
+		Only the header is read up front, the weights of each network are
+		read the first time that the network is accessed.
+	*/
 	void load();
 
+public:
+	/*! \brief Get the names of networks whose weights have been read */
+	StringVector getLoadedNeuralNetworkNames() const;
+	/*! \brief Get the number of weight bytes read from disk so far */
+	size_t getLoadedBytes() const;
+
 public:
 	void clear();
 
@@ -71,12 +118,39 @@ public:
 	reverse_iterator       rend();
 	const_reverse_iterator rend() const;
 
+private:
+	typedef std::vector<const matrix::Matrix*> ConstMatrixPointerVector;
+	typedef std::function<void(matrix::Matrix&,
+		const std::string&)> MatrixLoader;
+
+private:
+	std::string _getHeader(ConstMatrixPointerVector& matrices,
+		StringVector& filenames, bool referenceByIndex) const;
+	void _saveArchive() const;
+	void _saveMapped() const;
+	
+private:
+	class PendingNeuralNetwork;
+
+	typedef std::shared_ptr<PendingNeuralNetwork> PendingNeuralNetworkPointer;
+	typedef std::map<std::string, PendingNeuralNetworkPointer>
+		PendingNeuralNetworkMap;
+	typedef std::shared_ptr<util::MemoryMappedFile> MemoryMappedFilePointer;
+
+private:
+	void _loadHeader(const char* data, size_t size);
+	void _loadNeuralNetwork(const std::string& name);
+	void _loadAllNeuralNetworks();
+	void _loadNeuralNetwork(NeuralNetwork& network,
+		const PendingNeuralNetwork& pending, const MatrixLoader& loader);
+
 private:
 	std::string _path;
 	bool        _loaded;
 
 private:
 	typedef std::map<std::string, iterator> NeuralNetworkMap;
+	typedef std::map<std::string, std::string> AttributeMap;
 
 private:
 	NeuralNetworkList _neuralNetworks;
@@ -86,6 +160,13 @@ private:
 	unsigned int _yPixels;
 	unsigned int _colors;
 
+	AttributeMap _attributes;
+
+private:
+	PendingNeuralNetworkMap _pendingNeuralNetworks;
+	MemoryMappedFilePointer _mappedFile;
+	size_t                  _loadedBytes;
+
 };
 
 }
@@ -0,0 +1,326 @@
+/*! \file   test-model.cpp
+	\author Gregory Diamos
+	\date   Sunday October 18, 2026
+	\brief  A unit test for saving and loading models in each format.
+*/
+
+// Minerva Includes
+#include <minerva/model/interface/Model.h>
+
+#include <minerva/neuralnetwork/interface/NeuralNetwork.h>
+#include <minerva/neuralnetwork/interface/Layer.h>
+
+#include <minerva/matrix/interface/Matrix.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/ArgumentParser.h>
+
+// Standard Library Includes
+#include <random>
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+
+namespace minerva
+{
+
+namespace model
+{
+
+typedef neuralnetwork::NeuralNetwork NeuralNetwork;
+typedef neuralnetwork::Layer Layer;
+
+static Model createModel(size_t seed)
+{
+	std::default_random_engine engine(seed);
+
+	Model model;
+
+	NeuralNetwork featureSelector;
+
+	featureSelector.addLayer(Layer(2, 6, 4));
+	featureSelector.addLayer(Layer(1, 8, 8));
+	featureSelector.back().setActivation(Layer::RectifiedLinear);
+	featureSelector.initializeRandomly(engine);
+
+	NeuralNetwork classifier;
+
+	classifier.addLayer(Layer(1, 8, 2));
+	classifier.initializeRandomly(engine);
+
+	classifier.setLabelForOutputNeuron(0, "dark");
+	classifier.setLabelForOutputNeuron(1, "bright");
+
+	model.setNeuralNetwork("FeatureSelector", featureSelector);
+	model.setNeuralNetwork("Classifier",      classifier);
+
+	model.setAttribute("trained-batches", "42");
+
+	return model;
+}
+
+template<typename Iterator>
+static bool isSame(Iterator left, Iterator leftEnd, Iterator right,
+	Iterator rightEnd)
+{
+	for(; left != leftEnd && right != rightEnd; ++left, ++right)
+	{
+		if(left->rows() != right->rows() || left->columns() != right->columns() ||
+			left->data() != right->data())
+		{
+			return false;
+		}
+	}
+
+	return left == leftEnd && right == rightEnd;
+}
+
+static bool isSame(const Layer& left, const Layer& right)
+{
+	return left.getActivation() == right.getActivation() &&
+		isSame(left.begin(), left.end(), right.begin(), right.end()) &&
+		isSame(left.begin_bias(), left.end_bias(),
+			right.begin_bias(), right.end_bias());
+}
+
+static bool isSame(const NeuralNetwork& left, const NeuralNetwork& right)
+{
+	if(left.size() != right.size() ||
+		left.getOutputCount() != right.getOutputCount())
+	{
+		return false;
+	}
+
+	for(size_t layer = 0; layer < left.size(); ++layer)
+	{
+		if(!isSame(left[layer], right[layer]))
+		{
+			return false;
+		}
+	}
+
+	for(size_t output = 0; output < left.getOutputCount(); ++output)
+	{
+		if(left.getLabelForOutputNeuron(output) !=
+			right.getLabelForOutputNeuron(output))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool reportTest(bool passed, const std::string& name)
+{
+	std::cout << " Model " << name << " Test "
+		<< (passed ? "Passed" : "Failed") << "\n";
+
+	return passed;
+}
+
+static bool testRoundTrip(const std::string& path, Model::Format format,
+	const std::string& compression, bool lazy, size_t seed,
+	const std::string& name)
+{
+	util::KnobDatabase::setKnob("Model::ArchiveCompression", compression);
+	util::KnobDatabase::setKnob("Model::LazyLoading", lazy ? "1" : "0");
+
+	auto original = createModel(seed);
+
+	original.setPath(path);
+	original.save(format);
+
+	Model loaded(path);
+
+	loaded.load();
+
+	bool passed = true;
+
+	size_t expectedLoadedNetworks = lazy ? 0 : 2;
+
+	if(loaded.getLoadedNeuralNetworkNames().size() != expectedLoadedNetworks)
+	{
+		std::cout << "  Loaded " << loaded.getLoadedNeuralNetworkNames().size()
+			<< " networks up front, expected " << expectedLoadedNetworks << "\n";
+		passed = false;
+	}
+
+	for(auto& network : {"FeatureSelector", "Classifier"})
+	{
+		if(!isSame(loaded.getNeuralNetwork(network),
+			original.getNeuralNetwork(network)))
+		{
+			std::cout << "  Network '" << network << "' differs after loading\n";
+			passed = false;
+		}
+	}
+
+	if(loaded.getAttribute("trained-batches") != "42")
+	{
+		std::cout << "  The model attributes were not saved\n";
+		passed = false;
+	}
+
+	std::remove(path.c_str());
+
+	return reportTest(passed, name + (lazy ? " Lazy" : " Eager"));
+}
+
+static void patch(const std::string& path, size_t offset, uint64_t value,
+	size_t bytes)
+{
+	std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+
+	file.seekp(offset);
+	file.write((const char*)&value, bytes);
+}
+
+static uint64_t read(const std::string& path, size_t offset)
+{
+	std::ifstream file(path, std::ios::binary);
+
+	uint64_t value = 0;
+
+	file.seekg(offset);
+	file.read((char*)&value, sizeof(value));
+
+	return value;
+}
+
+static bool failsToLoad(const std::string& path)
+{
+	try
+	{
+		Model loaded(path);
+
+		loaded.load();
+
+		for(auto& network : loaded)
+		{
+			network.size();
+		}
+	}
+	catch(const std::exception& e)
+	{
+		return true;
+	}
+
+	return false;
+}
+
+static bool testCorruptMappedModel(const std::string& path, size_t seed)
+{
+	util::KnobDatabase::setKnob("Model::LazyLoading", "1");
+
+	// the header is the magic, version, alignment, header offset and size,
+	// table offset, and tensor count
+	const size_t alignmentOffset   = 12;
+	const size_t tableOffsetOffset = 32;
+
+	auto original = createModel(seed);
+
+	original.setPath(path);
+	original.save(Model::MappedFormat);
+
+	bool passed = true;
+
+	patch(path, alignmentOffset, 16, sizeof(uint32_t));
+
+	if(!failsToLoad(path))
+	{
+		std::cout << "  Loaded a model with the wrong alignment\n";
+		passed = false;
+	}
+
+	original.save(Model::MappedFormat);
+
+	// rows * columns * sizeof(float) wraps around to a small size
+	uint64_t table = read(path, tableOffsetOffset);
+
+	patch(path, table,                    (1ULL << 62) + 1, sizeof(uint64_t));
+	patch(path, table + sizeof(uint64_t), 4,                sizeof(uint64_t));
+
+	if(!failsToLoad(path))
+	{
+		std::cout << "  Loaded a model with a tensor size that overflows\n";
+		passed = false;
+	}
+
+	std::remove(path.c_str());
+
+	return reportTest(passed, "Corrupt Mapped");
+}
+
+static void runTest(const std::string& path, size_t seed)
+{
+	bool passed = true;
+
+	for(bool lazy : {true, false})
+	{
+		passed &= testRoundTrip(path, Model::MappedFormat,  "gzip", lazy, seed,
+			"Mapped");
+		passed &= testRoundTrip(path, Model::ArchiveFormat, "gzip", lazy, seed,
+			"Gzip Archive");
+		passed &= testRoundTrip(path, Model::ArchiveFormat, "zstd", lazy, seed,
+			"Zstd Archive");
+	}
+
+	passed &= testCorruptMappedModel(path, seed);
+
+	if(passed)
+	{
+		std::cout << "Test Passed\n";
+	}
+	else
+	{
+		std::cout << "Test Failed\n";
+	}
+}
+
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+
+	bool verbose = false;
+
+	std::string path;
+
+	size_t seed = 0;
+
+	parser.description("The minerva model save and load test.");
+
+	parser.parse("-p", "--path", path, "test-model.mdl",
+		"The temporary file that models are saved to.");
+	parser.parse("-s", "--seed", seed, 7,
+		"The seed for the random engine.");
+	parser.parse("-v", "--verbose", verbose, false,
+		"Print out log messages during execution");
+
+	parser.parse();
+
+	if(verbose)
+	{
+		minerva::util::enableAllLogs();
+	}
+
+	try
+	{
+		minerva::model::runTest(path, seed);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Model Test Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+	}
+
+	return 0;
+}
+
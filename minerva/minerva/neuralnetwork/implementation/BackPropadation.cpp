@@ -177,6 +177,23 @@ Matrix BackPropagation::getFlattenedCostDerivative() const
 	return flatten(computeCostDerivative());
 }
 
+static Layer createLayerWithSameShape(const Layer& layer)
+{
+	if(layer.isPooling())
+	{
+		return Layer(layer.getType(), layer.tiles(),
+			layer.getInputBlockingFactor(), layer.getOutputBlockingFactor());
+	}
+	
+	Layer result(layer.tiles(), layer.getInputBlockingFactor(),
+		layer.getOutputBlockingFactor(), layer.blockStep(),
+		layer.isWeightShared());
+	
+	result.setActivation(layer.getActivation());
+	
+	return result;
+}
+
 static NeuralNetwork createNetworkFromWeights(
 	const NeuralNetwork* neuralNetwork, const Matrix& weights)
 {
@@ -184,9 +201,7 @@ static NeuralNetwork createNetworkFromWeights(
 	
 	for(auto& layer : *neuralNetwork)
 	{
-		newNetwork.addLayer(Layer(layer.blocks(),
-			layer.getInputBlockingFactor(), layer.getOutputBlockingFactor(),
-			layer.blockStep()));
+		newNetwork.addLayer(createLayerWithSameShape(layer));
 	}
 	
 	newNetwork.setLabelsForOutputNeurons(*neuralNetwork);
@@ -205,9 +220,7 @@ static NeuralNetwork createNetworkFromWeights(
 	auto weight = weights.begin();	
 	for(auto& layer : *neuralNetwork)
 	{
-		newNetwork.addLayer(Layer(layer.blocks(),
-			layer.getInputBlockingFactor(), layer.getOutputBlockingFactor(),
-			layer.blockStep()));
+		newNetwork.addLayer(createLayerWithSameShape(layer));
 		
 		newNetwork.back().setWeightsWithoutBias(*weight);
 		++weight;
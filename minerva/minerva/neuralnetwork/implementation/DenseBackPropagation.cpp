@@ -13,6 +13,7 @@
 // Minerva Includes
 #include <minerva/util/interface/debug.h>
 #include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/Profiler.h>
 
 // Standard Library Includes
 #include <algorithm>
@@ -24,6 +25,12 @@ namespace minerva
 namespace neuralnetwork
 {
 
+static util::LogChannel denseBackPropagationLog("DenseBackPropagation");
+static util::LogChannel denseBackPropagationDetailLog("DenseBackPropagation::Detail");
+
+static util::Knob<float> lambdaKnob("NeuralNetwork::Lambda", 0.01f,
+	"The weight decay coefficient");
+
 typedef matrix::Matrix Matrix;
 typedef matrix::BlockSparseMatrix BlockSparseMatrix;
 typedef Matrix::FloatVector FloatVector;
@@ -32,6 +39,8 @@ typedef DenseBackPropagation::BlockSparseMatrixVector BlockSparseMatrixVector;
 static float computeCostForNetwork(const NeuralNetwork& network, const BlockSparseMatrix& input,
 	const BlockSparseMatrix& referenceOutput, float lambda)
 {
+	util::ProfilerScope scope("DenseBackPropagation::cost");
+
 	//J(theta) = -1/m (sum over i, sum over k y(i,k) * log (h(x)) + (1-y(i,k))*log(1-h(x)) +
 	//		   regularization term lambda/2m sum over l,i,j (theta[i,j])^2
 	// J = (1/m) .* sum(sum(-yOneHot .* log(hx) - (1 - yOneHot) .* log(1 - hx)));
@@ -59,12 +68,8 @@ static float computeCostForNetwork(const NeuralNetwork& network, const BlockSpar
 
 	auto hx = network.runInputs(input);
 
-	auto errors = referenceOutput.subtract(hx);
-	auto squaredErrors = errors.elementMultiply(errors);
-
-	float sumOfSquaredErrors = squaredErrors.reduceSum();
-	
-	float costSum = sumOfSquaredErrors * 1.0f / (2.0f * m);
+	// squared errors, or cross entropy for a softmax output
+	float costSum = network.back().getOutputCost(hx, referenceOutput) / m;
 
 	#endif
 
@@ -83,7 +88,7 @@ static float computeCostForNetwork(const NeuralNetwork& network, const BlockSpar
 DenseBackPropagation::DenseBackPropagation(NeuralNetwork* ann, BlockSparseMatrix* input, BlockSparseMatrix* ref)
  : BackPropagation(ann, input, ref), _lambda(0.0f)
 {
-	_lambda = util::KnobDatabase::getKnobValue("NeuralNetwork::Lambda", 0.01f);
+	_lambda = lambdaKnob;
 }
 
 BlockSparseMatrixVector DenseBackPropagation::getCostDerivative(const NeuralNetwork& network,
@@ -111,10 +116,13 @@ float DenseBackPropagation::getInputCost(const NeuralNetwork& network, const Blo
 	return computeCostForNetwork(network, input, reference, 0.0f);
 }
 
-BlockSparseMatrix DenseBackPropagation::getInputDelta(const NeuralNetwork& network, const BlockSparseMatrixVector& activations) const
+BlockSparseMatrix DenseBackPropagation::getInputDelta(const NeuralNetwork& network, const BlockSparseMatrixVector& activations,
+	const BlockSparseMatrixVector& derivatives) const
 {
+	util::ProfilerScope scope("DenseBackPropagation::inputDelta");
+
 	auto i = activations.rbegin();
-	auto delta = (*i).subtract(*_referenceOutput).elementMultiply(i->sigmoidDerivative());
+	auto delta = network.back().getOutputDelta(*i, *_referenceOutput);
 	++i;
 
 	while (i + 1 != activations.rend())
@@ -124,18 +132,17 @@ BlockSparseMatrix DenseBackPropagation::getInputDelta(const NeuralNetwork& netwo
 
 		network.formatOutputForLayer(layer, delta);
 
-		auto activationDerivativeOfCurrentLayer = i->sigmoidDerivative();
-		auto deltaPropagatedReverse = layer.runReverse(delta);
+		auto deltaPropagatedReverse = layer.runReverse(delta, *i);
 
 		util::log ("DenseBackPropagation") << " Computing input delta for layer number: " << layerNumber << "\n";
-		delta = deltaPropagatedReverse.elementMultiply(activationDerivativeOfCurrentLayer);
 		
-		if(util::isLogEnabled("DenseBackPropagation::Detail"))
-		{
-			util::log("DenseBackPropagation::Detail") << " added delta of size ( " << delta.rows()
-				<< " ) rows and ( " << delta.columns() << " )\n" ;
-			util::log("DenseBackPropagation::Detail") << " delta contains " << delta.toString() << "\n";
-		}
+		// the activation was produced by the previous layer
+		delta = network[layerNumber - 1].applyActivationDerivative(
+			deltaPropagatedReverse, *i, derivatives[layerNumber - 1]);
+		
+		logIf(denseBackPropagationDetailLog) << " added delta of size ( " << delta.rows()
+			<< " ) rows and ( " << delta.columns() << " )\n" ;
+		logIf(denseBackPropagationDetailLog) << " delta contains " << delta.toString() << "\n";
 
 		++i; 
 	}
@@ -146,23 +153,23 @@ BlockSparseMatrix DenseBackPropagation::getInputDelta(const NeuralNetwork& netwo
 
 	network.formatOutputForLayer(layer, delta);
 
-	auto deltaPropagatedReverse = layer.runReverse(delta);
+	auto deltaPropagatedReverse = layer.runReverse(delta, activations.front());
 
 	util::log ("DenseBackPropagation") << " Computing input delta for layer number: " << layerNumber << "\n";
 	delta = deltaPropagatedReverse;
 	
-	if(util::isLogEnabled("DenseBackPropagation::Detail"))
-	{
-		util::log("DenseBackPropagation::Detail") << " added delta of size ( " << delta.rows()
-			<< " ) rows and ( " << delta.columns() << " )\n" ;
-		util::log("DenseBackPropagation::Detail") << " delta contains " << delta.toString() << "\n";
-	}
+	logIf(denseBackPropagationDetailLog) << " added delta of size ( " << delta.rows()
+		<< " ) rows and ( " << delta.columns() << " )\n" ;
+	logIf(denseBackPropagationDetailLog) << " delta contains " << delta.toString() << "\n";
 	
 	return delta;	
 }
 
-BlockSparseMatrixVector DenseBackPropagation::getActivations(const NeuralNetwork& network, const BlockSparseMatrix& input) const
+BlockSparseMatrixVector DenseBackPropagation::getActivations(const NeuralNetwork& network, const BlockSparseMatrix& input,
+	BlockSparseMatrixVector& derivatives) const
 {
+	util::ProfilerScope scope("DenseBackPropagation::forward");
+
 	BlockSparseMatrixVector activations;
 
 	activations.reserve(network.size() + 1);
@@ -170,32 +177,55 @@ BlockSparseMatrixVector DenseBackPropagation::getActivations(const NeuralNetwork
 	auto temp = input;
 
 	activations.push_back(temp);
-	//util::log("DenseBackPropagation") << " added activation of size ( " << activations.back().rows()
+	//logIf(denseBackPropagationLog) << " added activation of size ( " << activations.back().rows()
 	// << " ) rows and ( " << activations.back().columns() << " )\n" ;
 
+	derivatives.reserve(network.size());
+
 	for (auto i = network.begin(); i != network.end(); ++i)
 	{
 		network.formatInputForLayer(*i, activations.back());
 	
-		activations.push_back((*i).runInputs(activations.back()));
-		//util::log("DenseBackPropagation") << " added activation of size ( " << activations.back().rows()
+		// keep the derivative blocked like the activation it belongs to
+		if(!derivatives.empty() && !derivatives.back().empty())
+		{
+			network.formatInputForLayer(*i, derivatives.back());
+		}
+
+		// the output layer delta does not use the activation derivative
+		BlockSparseMatrix derivative;
+
+		if(i + 1 == network.end())
+		{
+			activations.push_back((*i).runInputs(activations.back()));
+		}
+		else
+		{
+			activations.push_back((*i).runInputs(activations.back(), derivative));
+		}
+
+		derivatives.push_back(std::move(derivative));
+		//logIf(denseBackPropagationLog) << " added activation of size ( " << activations.back().rows()
 		//<< " ) rows and ( " << activations.back().columns() << " )\n" ;
 	}
 
-	util::log("DenseBackPropagation") << " intermediate stage ( " << activations[activations.size() / 2].toString() << "\n";
-	util::log("DenseBackPropagation") << " final output ( " << activations.back().toString() << "\n";
+	logIf(denseBackPropagationLog) << " intermediate stage ( " << activations[activations.size() / 2].toString() << "\n";
+	logIf(denseBackPropagationLog) << " final output ( " << activations.back().toString() << "\n";
 
 	return activations;
 }
 
-BlockSparseMatrixVector DenseBackPropagation::getDeltas(const NeuralNetwork& network, const BlockSparseMatrixVector& activations) const
+BlockSparseMatrixVector DenseBackPropagation::getDeltas(const NeuralNetwork& network, const BlockSparseMatrixVector& activations,
+	const BlockSparseMatrixVector& derivatives) const
 {
+	util::ProfilerScope scope("DenseBackPropagation::deltas");
+
 	BlockSparseMatrixVector deltas;
 
 	deltas.reserve(activations.size() - 1);
 	
 	auto i = activations.rbegin();
-	auto delta = (*i).subtract(*_referenceOutput).elementMultiply(i->sigmoidDerivative());
+	auto delta = network.back().getOutputDelta(*i, *_referenceOutput);
 	++i;
 
 	while (i != activations.rend())
@@ -208,24 +238,27 @@ BlockSparseMatrixVector DenseBackPropagation::getDeltas(const NeuralNetwork& net
 
 		network.formatOutputForLayer(layer, deltas.back());
 
-		auto activationDerivativeOfCurrentLayer = i->sigmoidDerivative();
-		auto deltaPropagatedReverse = layer.runReverse(deltas.back());
+		// the input has no activation function, so it has no delta
+		if(layerNumber == 0)
+		{
+			break;
+		}
+
+		auto deltaPropagatedReverse = layer.runReverse(deltas.back(), *i);
 	   
-		delta = deltaPropagatedReverse.elementMultiply(activationDerivativeOfCurrentLayer);
+		delta = network[layerNumber - 1].applyActivationDerivative(
+			deltaPropagatedReverse, *i, derivatives[layerNumber - 1]);
 
 		++i; 
 	}
 
 	std::reverse(deltas.begin(), deltas.end());
 	
-	if(util::isLogEnabled("DenseBackPropagation::Detail"))
+	for(auto& delta : deltas)
 	{
-		for(auto& delta : deltas)
-		{
-			util::log("DenseBackPropagation::Detail") << " added delta of size ( " << delta.rows()
-				<< " ) rows and ( " << delta.columns() << " )\n" ;
-			util::log("DenseBackPropagation::Detail") << " delta contains " << delta.toString() << "\n";
-		}
+		logIf(denseBackPropagationDetailLog) << " added delta of size ( " << delta.rows()
+			<< " ) rows and ( " << delta.columns() << " )\n" ;
+		logIf(denseBackPropagationDetailLog) << " delta contains " << delta.toString() << "\n";
 	}
 	
 	return deltas;
@@ -249,11 +282,16 @@ static void coalesceNeuronOutputs(BlockSparseMatrix& derivative,
 BlockSparseMatrixVector DenseBackPropagation::getCostDerivative(
 	const NeuralNetwork& network) const
 {
+	util::ProfilerScope scope("DenseBackPropagation::costDerivative");
+
 	//get activations in a vector
-	auto activations = getActivations(network, *_input);
+	BlockSparseMatrixVector derivatives;
+	auto activations = getActivations(network, *_input, derivatives);
 	//get deltas in a vector
-	auto deltas = getDeltas(network, activations);
+	auto deltas = getDeltas(network, activations, derivatives);
 	
+	util::ProfilerScope gradientScope("DenseBackPropagation::gradient");
+
 	BlockSparseMatrixVector partialDerivative;
 
 	partialDerivative.reserve(2 * deltas.size());
@@ -264,15 +302,36 @@ BlockSparseMatrixVector DenseBackPropagation::getCostDerivative(
 	auto l = network.begin();
 	for (auto i = deltas.begin(), j = activations.begin(); i != deltas.end() && j != activations.end(); ++i, ++j, ++l)
 	{
-		auto transposedDelta = (*i).transpose();
 		auto& activation     = *j;
 		auto& layer          = *l;
 
+		if(layer.isPooling())
+		{
+			// nothing to learn
+			partialDerivative.push_back(layer.getWeightsWithoutBias());
+			partialDerivative.push_back(layer.getBias());
+			
+			continue;
+		}
+
+		if(layer.isWeightShared())
+		{
+			// one filter bank, the gradient is accumulated over every tile
+			partialDerivative.push_back(layer.getSharedWeightDerivative(
+				activation, *i).multiply(1.0f/samples));
+			partialDerivative.push_back(layer.getSharedBiasDerivative(
+				*i).multiply(1.0f/samples));
+			
+			continue;
+		}
+
+		auto transposedDelta = (*i).transpose();
+
 		transposedDelta.setRowSparse();
 		
-		util::log("DenseBackPropagation::Detail") << " computing derivative for layer " << std::distance(deltas.begin(), i) << " from " << samples << " samples\n";
-		util::log("DenseBackPropagation::Detail") << "  activation: " << activation.shapeString() << "\n";
-		util::log("DenseBackPropagation::Detail") << "  delta-transposed: " << transposedDelta.shapeString() << "\n";
+		logIf(denseBackPropagationDetailLog) << " computing derivative for layer " << std::distance(deltas.begin(), i) << " from " << samples << " samples\n";
+		logIf(denseBackPropagationDetailLog) << "  activation: " << activation.shapeString() << "\n";
+		logIf(denseBackPropagationDetailLog) << "  delta-transposed: " << transposedDelta.shapeString() << "\n";
 
 		//there will be one less delta than activation
 		auto unnormalizedPartialDerivative = (transposedDelta.reverseConvolutionalMultiply(activation));
@@ -286,8 +345,8 @@ BlockSparseMatrixVector DenseBackPropagation::getCostDerivative(
 		// compute the derivative for the bias
 		auto normalizedBiasPartialDerivative = transposedDelta.reduceSumAlongColumns().multiply(1.0f/samples);
 		
-		util::log("DenseBackPropagation::Detail") << "  weight derivative: " << normalizedPartialDerivative.shapeString() << "\n";
-		util::log("DenseBackPropagation::Detail") << "  bias derivative  : " << normalizedBiasPartialDerivative.shapeString() << "\n";
+		logIf(denseBackPropagationDetailLog) << "  weight derivative: " << normalizedPartialDerivative.shapeString() << "\n";
+		logIf(denseBackPropagationDetailLog) << "  bias derivative  : " << normalizedBiasPartialDerivative.shapeString() << "\n";
 		
 		// Account for cases where the same neuron produced multiple outputs
 		//  or not enough inputs existed
@@ -309,19 +368,22 @@ BlockSparseMatrix DenseBackPropagation::getInputDerivative(
 	const NeuralNetwork& network,
 	const BlockSparseMatrix& input) const
 {
+	util::ProfilerScope scope("DenseBackPropagation::inputDerivative");
+
 	//get activations in a vector
-	auto activations = getActivations(network, input);
+	BlockSparseMatrixVector derivatives;
+	auto activations = getActivations(network, input, derivatives);
 	//get deltas in a vector
-	auto delta = getInputDelta(network, activations);
+	auto delta = getInputDelta(network, activations, derivatives);
 	
-	util::log("DenseBackPropagation") << "Input delta: " << delta.toString();
+	logIf(denseBackPropagationLog) << "Input delta: " << delta.toString();
 	unsigned int samples = input.rows();
 
 	auto partialDerivative = delta;
 
 	auto normalizedPartialDerivative = partialDerivative.multiply(1.0f/samples);
 
-	util::log("DenseBackPropagation") << "Input derivative: " << normalizedPartialDerivative.toString();
+	logIf(denseBackPropagationLog) << "Input derivative: " << normalizedPartialDerivative.toString();
 
 	return normalizedPartialDerivative;
 }
@@ -0,0 +1,715 @@
+/*! \file   InferencePlan.cpp
+	\author Gregory Diamos <gregory.diamos@gmail.com>
+	\date   Sunday October 18, 2026
+	\brief  The source file for the InferencePlan class.
+*/
+
+// Minerva Includes
+#include <minerva/neuralnetwork/interface/InferencePlan.h>
+#include <minerva/neuralnetwork/interface/NeuralNetwork.h>
+#include <minerva/neuralnetwork/interface/Layer.h>
+
+#include <minerva/matrix/interface/ActivationFunction.h>
+
+#include <minerva/util/interface/debug.h>
+
+// Standard Library Includes
+#include <algorithm>
+#include <stdexcept>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <cmath>
+
+namespace minerva
+{
+
+namespace neuralnetwork
+{
+
+static util::LogChannel inferencePlanLog("InferencePlan");
+
+InferencePlan::InferencePlan()
+: _maximumBatchSize(0), _maximumColumns(0), _quantized(false),
+  _maximumQuantizedColumns(0), _maximumAccumulatorColumns(0)
+{
+
+}
+
+void InferencePlan::build(const NeuralNetworkVector& networks,
+	size_t maximumBatchSize)
+{
+	clear();
+	
+	size_t columns = 0;
+	
+	for(auto network : networks)
+	{
+		for(auto& layer : *network)
+		{
+			if(_steps.empty())
+			{
+				columns = layer.getInputCount();
+			}
+			
+			Step step;
+			
+			step.layer        = &layer;
+			step.inputColumns = columns;
+			step.pooling      = layer.isPooling();
+			step.softmax      = !step.pooling &&
+				layer.getActivation() == Layer::Softmax;
+			step.inputMinimum = std::numeric_limits<float>::max();
+			step.inputMaximum = -std::numeric_limits<float>::max();
+			step.inputScale   = 1.0f;
+			step.inputZero    = 0;
+			step.quantizedInputColumns = 0;
+			
+			if(step.pooling)
+			{
+				// each window of 'step' inputs reduces to a single output
+				step.step          = layer.getInputBlockingFactor() /
+					layer.getOutputBlockingFactor();
+				step.windows       = columns / step.step;
+				step.outputColumns = step.windows;
+				step.weightRows    = step.step;
+				step.weightColumns = 1;
+				
+				logIf(inferencePlanLog) << " layer " << _steps.size() << ": "
+					<< step.inputColumns << " inputs -> " << step.outputColumns
+					<< " outputs (" << layer.getPoolingName() << " pooling over "
+					<< step.step << " inputs)\n";
+				
+				_maximumColumns = std::max(_maximumColumns, step.outputColumns);
+				
+				columns = step.outputColumns;
+				
+				_steps.push_back(std::move(step));
+				
+				continue;
+			}
+			
+			auto& weights = layer.getWeightsWithoutBias();
+			auto& bias    = layer.getBias();
+			
+			step.step          = layer.blockStep();
+			step.weightRows    = weights.rowsPerBlock();
+			step.weightColumns = weights.columnsPerBlock();
+			
+			if(step.step == 0 || weights.empty())
+			{
+				throw std::runtime_error("Cannot build an inference plan for "
+					"a layer without weights.");
+			}
+			
+			// the same window schedule as BlockSparseMatrix::convolutionalMultiply
+			step.windows       = (columns + step.step - 1) / step.step;
+			step.outputColumns = step.windows * step.weightColumns;
+			
+			for(size_t window = 0; window < step.windows; ++window)
+			{
+				size_t leftBegin = window * step.step;
+				
+				step.weightBlockForWindow.push_back(
+					(leftBegin * weights.blocks()) / columns);
+				
+				if(!bias.empty())
+				{
+					step.biasBlockForWindow.push_back(
+						(window * bias.blocks()) / step.windows);
+				}
+			}
+			
+			logIf(inferencePlanLog) << " layer " << _steps.size() << ": "
+				<< step.inputColumns << " inputs -> " << step.outputColumns
+				<< " outputs (" << step.windows << " windows of "
+				<< step.weightRows << " x " << step.weightColumns << ")\n";
+			
+			_maximumColumns = std::max(_maximumColumns, step.outputColumns);
+			
+			columns = step.outputColumns;
+			
+			_steps.push_back(std::move(step));
+		}
+	}
+	
+	_reserve(maximumBatchSize);
+}
+
+void InferencePlan::clear()
+{
+	_steps.clear();
+	
+	_buffers[0] = Matrix();
+	_buffers[1] = Matrix();
+	
+	_maximumBatchSize = 0;
+	_maximumColumns   = 0;
+	
+	_quantized = false;
+	
+	_quantizedInput.clear();
+	_accumulators.clear();
+	
+	_maximumQuantizedColumns   = 0;
+	_maximumAccumulatorColumns = 0;
+}
+
+const InferencePlan::Matrix& InferencePlan::runInputs(const Matrix& input)
+{
+	assert(!empty());
+	assert(input.columns() == getInputCount());
+	
+	_reserve(input.rows());
+	
+	const Matrix* current = &input;
+	
+	for(size_t i = 0; i < _steps.size(); ++i)
+	{
+		auto& output = _buffers[i % 2];
+		
+		if(_quantized && !_steps[i].pooling)
+		{
+			_runQuantizedStep(_steps[i], *current, output);
+		}
+		else
+		{
+			_runStep(_steps[i], *current, output);
+		}
+		
+		current = &output;
+	}
+	
+	return *current;
+}
+
+void InferencePlan::calibrate(const Matrix& input)
+{
+	assert(!empty());
+	assert(input.columns() == getInputCount());
+	
+	_reserve(input.rows());
+	
+	const Matrix* current = &input;
+	
+	for(size_t i = 0; i < _steps.size(); ++i)
+	{
+		auto& step = _steps[i];
+		
+		const float* data = current->data().data();
+		
+		auto range = std::minmax_element(data,
+			data + current->rows() * step.inputColumns);
+		
+		if(current->rows() > 0)
+		{
+			step.inputMinimum = std::min(step.inputMinimum, *range.first);
+			step.inputMaximum = std::max(step.inputMaximum, *range.second);
+		}
+		
+		auto& output = _buffers[i % 2];
+		
+		_runStep(step, *current, output);
+		
+		current = &output;
+	}
+}
+
+void InferencePlan::quantize()
+{
+	assert(!empty());
+	
+	_maximumQuantizedColumns   = 0;
+	_maximumAccumulatorColumns = 0;
+	
+	for(auto& step : _steps)
+	{
+		if(step.pooling)
+		{
+			continue;
+		}
+		
+		if(step.inputMinimum > step.inputMaximum)
+		{
+			throw std::runtime_error("Cannot quantize an inference plan "
+				"before it has been calibrated.");
+		}
+		
+		_quantizeStep(step);
+		
+		_maximumQuantizedColumns = std::max(_maximumQuantizedColumns,
+			step.quantizedInputColumns);
+		_maximumAccumulatorColumns = std::max(_maximumAccumulatorColumns,
+			step.weightColumns);
+	}
+	
+	_quantized = true;
+	
+	_quantizedInput.resize(_maximumBatchSize * _maximumQuantizedColumns);
+	_accumulators.resize(_maximumBatchSize * _maximumAccumulatorColumns);
+	
+	logIf(inferencePlanLog) << "Quantized plan to int8 using the "
+		<< matrix::getInt8KernelName() << " kernel\n";
+}
+
+bool InferencePlan::isQuantized() const
+{
+	return _quantized;
+}
+
+std::string InferencePlan::getCalibration() const
+{
+	std::stringstream stream;
+	
+	stream << std::setprecision(9);
+	
+	for(auto& step : _steps)
+	{
+		if(step.inputMinimum > step.inputMaximum)
+		{
+			throw std::runtime_error("Inference plan has not been calibrated.");
+		}
+		
+		stream << step.inputMinimum << " " << step.inputMaximum << " ";
+	}
+	
+	return stream.str();
+}
+
+void InferencePlan::setCalibration(const std::string& calibration)
+{
+	std::stringstream stream(calibration);
+	
+	for(auto& step : _steps)
+	{
+		float minimum = 0.0f;
+		float maximum = 0.0f;
+		
+		if(!(stream >> minimum >> maximum) || minimum > maximum)
+		{
+			throw std::runtime_error("Calibration '" + calibration +
+				"' does not match the inference plan.");
+		}
+		
+		step.inputMinimum = minimum;
+		step.inputMaximum = maximum;
+	}
+	
+	std::string remainder;
+	
+	if(stream >> remainder)
+	{
+		throw std::runtime_error("Calibration '" + calibration +
+			"' does not match the inference plan.");
+	}
+}
+
+bool InferencePlan::empty() const
+{
+	return _steps.empty();
+}
+
+size_t InferencePlan::getInputCount() const
+{
+	return _steps.front().inputColumns;
+}
+
+size_t InferencePlan::getOutputCount() const
+{
+	return _steps.back().outputColumns;
+}
+
+size_t InferencePlan::getInputBlockingFactor() const
+{
+	return _steps.front().layer->getInputBlockingFactor();
+}
+
+static float sigmoid(float v)
+{
+	return Layer::applyActivation(Layer::Sigmoid, v);
+}
+
+/*! \brief Apply an element-wise activation, switching once per row */
+static void activateRow(float* data, size_t columns, Layer::Activation activation)
+{
+	switch(activation)
+	{
+	case Layer::RectifiedLinear:
+	{
+		for(size_t column = 0; column < columns; ++column)
+		{
+			data[column] = matrix::ActivationFunction::apply(
+				matrix::ActivationFunction::RectifiedLinear, data[column]);
+		}
+		break;
+	}
+	case Layer::Sigmoid:
+	{
+		for(size_t column = 0; column < columns; ++column)
+		{
+			data[column] = sigmoid(data[column]);
+		}
+		break;
+	}
+	default:
+	{
+		for(size_t column = 0; column < columns; ++column)
+		{
+			data[column] = Layer::applyActivation(activation, data[column]);
+		}
+		break;
+	}
+	}
+}
+
+/*! \brief Normalize each row to a distribution, after subtracting its maximum */
+static void softmaxRows(float* data, size_t rows, size_t columns)
+{
+	for(size_t row = 0; row < rows; ++row)
+	{
+		float* rowData = data + row * columns;
+		
+		float maximum = *std::max_element(rowData, rowData + columns);
+		float sum     = 0.0f;
+		
+		for(size_t column = 0; column < columns; ++column)
+		{
+			rowData[column] = std::exp(rowData[column] - maximum);
+			sum += rowData[column];
+		}
+		
+		float scale = 1.0f / sum;
+		
+		for(size_t column = 0; column < columns; ++column)
+		{
+			rowData[column] *= scale;
+		}
+	}
+}
+
+void InferencePlan::_runStep(const Step& step, const Matrix& input,
+	Matrix& output) const
+{
+	if(step.pooling)
+	{
+		_runPoolingStep(step, input, output);
+		return;
+	}
+	
+	size_t rows = input.rows();
+	
+	output.resize(rows, step.outputColumns);
+	
+	auto& weights = step.layer->getWeightsWithoutBias();
+	auto& bias    = step.layer->getBias();
+	
+	auto activation = step.layer->getActivation();
+	
+	const float* inputData  = input.data().data();
+	float*       outputData = output.data().data();
+	
+	for(size_t window = 0; window < step.windows; ++window)
+	{
+		size_t leftBegin = window * step.step;
+		size_t extent    = std::min(step.inputColumns - leftBegin, step.weightRows);
+		
+		const float* weightData =
+			weights[step.weightBlockForWindow[window]].data().data();
+		const float* biasData   = step.biasBlockForWindow.empty() ? nullptr :
+			bias[step.biasBlockForWindow[window]].data().data();
+		
+		// fused multiply, bias, and activation, one row of the batch at a time
+		for(size_t row = 0; row < rows; ++row)
+		{
+			const float* inputRow  = inputData + row * step.inputColumns + leftBegin;
+			float*       outputRow = outputData + row * step.outputColumns +
+				window * step.weightColumns;
+			
+			if(biasData != nullptr)
+			{
+				std::copy(biasData, biasData + step.weightColumns, outputRow);
+			}
+			else
+			{
+				std::fill(outputRow, outputRow + step.weightColumns, 0.0f);
+			}
+			
+			for(size_t i = 0; i < extent; ++i)
+			{
+				float value = inputRow[i];
+				
+				const float* weightRow = weightData + i * step.weightColumns;
+				
+				for(size_t column = 0; column < step.weightColumns; ++column)
+				{
+					outputRow[column] += value * weightRow[column];
+				}
+			}
+			
+			if(step.softmax)
+			{
+				continue;
+			}
+			
+			activateRow(outputRow, step.weightColumns, activation);
+		}
+	}
+	
+	if(step.softmax)
+	{
+		softmaxRows(outputData, rows, step.outputColumns);
+	}
+}
+
+static const int   sigmoidTableEntries = 4096;
+static const float sigmoidTableRange   = 16.0f;
+
+static std::vector<float> createSigmoidTable()
+{
+	std::vector<float> table(sigmoidTableEntries);
+	
+	for(int i = 0; i < sigmoidTableEntries; ++i)
+	{
+		table[i] = sigmoid((2.0f * sigmoidTableRange * i) /
+			(sigmoidTableEntries - 1) - sigmoidTableRange);
+	}
+	
+	return table;
+}
+
+/*! \brief Sampled over [-16, 16], the sigmoid is within 1e-3 of the exact value */
+static float lookupSigmoid(float v)
+{
+	static std::vector<float> table = createSigmoidTable();
+	
+	float position = (v + sigmoidTableRange) *
+		((sigmoidTableEntries - 1) / (2.0f * sigmoidTableRange)) + 0.5f;
+	
+	if(position <= 0.0f)                return table.front();
+	if(position >= sigmoidTableEntries) return table.back();
+	
+	return table[(int)position];
+}
+
+/*! \brief Transcendental activations use the table, tanh(x) = 2 sigmoid(2x) - 1 */
+static float lookupActivation(Layer::Activation activation, float v)
+{
+	switch(activation)
+	{
+	case Layer::Sigmoid: return lookupSigmoid(v);
+	case Layer::Tanh:    return 2.0f * lookupSigmoid(2.0f * v) - 1.0f;
+	default:             return Layer::applyActivation(activation, v);
+	}
+}
+
+void InferencePlan::_runQuantizedStep(const Step& step, const Matrix& input,
+	Matrix& output)
+{
+	size_t rows = input.rows();
+	
+	output.resize(rows, step.outputColumns);
+	
+	auto& bias = step.layer->getBias();
+	
+	auto activation = step.layer->getActivation();
+	
+	const float* inputData  = input.data().data();
+	float*       outputData = output.data().data();
+	
+	size_t quantizedColumns = step.quantizedInputColumns;
+	
+	uint8_t* quantizedData = _quantizedInput.data();
+	int32_t* accumulators  = _accumulators.data();
+	
+	float inverseScale = 1.0f / step.inputScale;
+	
+	// padding holds the zero point, which contributes nothing after the
+	// zero point correction
+	for(size_t row = 0; row < rows; ++row)
+	{
+		const float* inputRow     = inputData + row * step.inputColumns;
+		uint8_t*     quantizedRow = quantizedData + row * quantizedColumns;
+		
+		for(size_t column = 0; column < step.inputColumns; ++column)
+		{
+			int32_t value = (int32_t)std::lround(inputRow[column] * inverseScale) +
+				step.inputZero;
+			
+			quantizedRow[column] = std::min(std::max(value, 0), 127);
+		}
+		
+		std::fill(quantizedRow + step.inputColumns,
+			quantizedRow + quantizedColumns, (uint8_t)step.inputZero);
+	}
+	
+	for(size_t window = 0; window < step.windows; ++window)
+	{
+		size_t block = step.weightBlockForWindow[window];
+		
+		matrix::int8Multiply(accumulators, step.weightColumns,
+			quantizedData + window * step.step, quantizedColumns, rows,
+			step.quantizedWeights[block]);
+		
+		const float*   scales = step.weightScales[block].data();
+		const int32_t* sums   = step.weightSums[block].data();
+		
+		const float* biasData = step.biasBlockForWindow.empty() ? nullptr :
+			bias[step.biasBlockForWindow[window]].data().data();
+		
+		for(size_t row = 0; row < rows; ++row)
+		{
+			const int32_t* accumulatorRow = accumulators + row * step.weightColumns;
+			
+			float* outputRow = outputData + row * step.outputColumns +
+				window * step.weightColumns;
+			
+			for(size_t column = 0; column < step.weightColumns; ++column)
+			{
+				float value = scales[column] * (accumulatorRow[column] -
+					step.inputZero * sums[column]);
+				
+				if(biasData != nullptr)
+				{
+					value += biasData[column];
+				}
+				
+				outputRow[column] = step.softmax ? value :
+					lookupActivation(activation, value);
+			}
+		}
+	}
+	
+	if(step.softmax)
+	{
+		softmaxRows(outputData, rows, step.outputColumns);
+	}
+}
+
+void InferencePlan::_quantizeStep(Step& step) const
+{
+	// the range must contain zero so that padding is exact
+	float minimum = std::min(step.inputMinimum, 0.0f);
+	float maximum = std::max(step.inputMaximum, 0.0f);
+	
+	step.inputScale = (maximum - minimum) / 127.0f;
+	
+	if(step.inputScale == 0.0f)
+	{
+		step.inputScale = 1.0f;
+	}
+	
+	step.inputZero = std::min(std::max(
+		(int32_t)std::lround(-minimum / step.inputScale), 0), 127);
+	
+	step.quantizedWeights.clear();
+	step.weightScales.clear();
+	step.weightSums.clear();
+	
+	auto& weights = step.layer->getWeightsWithoutBias();
+	
+	size_t rows    = step.weightRows;
+	size_t columns = step.weightColumns;
+	
+	for(auto& block : weights)
+	{
+		const float* data = block.data().data();
+		
+		std::vector<int8_t>  quantized(rows * columns);
+		std::vector<float>   scales(columns);
+		std::vector<int32_t> sums(columns, 0);
+		
+		for(size_t column = 0; column < columns; ++column)
+		{
+			float maximumMagnitude = 0.0f;
+			
+			for(size_t row = 0; row < rows; ++row)
+			{
+				maximumMagnitude = std::max(maximumMagnitude,
+					std::fabs(data[row * columns + column]));
+			}
+			
+			float scale = maximumMagnitude == 0.0f ? 1.0f :
+				maximumMagnitude / 127.0f;
+			
+			for(size_t row = 0; row < rows; ++row)
+			{
+				int32_t value = std::min(std::max((int32_t)std::lround(
+					data[row * columns + column] / scale), -127), 127);
+				
+				quantized[row * columns + column] = value;
+				sums[column] += value;
+			}
+			
+			// fold the input scale in once, rather than per output
+			scales[column] = scale * step.inputScale;
+		}
+		
+		step.quantizedWeights.push_back(
+			matrix::Int8Matrix(quantized.data(), rows, columns));
+		step.weightScales.push_back(std::move(scales));
+		step.weightSums.push_back(std::move(sums));
+	}
+	
+	// the last window may read past the input, into zero point padding
+	size_t paddedRows = step.quantizedWeights.front().paddedRows();
+	
+	step.quantizedInputColumns = std::max(step.inputColumns,
+		(step.windows - 1) * step.step + paddedRows);
+}
+
+void InferencePlan::_runPoolingStep(const Step& step, const Matrix& input,
+	Matrix& output) const
+{
+	size_t rows = input.rows();
+	
+	output.resize(rows, step.outputColumns);
+	
+	bool isMax = step.layer->getType() == Layer::MaxPooling;
+	
+	const float* inputData  = input.data().data();
+	float*       outputData = output.data().data();
+	
+	for(size_t row = 0; row < rows; ++row)
+	{
+		const float* inputRow  = inputData + row * step.inputColumns;
+		float*       outputRow = outputData + row * step.outputColumns;
+		
+		for(size_t window = 0; window < step.windows; ++window)
+		{
+			const float* begin = inputRow + window * step.step;
+			
+			float value = begin[0];
+			
+			for(size_t i = 1; i < step.step; ++i)
+			{
+				value = isMax ? std::max(value, begin[i]) : value + begin[i];
+			}
+			
+			outputRow[window] = isMax ? value : value / step.step;
+		}
+	}
+}
+
+void InferencePlan::_reserve(size_t batchSize)
+{
+	if(batchSize <= _maximumBatchSize)
+	{
+		return;
+	}
+	
+	logIf(inferencePlanLog) << "Allocating activation buffers for "
+		<< batchSize << " samples of up to " << _maximumColumns << " columns\n";
+	
+	_maximumBatchSize = batchSize;
+	
+	_buffers[0] = Matrix(_maximumBatchSize, _maximumColumns);
+	_buffers[1] = Matrix(_maximumBatchSize, _maximumColumns);
+	
+	_quantizedInput.resize(_maximumBatchSize * _maximumQuantizedColumns);
+	_accumulators.resize(_maximumBatchSize * _maximumAccumulatorColumns);
+}
+
+}
+
+}
+
@@ -6,29 +6,75 @@
 #include <minerva/neuralnetwork/interface/Layer.h>
 
 #include <minerva/matrix/interface/Matrix.h>
+#include <minerva/matrix/interface/ActivationFunction.h>
 
 #include <minerva/util/interface/debug.h>
 #include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/Profiler.h>
+#include <minerva/util/interface/PhiloxRandomEngine.h>
+#include <minerva/util/interface/SystemCompatibility.h>
 
 #include <random>
+#include <thread>
+#include <numeric>
 #include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include <limits>
+#include <cmath>
 
 namespace minerva
 {
 namespace neuralnetwork
 {
 
+static util::LogChannel layerLog("Layer");
+static util::LogChannel layerDetailLog("Layer::Detail");
+
+static util::Knob<float> randomInitializationEpsilon(
+	"Layer::RandomInitializationEpsilon", 0.0f,
+	"Overrides the epsilon passed to initializeRandomly");
+
+static util::Knob<size_t> sparseInitializationConnections(
+	"Layer::SparseInitializationConnections", 0,
+	"Non-zero input weights per neuron after random initialization, 0 is dense");
+
+static util::Knob<size_t> parallelInitializationWeights(
+	"Layer::ParallelInitializationWeights", 1 << 20,
+	"Initialize layers with at least this many weights on all hardware threads");
+
+static util::Knob<size_t> initializationThreads(
+	"Layer::InitializationThreads", 0,
+	"Threads used to initialize large layers, 0 uses every hardware thread");
+
 typedef minerva::matrix::Matrix::FloatVector FloatVector;
 
-Layer::Layer(unsigned totalBlocks, size_t blockInput, size_t blockOutput, size_t blockStep)
-: m_sparseMatrix(totalBlocks, blockInput, blockOutput, true),
-  m_bias(totalBlocks, 1, blockOutput, false), m_blockStep((blockStep > 0) ? blockStep : blockInput)
+Layer::Layer(unsigned totalBlocks, size_t blockInput, size_t blockOutput, size_t blockStep,
+	bool sharedWeights)
+: m_sparseMatrix((sharedWeights && totalBlocks > 0) ? 1 : totalBlocks, blockInput, blockOutput, true),
+  m_bias((sharedWeights && totalBlocks > 0) ? 1 : totalBlocks, 1, blockOutput, false),
+  m_blockStep((blockStep > 0) ? blockStep : blockInput),
+  m_tiles(sharedWeights ? totalBlocks : 0), m_type(Weighted), m_poolingOutputs(0),
+  m_activation(Sigmoid)
 {
 
 }
 
+Layer::Layer(Type pooling, size_t tiles, size_t blockInput, size_t blockOutput)
+: m_sparseMatrix(0, blockInput, blockOutput, true), m_bias(0, 1, blockOutput, false),
+  m_blockStep(blockInput), m_tiles(tiles), m_type(pooling), m_poolingOutputs(blockOutput),
+  m_activation(Sigmoid)
+{
+	assert(isPooling());
+	assertM(blockOutput > 0 && blockInput % blockOutput == 0, "Pooling layer inputs per tile "
+		<< blockInput << " is not a multiple of its outputs per tile " << blockOutput << ".");
+}
+
 Layer::Layer(const Layer& l)
-: m_sparseMatrix(l.m_sparseMatrix), m_bias(l.m_bias), m_blockStep(l.m_blockStep)
+: m_sparseMatrix(l.m_sparseMatrix), m_bias(l.m_bias), m_blockStep(l.m_blockStep),
+  m_tiles(l.m_tiles), m_type(l.m_type), m_poolingOutputs(l.m_poolingOutputs),
+  m_activation(l.m_activation)
 {
 
 }
@@ -40,6 +86,10 @@ Layer& Layer::operator=(const Layer& l)
 	m_sparseMatrix = l.m_sparseMatrix;
 	m_bias = l.m_bias;
 	m_blockStep = l.m_blockStep;
+	m_tiles = l.m_tiles;
+	m_type = l.m_type;
+	m_poolingOutputs = l.m_poolingOutputs;
+	m_activation = l.m_activation;
 	
 	return *this;
 }
@@ -49,93 +99,828 @@ Layer& Layer::operator=(Layer&& l)
 	std::swap(m_sparseMatrix, l.m_sparseMatrix);
 	std::swap(m_bias, l.m_bias);
 	std::swap(m_blockStep, l.m_blockStep);
+	std::swap(m_tiles, l.m_tiles);
+	std::swap(m_type, l.m_type);
+	std::swap(m_poolingOutputs, l.m_poolingOutputs);
+	std::swap(m_activation, l.m_activation);
 	
 	return *this;
 }
 
+static void initializeBlockRandomly(Layer::Matrix& block, uint64_t seed,
+	uint64_t stream, float epsilon, size_t connections)
+{
+	util::PhiloxRandomEngine engine(seed, stream);
+
+	size_t rows    = block.rows();
+	size_t columns = block.columns();
+
+	float* data = block.data().data();
+
+	if(connections == 0 || connections >= rows)
+	{
+		for(size_t i = 0; i < rows * columns; ++i)
+		{
+			data[i] = engine.uniform(-epsilon, epsilon);
+		}
+
+		return;
+	}
+
+	std::vector<size_t> inputs(rows);
+
+	std::iota(inputs.begin(), inputs.end(), 0);
+
+	for(size_t column = 0; column < columns; ++column)
+	{
+		// a partial shuffle selects distinct inputs for each neuron
+		for(size_t i = 0; i < connections; ++i)
+		{
+			std::swap(inputs[i], inputs[i + engine() % (rows - i)]);
+
+			data[inputs[i] * columns + column] = engine.uniform(-epsilon, epsilon);
+		}
+	}
+}
+
 void Layer::initializeRandomly(std::default_random_engine& engine, float e)
 {
-	e = util::KnobDatabase::getKnobValue("Layer::RandomInitializationEpsilon", e);	
+	if(isPooling())
+	{
+		return;
+	}
+
+	if(randomInitializationEpsilon.isSet())
+	{
+		e = randomInitializationEpsilon;
+	}
+
+	size_t connections = sparseInitializationConnections;
 
-	float epsilon = std::sqrt((e) / (getInputBlockingFactor() + getOutputBlockingFactor() + 1));
+	size_t inputs = getInputBlockingFactor();
+
+	if(connections != 0)
+	{
+		inputs = std::min(inputs, connections);
+	}
+
+	float epsilon = std::sqrt((e) / (inputs + getOutputBlockingFactor() + 1));
 	
-	m_sparseMatrix.assignUniformRandomValues(engine, -epsilon, epsilon);
+	// each block is an independent stream, so the weights depend only on
+	// the engine, not on the number of threads
+	// separate statements, the order operands are evaluated is unspecified
+	uint64_t high = engine();
+	uint64_t low  = engine();
+
+	uint64_t seed = (high << 32) ^ low;
+
+	BlockSparseMatrix weights(true);
+
+	for(size_t block = 0; block < m_sparseMatrix.blocks(); ++block)
+	{
+		weights.push_back(Matrix(getInputBlockingFactor(), getOutputBlockingFactor()));
+	}
+
+	size_t threads = 1;
+
+	if(totalWeights() >= parallelInitializationWeights)
+	{
+		threads = initializationThreads;
+
+		if(threads == 0)
+		{
+			threads = std::max(1U, util::getHardwareThreadCount());
+		}
+
+		threads = std::min(threads, weights.blocks());
+	}
+
+	auto initializeBlocks = [&](size_t thread)
+	{
+		for(size_t block = thread; block < weights.blocks(); block += threads)
+		{
+			initializeBlockRandomly(weights[block], seed, block, epsilon,
+				connections);
+		}
+	};
+
+	std::vector<std::thread> workers;
+
+	for(size_t thread = 1; thread < threads; ++thread)
+	{
+		workers.push_back(std::thread(initializeBlocks, thread));
+	}
+
+	initializeBlocks(0);
+
+	for(auto& worker : workers)
+	{
+		worker.join();
+	}
+
+	m_sparseMatrix = std::move(weights);
 
 	// assign bias to 0.0f
 	m_bias.assignSelf(0.0f);
 }
 
-Layer::BlockSparseMatrix Layer::runInputs(const BlockSparseMatrix& m) const
+static Layer::Matrix stackBlocks(const Layer::BlockSparseMatrix& m)
 {
-	if(util::isLogEnabled("Layer"))
+	assert(!m.empty());
+	assert(!m.isRowSparse());
+
+	size_t rows    = m.rows();
+	size_t columns = m.columnsPerBlock();
+
+	Layer::Matrix result(m.blocks() * rows, columns);
+
+	float* resultData = result.data().data();
+
+	for(auto& block : m)
 	{
-		util::log("Layer") << " Running forward propagation on matrix (" << m.rows()
-			<< " rows, " << m.columns() << " columns) through layer with dimensions ("
-			<< blocks() << " blocks, "
-			<< getInputCount() << " inputs, " << getOutputCount()
-			<< " outputs, " << blockStep() << " block step).\n";
-		util::log("Layer") << "  layer: " << m_sparseMatrix.shapeString() << "\n";
+		assert(block.rows() == rows && block.columns() == columns);
+
+		std::memcpy(resultData, block.data().data(), block.size() * sizeof(float));
+
+		resultData += block.size();
+	}
+
+	return result;
+}
+
+static Layer::BlockSparseMatrix splitRows(const Layer::Matrix& m, size_t blocks)
+{
+	Layer::BlockSparseMatrix result(false);
+
+	size_t rows = m.rows() / blocks;
+
+	for(size_t block = 0; block < blocks; ++block)
+	{
+		result.push_back(m.slice(block * rows, 0, rows, m.columns()));
+	}
+
+	return result;
+}
+
+/*! \brief im2col, one row per (window, sample) pair, so the product of
+	the windows with a filter bank holds each window's outputs in a
+	contiguous slice of rows.  Windows that run off the end are zero
+	extended, matching convolutionalMultiply.
+*/
+static Layer::Matrix gatherWindows(const Layer::Matrix& input, size_t windows,
+	size_t windowSize, size_t step)
+{
+	size_t samples = input.rows();
+	size_t columns = input.columns();
+
+	Layer::Matrix result(windows * samples, windowSize);
+
+	const float* inputData  = input.data().data();
+	float*       resultData = result.data().data();
+
+	for(size_t window = 0; window < windows; ++window)
+	{
+		size_t leftBegin = window * step;
+		size_t extent    = std::min(columns - leftBegin, windowSize);
+
+		for(size_t sample = 0; sample < samples; ++sample)
+		{
+			const float* begin = inputData + sample * columns + leftBegin;
+
+			std::copy(begin, begin + extent,
+				resultData + (window * samples + sample) * windowSize);
+		}
+	}
+
+	return result;
+}
+
+/*! \brief col2im, the inverse of gatherWindows, overlapping windows add */
+static Layer::Matrix scatterWindows(const Layer::Matrix& windowMatrix,
+	size_t windows, size_t step, size_t columns)
+{
+	size_t samples    = windowMatrix.rows() / windows;
+	size_t windowSize = windowMatrix.columns();
+
+	Layer::Matrix result(samples, columns);
+
+	const float* windowData = windowMatrix.data().data();
+	float*       resultData = result.data().data();
+
+	for(size_t window = 0; window < windows; ++window)
+	{
+		size_t leftBegin = window * step;
+		size_t extent    = std::min(columns - leftBegin, windowSize);
+
+		for(size_t sample = 0; sample < samples; ++sample)
+		{
+			const float* source = windowData +
+				(window * samples + sample) * windowSize;
+			float* destination = resultData + sample * columns + leftBegin;
+
+			for(size_t i = 0; i < extent; ++i)
+			{
+				destination[i] += source[i];
+			}
+		}
+	}
+
+	return result;
+}
+
+static size_t getWindowCount(size_t columns, size_t step)
+{
+	return (columns + step - 1) / step;
+}
+
+static Layer::BlockSparseMatrix splitColumns(const Layer::Matrix& m,
+	size_t blockingFactor)
+{
+	Layer::BlockSparseMatrix result(false);
+
+	for(size_t column = 0; column < m.columns(); column += blockingFactor)
+	{
+		size_t columns = std::min(m.columns() - column, blockingFactor);
+
+		result.push_back(m.slice(0, column, m.rows(), columns));
+	}
+
+	return result;
+}
+
+/*! \brief A single streaming pass, each output reduces 'width' consecutive
+	inputs of the same row */
+static Layer::Matrix pool(const Layer::Matrix& input, size_t width,
+	Layer::Type type)
+{
+	size_t rows    = input.rows();
+	size_t columns = input.columns() / width;
+
+	assert(input.columns() % width == 0);
+
+	Layer::Matrix result(rows, columns);
+
+	const float* inputData  = input.data().data();
+	float*       resultData = result.data().data();
+
+	for(size_t row = 0; row < rows; ++row)
+	{
+		for(size_t column = 0; column < columns; ++column, inputData += width)
+		{
+			float value = inputData[0];
+
+			if(type == Layer::MaxPooling)
+			{
+				for(size_t i = 1; i < width; ++i)
+				{
+					value = std::max(value, inputData[i]);
+				}
+			}
+			else
+			{
+				for(size_t i = 1; i < width; ++i)
+				{
+					value += inputData[i];
+				}
+
+				value /= width;
+			}
+
+			*resultData++ = value;
+		}
+	}
+
+	return result;
+}
+
+/*! \brief Route each output delta to the input that produced the maximum,
+	or spread it evenly over the inputs that were averaged */
+static Layer::Matrix unpool(const Layer::Matrix& delta, const Layer::Matrix& input,
+	size_t width, Layer::Type type)
+{
+	size_t rows    = delta.rows();
+	size_t columns = delta.columns();
+
+	assert(input.rows() == rows && input.columns() == columns * width);
+
+	Layer::Matrix result(rows, columns * width);
+
+	const float* deltaData  = delta.data().data();
+	const float* inputData  = input.data().data();
+	float*       resultData = result.data().data();
+
+	for(size_t row = 0; row < rows; ++row)
+	{
+		for(size_t column = 0; column < columns; ++column,
+			inputData += width, resultData += width)
+		{
+			float value = *deltaData++;
+
+			if(type == Layer::MaxPooling)
+			{
+				size_t maximum = 0;
+
+				for(size_t i = 1; i < width; ++i)
+				{
+					if(inputData[i] > inputData[maximum])
+					{
+						maximum = i;
+					}
+				}
+
+				resultData[maximum] = value;
+			}
+			else
+			{
+				std::fill(resultData, resultData + width, value / width);
+			}
+		}
+	}
+
+	return result;
+}
+
+static const size_t noLabel = std::numeric_limits<size_t>::max();
+
+/*! \brief The label of each reference row, the column of its largest value
+	across all blocks.  A row without a single largest value (e.g. a sample
+	whose label is not one of the outputs) has no label. */
+static std::vector<size_t> getLabelColumns(const Layer::BlockSparseMatrix& m)
+{
+	std::vector<size_t> columns(m.rows(), noLabel);
+	std::vector<float>  maximums(m.rows(), -std::numeric_limits<float>::max());
+	std::vector<bool>   isTied(m.rows(), false);
+	
+	size_t blockBegin = 0;
+	
+	for(auto& block : m)
+	{
+		const float* data = block.data().data();
+		
+		for(size_t row = 0; row < block.rows(); ++row)
+		{
+			const float* rowData = data + row * block.columns();
+			
+			for(size_t column = 0; column < block.columns(); ++column)
+			{
+				if(rowData[column] > maximums[row])
+				{
+					maximums[row] = rowData[column];
+					columns[row]  = blockBegin + column;
+					isTied[row]   = false;
+				}
+				else if(rowData[column] == maximums[row])
+				{
+					isTied[row] = true;
+				}
+			}
+		}
+		
+		blockBegin += block.columns();
 	}
 	
-	if(util::isLogEnabled("Layer::Detail"))
+	for(size_t row = 0; row < columns.size(); ++row)
 	{
-		util::log("Layer::Detail") << "  input: " << m.debugString() << "\n";
-		util::log("Layer::Detail") << "  layer: " << m_sparseMatrix.debugString() << "\n";
-		util::log("Layer::Detail") << "  bias:  " << m_bias.debugString() << "\n";
+		if(isTied[row])
+		{
+			columns[row] = noLabel;
+		}
 	}
 	
-	auto unbiasedOutput = m.convolutionalMultiply(m_sparseMatrix, blockStep());
-	auto output = unbiasedOutput.convolutionalAddBroadcastRow(m_bias);
+	return columns;
+}
+
+/*! \brief Normalize each row to a distribution, subtracting the row maximum
+	first so that exp() cannot overflow. */
+static void softmaxSelf(Layer::BlockSparseMatrix& m)
+{
+	assert(!m.isRowSparse());
+	
+	size_t rows = m.rows();
 	
-	output.sigmoidSelf();
+	std::vector<float> maximums(rows, -std::numeric_limits<float>::max());
+	std::vector<float> sums(rows, 0.0f);
+	
+	for(auto& block : m)
+	{
+		const float* data = block.data().data();
+		
+		for(size_t row = 0; row < rows; ++row)
+		{
+			const float* rowData = data + row * block.columns();
+			
+			maximums[row] = std::max(maximums[row],
+				*std::max_element(rowData, rowData + block.columns()));
+		}
+	}
 	
-	if(util::isLogEnabled("Layer"))
+	for(auto& block : m)
 	{
-		util::log("Layer") << "  output: " << output.shapeString() << "\n";
+		float* data = block.data().data();
+		
+		for(size_t row = 0; row < rows; ++row)
+		{
+			float* rowData = data + row * block.columns();
+			
+			for(size_t column = 0; column < block.columns(); ++column)
+			{
+				rowData[column] = std::exp(rowData[column] - maximums[row]);
+				sums[row] += rowData[column];
+			}
+		}
 	}
 	
-	if(util::isLogEnabled("Layer::Detail"))
+	for(auto& block : m)
 	{
-		util::log("Layer::Detail") << "  output: " << output.debugString() << "\n";
+		float* data = block.data().data();
+		
+		for(size_t row = 0; row < rows; ++row)
+		{
+			float* rowData = data + row * block.columns();
+			
+			float scale = 1.0f / sums[row];
+			
+			for(size_t column = 0; column < block.columns(); ++column)
+			{
+				rowData[column] *= scale;
+			}
+		}
 	}
+}
 
-	return output;
+/*! \brief The element-wise function of an activation, softmax has none */
+static matrix::ActivationFunction::Type getActivationFunction(
+	Layer::Activation activation)
+{
+	switch(activation)
+	{
+	case Layer::Softmax:
+	{
+		throw std::runtime_error("A softmax is not an element-wise activation.");
+	}
+	case Layer::RectifiedLinear:
+	{
+		return matrix::ActivationFunction::RectifiedLinear;
+	}
+	case Layer::LeakyRectifiedLinear:
+	{
+		return matrix::ActivationFunction::LeakyRectifiedLinear;
+	}
+	case Layer::HardSigmoid:
+	{
+		return matrix::ActivationFunction::HardSigmoid;
+	}
+	case Layer::Tanh:
+	{
+		return matrix::ActivationFunction::Tanh;
+	}
+	default:
+	{
+		return matrix::ActivationFunction::Sigmoid;
+	}
+	}
 }
 
-Layer::BlockSparseMatrix Layer::runReverse(const BlockSparseMatrix& m) const
+/*! \brief Add the bias and apply the activation in one pass over the output,
+	optionally writing the activation derivative in the same pass. */
+static void addBiasAndActivate(Layer::BlockSparseMatrix& output,
+	const Layer::BlockSparseMatrix& bias, Layer::Activation activation,
+	Layer::BlockSparseMatrix* derivative)
 {
-	if(util::isLogEnabled("Layer"))
+	if(activation == Layer::Softmax)
 	{
-		util::log("Layer") << " Running reverse propagation on matrix (" << m.rows()
-			<< " rows, " << m.columns() << " columns) through layer with dimensions ("
-			<< blocks() << " blocks, "
-			<< getInputCount() << " inputs, " << getOutputCount()
-			<< " outputs, " << blockStep() << " block step).\n";
-		util::log("Layer") << "  layer: " << m_sparseMatrix.shapeString() << "\n";
-  	}
+		// normalization needs every block of a row, it has no element-wise
+		// derivative
+		if(!bias.empty())
+		{
+			output = output.convolutionalAddBroadcastRow(bias);
+		}
+		
+		softmaxSelf(output);
+		
+		if(derivative != nullptr)
+		{
+			*derivative = Layer::BlockSparseMatrix();
+		}
+		
+		return;
+	}
+	
+	auto function = getActivationFunction(activation);
+	
+	if(derivative != nullptr)
+	{
+		output.addBiasAndActivateSelf(bias, function, *derivative);
+	}
+	else
+	{
+		output.addBiasAndActivateSelf(bias, function);
+	}
+}
+
+Layer::BlockSparseMatrix Layer::runInputs(const BlockSparseMatrix& m) const
+{
+	return _runInputs(m, nullptr);
+}
+
+Layer::BlockSparseMatrix Layer::runInputs(const BlockSparseMatrix& m,
+	BlockSparseMatrix& activationDerivative) const
+{
+	return _runInputs(m, &activationDerivative);
+}
+
+Layer::BlockSparseMatrix Layer::_runInputs(const BlockSparseMatrix& m,
+	BlockSparseMatrix* activationDerivative) const
+{
+	util::ProfilerScope scope("Layer::runInputs");
+
+	logIf(layerLog) << " Running forward propagation on matrix (" << m.rows()
+		<< " rows, " << m.columns() << " columns) through layer with dimensions ("
+		<< blocks() << " blocks, "
+		<< getInputCount() << " inputs, " << getOutputCount()
+		<< " outputs, " << blockStep() << " block step).\n";
+	logIf(layerLog) << "  layer: " << m_sparseMatrix.shapeString() << "\n";
+	
+	logIf(layerDetailLog) << "  input: " << m.debugString() << "\n";
+	logIf(layerDetailLog) << "  layer: " << m_sparseMatrix.debugString() << "\n";
+	logIf(layerDetailLog) << "  bias:  " << m_bias.debugString() << "\n";
+	
+	BlockSparseMatrix output;
+	
+	if(isPooling())
+	{
+		size_t width = getInputBlockingFactor() / getOutputBlockingFactor();
+		
+		output = splitColumns(pool(m.toMatrix(), width, getType()),
+			getOutputBlockingFactor());
+		
+		// one comparison or add per input
+		scope.addFloatingPointOperations(m.rows() * m.columns());
+		
+		if(activationDerivative != nullptr)
+		{
+			*activationDerivative = BlockSparseMatrix();
+		}
+	}
+	else if(isWeightShared())
+	{
+		// a single GEMM of every window against the shared filter bank
+		auto input   = m.toMatrix();
+		auto windows = getWindowCount(input.columns(), blockStep());
+		
+		auto outputMatrix = gatherWindows(input, windows, getInputBlockingFactor(),
+			blockStep()).multiply(m_sparseMatrix[0]);
+		
+		output = splitRows(outputMatrix, windows);
+		
+		// the single bias block applies to every window
+		addBiasAndActivate(output, m_bias, getActivation(), activationDerivative);
+	}
+	else
+	{
+		output = m.convolutionalMultiply(m_sparseMatrix, blockStep());
+		
+		addBiasAndActivate(output, m_bias, getActivation(), activationDerivative);
+	}
+	
+	if(!isPooling())
+	{
+		// a multiply-add per input of each block, for each output
+		scope.addFloatingPointOperations(
+			2 * output.rows() * output.columns() * getInputBlockingFactor());
+	}
+	
+	logIf(layerLog) << "  output: " << output.shapeString() << "\n";
+	
+	logIf(layerDetailLog) << "  output: " << output.debugString() << "\n";
+
+	return output;
+}
+
+Layer::BlockSparseMatrix Layer::runReverse(const BlockSparseMatrix& m,
+	const BlockSparseMatrix& input) const
+{
+	util::ProfilerScope scope("Layer::runReverse");
+
+	logIf(layerLog) << " Running reverse propagation on matrix (" << m.rows()
+		<< " rows, " << m.columns() << " columns) through layer with dimensions ("
+		<< blocks() << " blocks, "
+		<< getInputCount() << " inputs, " << getOutputCount()
+		<< " outputs, " << blockStep() << " block step).\n";
+	logIf(layerLog) << "  layer: " << m_sparseMatrix.shapeString() << "\n";
  
-	auto result = m.reverseConvolutionalMultiply(m_sparseMatrix.transpose());
+	BlockSparseMatrix result;
+	
+	if(isPooling())
+	{
+		size_t width = getInputBlockingFactor() / getOutputBlockingFactor();
+		
+		result = splitColumns(unpool(m.toMatrix(), input.toMatrix(), width,
+			getType()), getInputBlockingFactor());
+		
+		scope.addFloatingPointOperations(result.rows() * result.columns());
+	}
+	else if(isWeightShared())
+	{
+		// one GEMM against the transposed filter bank, then col2im
+		auto windows = m.blocks();
+		
+		auto windowMatrix = stackBlocks(m).multiply(m_sparseMatrix[0].transpose());
+		auto inputMatrix  = scatterWindows(windowMatrix, windows, blockStep(),
+			windows * blockStep());
+		
+		// blocked like NeuralNetwork::formatInputForLayer
+		result = splitColumns(inputMatrix, getInputBlockingFactor());
+	}
+	else
+	{
+		result = m.reverseConvolutionalMultiply(m_sparseMatrix.transpose());
+	}
 
-	if(util::isLogEnabled("Layer"))
+	if(!isPooling())
 	{
-		util::log("Layer") << "  output: " << result.shapeString() << "\n";
+		scope.addFloatingPointOperations(
+			2 * result.rows() * result.columns() * getOutputBlockingFactor());
 	}
+
+	logIf(layerLog) << "  output: " << result.shapeString() << "\n";
+	
+	logIf(layerDetailLog) << "  output: " << result.debugString() << "\n";
+
+	return result;
+}
+
+Layer::BlockSparseMatrix Layer::applyActivationDerivative(
+	const BlockSparseMatrix& delta, const BlockSparseMatrix& output) const
+{
+	// pooling layers pass their inputs through unchanged
+	if(isPooling())
+	{
+		return delta;
+	}
+
+	if(getActivation() == Softmax)
+	{
+		throw std::runtime_error("A softmax layer can only be the output layer "
+			"of a network.");
+	}
+
+	// every derivative is a function of the output alone
+	auto derivative = output;
 	
-	if(util::isLogEnabled("Layer::Detail"))
+	derivative.activationDerivativeSelf(getActivationFunction(getActivation()));
+
+	return delta.elementMultiply(derivative);
+}
+
+Layer::BlockSparseMatrix Layer::applyActivationDerivative(
+	const BlockSparseMatrix& delta, const BlockSparseMatrix& output,
+	const BlockSparseMatrix& activationDerivative) const
+{
+	if(isPooling() || activationDerivative.empty())
 	{
-		util::log("Layer::Detail") << "  output: " << result.debugString() << "\n";
+		return applyActivationDerivative(delta, output);
 	}
+	
+	return delta.elementMultiply(activationDerivative);
+}
+
+Layer::BlockSparseMatrix Layer::getOutputDelta(const BlockSparseMatrix& output,
+	const BlockSparseMatrix& reference) const
+{
+	if(isPooling() || getActivation() != Softmax)
+	{
+		return applyActivationDerivative(output.subtract(reference), output);
+	}
+	
+	// softmax and cross entropy combine to (output - one hot label), the
+	// reference only supplies the label of each sample
+	auto labels = getLabelColumns(reference);
+	auto delta  = output;
+	
+	size_t blockBegin = 0;
+	
+	for(auto& block : delta)
+	{
+		float* data = block.data().data();
+		
+		for(size_t row = 0; row < block.rows(); ++row)
+		{
+			// an unlabeled sample contributes nothing to the gradient
+			if(labels[row] == noLabel)
+			{
+				std::fill(data + row * block.columns(),
+					data + (row + 1) * block.columns(), 0.0f);
+			}
+			else if(labels[row] >= blockBegin && labels[row] < blockBegin + block.columns())
+			{
+				data[row * block.columns() + labels[row] - blockBegin] -= 1.0f;
+			}
+		}
+		
+		blockBegin += block.columns();
+	}
+	
+	return delta;
+}
+
+float Layer::getOutputCost(const BlockSparseMatrix& output,
+	const BlockSparseMatrix& reference) const
+{
+	if(isPooling() || getActivation() != Softmax)
+	{
+		auto errors = reference.subtract(output);
+		
+		return errors.elementMultiply(errors).reduceSum() / 2.0f;
+	}
+	
+	auto labels = getLabelColumns(reference);
+	
+	double cost = 0.0;
+	
+	size_t blockBegin = 0;
+	
+	for(auto& block : output)
+	{
+		const float* data = block.data().data();
+		
+		for(size_t row = 0; row < block.rows(); ++row)
+		{
+			// an unlabeled sample is never inside a block, so it has no cost
+			if(labels[row] >= blockBegin && labels[row] < blockBegin + block.columns())
+			{
+				float probability = data[row * block.columns() + labels[row] - blockBegin];
+				
+				cost -= std::log(std::max(probability, std::numeric_limits<float>::min()));
+			}
+		}
+		
+		blockBegin += block.columns();
+	}
+	
+	return cost;
+}
+
+Layer::BlockSparseMatrix Layer::getSharedWeightDerivative(
+	const BlockSparseMatrix& activation, const BlockSparseMatrix& delta) const
+{
+	util::ProfilerScope scope("Layer::getSharedWeightDerivative");
+
+	assert(isWeightShared());
+
+	auto input   = activation.toMatrix();
+	auto windows = getWindowCount(input.columns(), blockStep());
+
+	assert(windows == delta.blocks());
+
+	// accumulate over every position with one (windows * samples) deep GEMM
+	auto windowMatrix = gatherWindows(input, windows, getInputBlockingFactor(),
+		blockStep());
+
+	BlockSparseMatrix result(true);
+
+	result.push_back(windowMatrix.transpose().multiply(stackBlocks(delta)));
+
+	scope.addFloatingPointOperations(2 * windowMatrix.size() *
+		getOutputBlockingFactor());
+
+	return result;
+}
+
+Layer::BlockSparseMatrix Layer::getSharedBiasDerivative(
+	const BlockSparseMatrix& delta) const
+{
+	assert(isWeightShared());
+
+	BlockSparseMatrix result(false);
+
+	result.push_back(stackBlocks(delta).reduceSumAlongRows());
 
 	return result;
 }
 
 void Layer::transpose()
 {
+	if(isPooling())
+	{
+		return;
+	}
+
 	m_sparseMatrix.transposeSelf();
 }
 
 size_t Layer::getInputCount() const
 {
+	if(isPooling())
+	{
+		return tiles() * getInputBlockingFactor();
+	}
+
+	if(isWeightShared())
+	{
+		return tiles() * m_sparseMatrix.rowsPerBlock();
+	}
+
 	return m_sparseMatrix.rows();
 }
 
@@ -143,7 +928,7 @@ size_t Layer::getOutputCount() const
 {
 	size_t outputCount = getOutputCountForInputCount(getInputCount());	
 
-	util::log("Layer") << m_sparseMatrix.shapeString()
+	logIf(layerLog) << m_sparseMatrix.shapeString()
 		<< ": Output count for input count " << getInputCount()
 		<< " is " << outputCount << "\n";
 
@@ -152,19 +937,30 @@ size_t Layer::getOutputCount() const
 
 size_t Layer::getInputBlockingFactor() const
 {
+	// pooling tiles never overlap
+	if(isPooling())
+	{
+		return blockStep();
+	}
+
 	return m_sparseMatrix.getBlockingFactor();
 }
 
 size_t Layer::getOutputBlockingFactor() const
 {
+	if(isPooling())
+	{
+		return m_poolingOutputs;
+	}
+
 	return m_sparseMatrix.columnsPerBlock();
 }
 
 size_t Layer::getOutputCountForInputCount(size_t inputCount) const
 {
-	size_t outputCount = (inputCount / blockStep()) * (m_sparseMatrix.columnsPerBlock());
+	size_t outputCount = (inputCount / blockStep()) * getOutputBlockingFactor();
 	
-	util::log("Layer") << m_sparseMatrix.shapeString()
+	logIf(layerLog) << m_sparseMatrix.shapeString()
 		<< ": Output count for input count " << inputCount
 		<< " is " << outputCount << "\n";
 
@@ -173,8 +969,14 @@ size_t Layer::getOutputCountForInputCount(size_t inputCount) const
 
 size_t Layer::getFloatingPointOperationCount() const
 {
-	// blocks * blockInputs^2 * blockOutputs
-	return blocks() * getInputBlockingFactor() * getInputBlockingFactor() * getOutputBlockingFactor();
+	if(isPooling())
+	{
+		return getInputCount();
+	}
+
+
+	// tiles * blockInputs^2 * blockOutputs
+	return tiles() * getInputBlockingFactor() * getInputBlockingFactor() * getOutputBlockingFactor();
 }
 
 size_t Layer::totalNeurons() const
@@ -379,6 +1181,120 @@ void Layer::setBlockStep(size_t step)
 	m_blockStep = step;
 }
 
+size_t Layer::tiles() const
+{
+	return (m_tiles > 0) ? m_tiles : blocks();
+}
+
+bool Layer::isWeightShared() const
+{
+	return !isPooling() && m_tiles > 0;
+}
+
+Layer::Type Layer::getType() const
+{
+	return m_type;
+}
+
+bool Layer::isPooling() const
+{
+	return m_type != Weighted;
+}
+
+std::string Layer::getPoolingName() const
+{
+	assert(isPooling());
+
+	return m_type == MaxPooling ? "max" : "average";
+}
+
+Layer::Type Layer::getPoolingTypeForName(const std::string& name)
+{
+	if(name == "max")
+	{
+		return MaxPooling;
+	}
+
+	if(name == "average")
+	{
+		return AveragePooling;
+	}
+
+	throw std::runtime_error("Unknown pooling type '" + name +
+		"', expecting 'max' or 'average'.");
+}
+
+Layer::Activation Layer::getActivation() const
+{
+	return m_activation;
+}
+
+void Layer::setActivation(Activation activation)
+{
+	m_activation = activation;
+}
+
+std::string Layer::getActivationName() const
+{
+	switch(m_activation)
+	{
+	case Softmax:              return "softmax";
+	case RectifiedLinear:      return "relu";
+	case LeakyRectifiedLinear: return "leaky-relu";
+	case HardSigmoid:          return "hard-sigmoid";
+	case Tanh:                 return "tanh";
+	default:                   return "sigmoid";
+	}
+}
+
+Layer::Activation Layer::getActivationForName(const std::string& name)
+{
+	if(name == "sigmoid")
+	{
+		return Sigmoid;
+	}
+
+	if(name == "softmax")
+	{
+		return Softmax;
+	}
+
+	if(name == "relu")
+	{
+		return RectifiedLinear;
+	}
+
+	if(name == "leaky-relu")
+	{
+		return LeakyRectifiedLinear;
+	}
+
+	if(name == "hard-sigmoid")
+	{
+		return HardSigmoid;
+	}
+
+	if(name == "tanh")
+	{
+		return Tanh;
+	}
+
+	throw std::runtime_error("Unknown activation function '" + name +
+		"', expecting 'sigmoid', 'softmax', 'relu', 'leaky-relu', "
+		"'hard-sigmoid', or 'tanh'.");
+}
+
+float Layer::applyActivation(Activation activation, float value)
+{
+	return matrix::ActivationFunction::apply(getActivationFunction(activation),
+		value);
+}
+
+void Layer::setSharedTiles(size_t tiles)
+{
+	m_tiles = tiles;
+}
+
 bool Layer::empty() const
 {
 	return m_sparseMatrix.empty();
@@ -421,6 +1337,12 @@ Layer::NeuronSet Layer::getInputNeuronsConnectedToTheseOutputs(
 Layer Layer::getSubgraphConnectedToTheseOutputs(
 	const NeuronSet& outputs) const
 {
+	// every output depends on the one shared block, or on no weights
+	if(isWeightShared() || isPooling())
+	{
+		return *this;
+	}
+
 	typedef std::set<size_t> BlockSet;
 	
 	BlockSet blocks;
@@ -436,6 +1358,8 @@ Layer Layer::getSubgraphConnectedToTheseOutputs(
 	Layer layer(blocks.size(), getInputBlockingFactor(),
 		getOutputBlockingFactor(), blockStep());
 	
+	layer.setActivation(getActivation());
+	
 	for(auto& block : blocks)
 	{
 		size_t blockIndex = block - *blocks.begin();
@@ -29,6 +29,12 @@ namespace minerva
 namespace neuralnetwork
 {
 
+static util::LogChannel neuralNetworkLog("NeuralNetwork");
+
+static util::Knob<std::string> forceBackPropagationTypeKnob(
+	"BackPropagation::ForceType", "",
+	"Override the back propagation type chosen from the cost function");
+
 NeuralNetwork::NeuralNetwork()
 : _useSparseCostFunction(false)
 {
@@ -37,7 +43,7 @@ NeuralNetwork::NeuralNetwork()
 
 void NeuralNetwork::initializeRandomly(std::default_random_engine& engine, float epsilon)
 {
-	util::log("NeuralNetwork") << "Initializing neural network randomly.\n";
+	logIf(neuralNetworkLog) << "Initializing neural network randomly.\n";
 
 	for (auto i = _layers.begin(); i != _layers.end(); ++i)
 	{
@@ -75,7 +81,7 @@ void NeuralNetwork::train(BlockSparseMatrix& input, BlockSparseMatrix& reference
 {
 	//create a backpropagate-data class
 	//given the neural network, inputs & reference outputs 
-	util::log("NeuralNetwork") << "Running back propagation on input matrix (" << input.rows() << ") rows, ("
+	logIf(neuralNetworkLog) << "Running back propagation on input matrix (" << input.rows() << ") rows, ("
 	   << input.columns() << ") columns. Using reference output of (" << reference.rows() << ") rows, ("
 	   << reference.columns() << ") columns. \n";
 
@@ -105,7 +111,7 @@ void NeuralNetwork::train(BlockSparseMatrix& input, BlockSparseMatrix& reference
 
 NeuralNetwork::Matrix NeuralNetwork::runInputs(const Matrix& m) const
 {
-	//util::log("NeuralNetwork") << "Running forward propagation on matrix (" << m.rows()
+	//logIf(neuralNetworkLog) << "Running forward propagation on matrix (" << m.rows()
 	//		<< " rows, " << m.columns() << " columns).\n";
 	
 	auto temp = convertToBlockSparseForLayerInput(front(), m);
@@ -119,7 +125,7 @@ NeuralNetwork::BlockSparseMatrix NeuralNetwork::runInputs(const BlockSparseMatri
 
 	for (auto i = _layers.begin(); i != _layers.end(); ++i)
 	{
-		util::log("NeuralNetwork") << " Running forward propagation through layer "
+		logIf(neuralNetworkLog) << " Running forward propagation through layer "
 			<< std::distance(_layers.begin(), i) << "\n";
 		//formatInputForLayer(*i, temp);
 		temp = (*i).runInputs(temp);
@@ -147,8 +153,8 @@ float NeuralNetwork::computeAccuracy(const BlockSparseMatrix& input,
 	auto resultActivations	  = result.greaterThanOrEqual(threshold);
 	auto referenceActivations = reference.greaterThanOrEqual(threshold);
 
-	util::log("NeuralNetwork") << "Result activations " << resultActivations.toString();
-	util::log("NeuralNetwork") << "Reference activations " << referenceActivations.toString();
+	logIf(neuralNetworkLog) << "Result activations " << resultActivations.toString();
+	logIf(neuralNetworkLog) << "Reference activations " << referenceActivations.toString();
 
 	auto matchingActivations = resultActivations.equals(referenceActivations);
 
@@ -170,7 +176,7 @@ std::string NeuralNetwork::getLabelForOutputNeuron(unsigned int i) const
 		return stream.str();
 	}
 	
-	util::log("NeuralNetwork") << "Getting output label for output neuron "
+	logIf(neuralNetworkLog) << "Getting output label for output neuron "
 		<< i << ", " << label->second << "\n";
 	
 	return label->second;
@@ -180,7 +186,7 @@ void NeuralNetwork::setLabelForOutputNeuron(unsigned int idx, const std::string&
 {
 	assert(idx < getOutputCount());
 
-	util::log("NeuralNetwork") << "Setting label for output neuron "
+	logIf(neuralNetworkLog) << "Setting label for output neuron "
 		<< idx << " to " << label << "\n";
 
 	_labels[idx] = label;
@@ -258,7 +264,7 @@ void NeuralNetwork::mirror(const Layer& layer)
 	assert(newInputs  > 0);
 	assert(newOutputs > 0);
 	
-	util::log("NeuralNetwork") << "Mirroring neural network output layer ("
+	logIf(neuralNetworkLog) << "Mirroring neural network output layer ("
 		<< back().blocks() << " blocks, " << back().getInputBlockingFactor()
 		<< " inputs, " << back().getOutputBlockingFactor()
 		<< " outputs) to (" << blocks << " blocks, " << newInputs
@@ -454,7 +460,13 @@ void NeuralNetwork::formatInputForLayer(const Layer& layer, BlockSparseMatrix& m
 	//	<< m.columns());
 	assert(m.columns() % layer.getInputCount() == 0);
 	
-	if(layer.blocks() == m.blocks()) return;
+	if(layer.isWeightShared() || layer.isPooling())
+	{
+		// shared and pooling layers slide over the flattened input, only
+		//  the blocking must match their reverse propagation
+		if(m.columnsPerBlock() == layer.getInputBlockingFactor()) return;
+	}
+	else if(layer.blocks() == m.blocks()) return;
 
 	assert(m.isColumnSparse());
 
@@ -466,7 +478,11 @@ void NeuralNetwork::formatOutputForLayer(const Layer& layer, BlockSparseMatrix&
 {
 	assert(m.columns() % layer.getOutputCount() == 0);
 	
-	if(layer.blocks() == m.blocks()) return;
+	if(layer.isWeightShared() || layer.isPooling())
+	{
+		if(m.columnsPerBlock() == layer.getOutputBlockingFactor()) return;
+	}
+	else if(layer.blocks() == m.blocks()) return;
 
 	assert(m.isColumnSparse());
 
@@ -605,8 +621,16 @@ BackPropagation* NeuralNetwork::createBackPropagation() const
 		backPropagationType = "DenseBackPropagation";
 	}
 	
-	backPropagationType = util::KnobDatabase::getKnobValue(
-		"BackPropagation::ForceType", backPropagationType);
+	// avoid the string knob lock in the common case
+	if(forceBackPropagationTypeKnob.isSet())
+	{
+		auto forcedType = forceBackPropagationTypeKnob.get();
+		
+		if(!forcedType.empty())
+		{
+			backPropagationType = forcedType;
+		}
+	}
 	
 	auto backPropagation = BackPropagationFactory::create(backPropagationType);
 	
@@ -670,7 +694,7 @@ bool NeuralNetwork::areConnectionsValid() const
 {
 	// TODO
 	
-	util::log("NeuralNetwork") << "Verified network with " << getInputCount()
+	logIf(neuralNetworkLog) << "Verified network with " << getInputCount()
 		<< " inputs and " << getOutputCount() << " outputs\n";
 	
 	return true;
@@ -716,7 +740,9 @@ std::string NeuralNetwork::shapeString() const
 	{
 		size_t index = &layer - &*begin();
 		
-		stream << " Layer " << index << ": [" << layer.blocks() << " blocks, "
+		stream << " Layer " << index << ": [" << layer.tiles()
+			<< (layer.isPooling() ? " tiles of " + layer.getPoolingName() + " pooling, " :
+				(layer.isWeightShared() ? " tiles sharing one block, " : " blocks, "))
 			<< layer.getInputCount() << " inputs ("
 			<< layer.getInputBlockingFactor() << " way blocked), "
 			<< layer.getOutputCount() << " outputs (" << layer.getOutputBlockingFactor()
@@ -0,0 +1,400 @@
+/*! \file   NeuralNetworkPruner.cpp
+	\author Gregory Diamos <gregory.diamos@gmail.com>
+	\date   Sunday October 18, 2026
+	\brief  The source file for the NeuralNetworkPruner class.
+*/
+
+// Minerva Includes
+#include <minerva/neuralnetwork/interface/NeuralNetworkPruner.h>
+#include <minerva/neuralnetwork/interface/NeuralNetwork.h>
+#include <minerva/neuralnetwork/interface/Layer.h>
+
+#include <minerva/matrix/interface/Matrix.h>
+
+#include <minerva/util/interface/debug.h>
+
+// Standard Library Includes
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+#include <set>
+
+namespace minerva
+{
+
+namespace neuralnetwork
+{
+
+typedef matrix::Matrix Matrix;
+typedef matrix::BlockSparseMatrix BlockSparseMatrix;
+typedef std::vector<size_t> IndexVector;
+typedef std::vector<IndexVector> IndexVectorVector;
+
+static util::LogChannel prunerLog("NeuralNetworkPruner");
+
+NeuralNetworkPruner::NeuralNetworkPruner()
+{
+
+}
+
+static float rootMeanSquare(const float* begin, size_t count, size_t stride)
+{
+	if(count == 0)
+	{
+		return 0.0f;
+	}
+
+	double sum = 0.0;
+
+	for(size_t i = 0; i < count; ++i)
+	{
+		float value = begin[i * stride];
+
+		sum += value * value;
+	}
+
+	return std::sqrt(sum / count);
+}
+
+static Matrix getBlockMask(const Matrix& block, float threshold,
+	bool canPruneNeurons)
+{
+	auto mask = block.abs().greaterThanOrEqual(threshold);
+
+	if(!canPruneNeurons)
+	{
+		return mask;
+	}
+
+	size_t rows    = block.rows();
+	size_t columns = block.columns();
+
+	const float* data = block.data().data();
+
+	if(rootMeanSquare(data, rows * columns, 1) < threshold)
+	{
+		mask.assignSelf(0.0f);
+
+		return mask;
+	}
+
+	float* maskData = mask.data().data();
+
+	for(size_t column = 0; column < columns; ++column)
+	{
+		if(rootMeanSquare(data + column, rows, columns) >= threshold)
+		{
+			continue;
+		}
+
+		for(size_t row = 0; row < rows; ++row)
+		{
+			maskData[row * columns + column] = 0.0f;
+		}
+	}
+
+	return mask;
+}
+
+void NeuralNetworkPruner::prune(NeuralNetwork& network, float threshold)
+{
+	_masks.clear();
+
+	for(size_t layerNumber = 0; layerNumber < network.size(); ++layerNumber)
+	{
+		auto& weights = network[layerNumber].getWeightsWithoutBias();
+
+		// removing outputs of the final layer would change the classes
+		bool canPruneNeurons = layerNumber + 1 < network.size();
+
+		BlockSparseMatrix mask(true);
+
+		for(auto& block : weights)
+		{
+			mask.push_back(getBlockMask(block, threshold, canPruneNeurons));
+		}
+
+		_masks.push_back(std::move(mask));
+	}
+
+	applyMask(network);
+
+	logIf(prunerLog) << "Pruned " << (getSparsity() * 100.0f)
+		<< "% of weights with threshold " << threshold << "\n";
+}
+
+void NeuralNetworkPruner::applyMask(NeuralNetwork& network) const
+{
+	if(_masks.size() != network.size())
+	{
+		throw std::runtime_error("Pruning mask does not match the network.");
+	}
+
+	for(size_t layerNumber = 0; layerNumber < network.size(); ++layerNumber)
+	{
+		auto& layer = network[layerNumber];
+		auto& mask  = _masks[layerNumber];
+
+		if(mask.empty())
+		{
+			continue;
+		}
+
+		layer.setWeightsWithoutBias(
+			layer.getWeightsWithoutBias().elementMultiply(mask));
+	}
+}
+
+static bool canRemoveOutputs(const Layer& layer, const Layer& next)
+{
+	if(layer.isPooling() || next.isPooling())
+	{
+		return false;
+	}
+	
+	// the constant output of a removed neuron is only known for an
+	// element-wise activation
+	if(layer.getActivation() == Layer::Softmax)
+	{
+		return false;
+	}
+
+	// overlapping windows would map a neuron to several weight blocks
+	if(!layer.isWeightShared() &&
+		layer.blockStep() != layer.getInputBlockingFactor())
+	{
+		return false;
+	}
+
+	if(next.blockStep() != next.getInputBlockingFactor())
+	{
+		return false;
+	}
+
+	if(next.getInputBlockingFactor() % layer.getOutputBlockingFactor() != 0)
+	{
+		return false;
+	}
+
+	if(layer.getOutputCount() != next.getInputCount())
+	{
+		return false;
+	}
+
+	// a shared next layer needs the same constants at every tile
+	return layer.isWeightShared() || !next.isWeightShared();
+}
+
+/*! \brief The neurons to remove from each block, the same number per block */
+static IndexVectorVector getRemovedNeurons(const BlockSparseMatrix& mask)
+{
+	IndexVectorVector pruned;
+
+	size_t removable = mask.columnsPerBlock() - 1;
+
+	for(auto& block : mask)
+	{
+		IndexVector neurons;
+
+		auto columnSums = block.reduceSumAlongRows();
+
+		for(size_t column = 0; column < block.columns(); ++column)
+		{
+			if(columnSums(0, column) == 0.0f)
+			{
+				neurons.push_back(column);
+			}
+		}
+
+		removable = std::min(removable, neurons.size());
+
+		pruned.push_back(std::move(neurons));
+	}
+
+	if(removable == 0)
+	{
+		return IndexVectorVector();
+	}
+
+	for(auto& neurons : pruned)
+	{
+		neurons.resize(removable);
+	}
+
+	return pruned;
+}
+
+static Matrix removeColumns(const Matrix& m, const IndexVector& columns)
+{
+	std::set<size_t> removed(columns.begin(), columns.end());
+
+	Matrix result(m.rows(), m.columns() - removed.size());
+
+	float* resultData = result.data().data();
+
+	for(size_t row = 0; row < m.rows(); ++row)
+	{
+		for(size_t column = 0; column < m.columns(); ++column)
+		{
+			if(removed.count(column) == 0)
+			{
+				*resultData++ = m(row, column);
+			}
+		}
+	}
+
+	return result;
+}
+
+static Matrix removeRows(const Matrix& m, const std::set<size_t>& rows)
+{
+	Matrix result(m.rows() - rows.size(), m.columns());
+
+	const float* data       = m.data().data();
+	float*       resultData = result.data().data();
+
+	for(size_t row = 0; row < m.rows(); ++row)
+	{
+		if(rows.count(row) != 0)
+		{
+			continue;
+		}
+
+		resultData = std::copy(data + row * m.columns(),
+			data + (row + 1) * m.columns(), resultData);
+	}
+
+	return result;
+}
+
+static size_t compactLayer(Layer& layer, Layer& next, BlockSparseMatrix& mask,
+	BlockSparseMatrix& nextMask)
+{
+	if(!canRemoveOutputs(layer, next))
+	{
+		return 0;
+	}
+
+	auto removed = getRemovedNeurons(mask);
+
+	if(removed.empty())
+	{
+		return 0;
+	}
+
+	size_t outputBlockingFactor = layer.getOutputBlockingFactor();
+	size_t inputBlockingFactor  = next.getInputBlockingFactor();
+	size_t windows = layer.getOutputCount() / outputBlockingFactor;
+
+	auto weights     = layer.getWeightsWithoutBias();
+	auto bias        = layer.getBias();
+	auto nextWeights = next.getWeightsWithoutBias();
+	auto nextBias    = next.getBias();
+
+	std::vector<std::set<size_t>> removedRows(nextWeights.blocks());
+
+	// a neuron without input weights outputs a constant, fold it into the
+	// bias of the next layer
+	for(size_t window = 0; window < windows; ++window)
+	{
+		size_t block = layer.isWeightShared() ? 0 : window;
+
+		for(auto neuron : removed[block])
+		{
+			size_t input     = window * outputBlockingFactor + neuron;
+			size_t nextBlock = input / inputBlockingFactor;
+			size_t row       = input % inputBlockingFactor;
+
+			if(next.isWeightShared() && nextBlock != 0)
+			{
+				continue;
+			}
+
+			float value = Layer::applyActivation(layer.getActivation(),
+				bias.empty() ? 0.0f : bias[block](0, neuron));
+
+			if(!nextBias.empty())
+			{
+				nextBias[nextBlock] = nextBias[nextBlock].add(
+					nextWeights[nextBlock].getRow(row).multiply(value));
+			}
+
+			removedRows[nextBlock].insert(row);
+		}
+	}
+
+	for(size_t block = 0; block < weights.blocks(); ++block)
+	{
+		weights[block] = removeColumns(weights[block], removed[block]);
+		mask[block]    = removeColumns(mask[block],    removed[block]);
+
+		if(!bias.empty())
+		{
+			bias[block] = removeColumns(bias[block], removed[block]);
+		}
+	}
+
+	for(size_t block = 0; block < nextWeights.blocks(); ++block)
+	{
+		nextWeights[block] = removeRows(nextWeights[block], removedRows[block]);
+		nextMask[block]    = removeRows(nextMask[block],    removedRows[block]);
+	}
+
+	layer.setWeightsWithoutBias(weights);
+	layer.setBias(bias);
+
+	next.setWeightsWithoutBias(nextWeights);
+	next.setBias(nextBias);
+	next.setBlockStep(next.getInputBlockingFactor());
+
+	return removed.front().size() * removed.size();
+}
+
+void NeuralNetworkPruner::compact(NeuralNetwork& network)
+{
+	applyMask(network);
+
+	size_t weightsBefore = network.totalWeights();
+
+	for(size_t layerNumber = 0; layerNumber + 1 < network.size(); ++layerNumber)
+	{
+		size_t neurons = compactLayer(network[layerNumber],
+			network[layerNumber + 1], _masks[layerNumber],
+			_masks[layerNumber + 1]);
+
+		logIf(prunerLog) << " layer " << layerNumber << ": removed "
+			<< neurons << " neurons, "
+			<< network[layerNumber].getOutputBlockingFactor()
+			<< " remain per block\n";
+	}
+
+	logIf(prunerLog) << "Compacted network from " << weightsBefore
+		<< " to " << network.totalWeights() << " weights\n";
+}
+
+float NeuralNetworkPruner::getSparsity() const
+{
+	size_t total  = 0;
+	size_t pruned = 0;
+
+	for(auto& mask : _masks)
+	{
+		for(auto& block : mask)
+		{
+			total  += block.size();
+			pruned += block.size() - (size_t)block.reduceSum();
+		}
+	}
+
+	if(total == 0)
+	{
+		return 0.0f;
+	}
+
+	return (float)pruned / total;
+}
+
+}
+
+}
+
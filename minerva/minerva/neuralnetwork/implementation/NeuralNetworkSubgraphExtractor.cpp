@@ -13,11 +13,14 @@
 #include <minerva/matrix/interface/Matrix.h>
 
 #include <minerva/util/interface/SystemCompatibility.h>
+#include <minerva/util/interface/Knobs.h>
 #include <minerva/util/interface/debug.h>
 
 // Standard Library Includes
 #include <cassert>
 #include <stack>
+#include <deque>
+#include <mutex>
 
 namespace minerva
 {
@@ -30,20 +33,20 @@ typedef NeuralNetworkSubgraphExtractor::TileVector TileVector;
 typedef matrix::BlockSparseMatrix BlockSparseMatrix;
 typedef optimizer::GeneralDifferentiableSolverFactory GeneralDifferentiableSolverFactory;
 
-static void getTiles(TileVector& tiles, const NeuralNetwork* neuralNetwork, const BlockSparseMatrix* input,
-	const BlockSparseMatrix* reference);
+static void getCachedTiles(TileVector& tiles, const NeuralNetwork* neuralNetwork,
+	const BlockSparseMatrix* input, const BlockSparseMatrix* reference);
 
 NeuralNetworkSubgraphExtractor::NeuralNetworkSubgraphExtractor(NeuralNetwork* network)
 : _network(network), _input(nullptr), _output(nullptr)
 {
-	getTiles(_tiles, _network, _input, _output);
+	getCachedTiles(_tiles, _network, _input, _output);
 }
 
 NeuralNetworkSubgraphExtractor::NeuralNetworkSubgraphExtractor(NeuralNetwork* network, BlockSparseMatrix* input,
 	BlockSparseMatrix* reference)
 : _network(network), _input(input), _output(reference)
 {
-	getTiles(_tiles, _network, _input, _output);
+	getCachedTiles(_tiles, _network, _input, _output);
 }
 
 static void copyTileFromNetwork(NeuralNetwork* newNetwork, const NeuralNetwork* network, const Tile& tile);
@@ -59,11 +62,12 @@ NeuralNetwork NeuralNetworkSubgraphExtractor::copySubgraphConnectedToThisOutput(
 	return newNetwork;
 }
 
-static void coalesceTiles(const NeuralNetwork* neuralNetwork, TileVector& tiles);
+static void getCachedCoalescedTiles(TileVector& tiles, const NeuralNetwork* neuralNetwork,
+	const BlockSparseMatrix* input, const BlockSparseMatrix* reference);
 
 void NeuralNetworkSubgraphExtractor::coalesceTiles()
 {
-	neuralnetwork::coalesceTiles(_network, _tiles);
+	getCachedCoalescedTiles(_tiles, _network, _input, _output);
 }
 
 static void extractTileFromNetwork(NeuralNetwork* networkTile, BlockSparseMatrix* inputTile,
@@ -618,6 +622,154 @@ static void getTiles(TileVector& tiles, const NeuralNetwork* neuralNetwork, cons
 	}
 }
 
+/*! \brief Everything about the network and data that the tiles depend on */
+typedef std::vector<size_t> TopologySignature;
+
+static TopologySignature getTopologySignature(const NeuralNetwork* neuralNetwork,
+	const BlockSparseMatrix* input, const BlockSparseMatrix* reference, bool coalesced)
+{
+	TopologySignature signature;
+	
+	signature.push_back(coalesced);
+	
+	// zero marks a missing input or reference
+	signature.push_back(input     == nullptr ? 0 : input->blocks() + 1);
+	signature.push_back(input     == nullptr ? 0 : input->blockSize());
+	signature.push_back(reference == nullptr ? 0 : reference->blocks() + 1);
+	signature.push_back(reference == nullptr ? 0 : reference->blockSize());
+	
+	for(auto& layer : *neuralNetwork)
+	{
+		signature.push_back(layer.blocks());
+		signature.push_back(layer.blockSize());
+	}
+	
+	return signature;
+}
+
+static util::Knob<size_t> cachedTopologiesKnob(
+	"NeuralNetworkSubgraphExtractor::CachedTopologies", 16,
+	"The number of tile decompositions kept between training calls");
+
+/*! \brief Tile decompositions of recently seen topologies.
+
+	Training calls the extractor once per batch on a network whose topology
+	never changes, so the block graph, its connected components, and the
+	coalescing are computed once and then copied.  Cached tiles keep stale
+	network, input, and reference pointers, copies are rebound on lookup.
+*/
+class TileDecompositionCache
+{
+public:
+	typedef std::vector<Tile> TileList;
+
+public:
+	bool lookup(TileVector& tiles, const TopologySignature& signature,
+		const NeuralNetwork* neuralNetwork, const BlockSparseMatrix* input,
+		const BlockSparseMatrix* reference)
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		auto decomposition = _decompositions.find(signature);
+		
+		if(decomposition == _decompositions.end())
+		{
+			return false;
+		}
+		
+		for(auto& cachedTile : decomposition->second)
+		{
+			Tile* tile = new Tile(cachedTile);
+			
+			for(auto& block : tile->blocks)
+			{
+				block.network   = neuralNetwork;
+				block.input     = input;
+				block.reference = reference;
+			}
+			
+			tile->updateLinks();
+			
+			tiles.push_back(tile);
+		}
+		
+		return true;
+	}
+	
+	void insert(const TopologySignature& signature, const TileVector& tiles)
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		if(_decompositions.count(signature) != 0)
+		{
+			return;
+		}
+		
+		TileList& cachedTiles = _decompositions[signature];
+		
+		for(auto tile : tiles)
+		{
+			cachedTiles.push_back(*tile);
+		}
+		
+		_order.push_back(signature);
+		
+		while(_order.size() > std::max((size_t)1, cachedTopologiesKnob.get()))
+		{
+			_decompositions.erase(_order.front());
+			_order.pop_front();
+		}
+	}
+
+private:
+	std::mutex _mutex;
+
+private:
+	std::map<TopologySignature, TileList> _decompositions;
+	std::deque<TopologySignature>         _order;
+
+};
+
+static TileDecompositionCache tileDecompositionCache;
+
+static void getCachedTiles(TileVector& tiles, const NeuralNetwork* neuralNetwork,
+	const BlockSparseMatrix* input, const BlockSparseMatrix* reference)
+{
+	auto signature = getTopologySignature(neuralNetwork, input, reference, false);
+	
+	if(tileDecompositionCache.lookup(tiles, signature, neuralNetwork, input, reference))
+	{
+		util::log("NeuralNetworkSubgraphExtractor") << " Reusing " << tiles.size()
+			<< " cached tiles\n";
+		return;
+	}
+	
+	getTiles(tiles, neuralNetwork, input, reference);
+	
+	tileDecompositionCache.insert(signature, tiles);
+}
+
+static void getCachedCoalescedTiles(TileVector& tiles, const NeuralNetwork* neuralNetwork,
+	const BlockSparseMatrix* input, const BlockSparseMatrix* reference)
+{
+	auto signature = getTopologySignature(neuralNetwork, input, reference, true);
+	
+	TileVector coalescedTiles;
+	
+	if(tileDecompositionCache.lookup(coalescedTiles, signature, neuralNetwork, input, reference))
+	{
+		freeTiles(tiles);
+		
+		tiles = std::move(coalescedTiles);
+		
+		return;
+	}
+	
+	coalesceTiles(neuralNetwork, tiles);
+	
+	tileDecompositionCache.insert(signature, tiles);
+}
+
 static void configureTile(NeuralNetwork* networkTile, BlockSparseMatrix* inputTile,
 	BlockSparseMatrix* referenceTile, const Tile& tile)
 {
@@ -664,6 +816,7 @@ static void extractTileFromNetwork(NeuralNetwork* networkTile, BlockSparseMatrix
 		{
 			// TODO: Encapsulate
 			(*networkTile)[block.layer - 1].setBlockStep((*network)[block.layer - 1].blockStep());
+			(*networkTile)[block.layer - 1].setActivation((*network)[block.layer - 1].getActivation());
 			(*networkTile)[block.layer - 1][block.blockInTile()] = std::move((*network)[block.layer - 1][block.blockInLayer()]);
 			(*networkTile)[block.layer - 1].at_bias(block.blockInTile()) = std::move((*network)[block.layer - 1].at_bias(block.blockInLayer()));
 		}
@@ -703,6 +856,7 @@ static void copyTileFromNetwork(NeuralNetwork* networkTile, const NeuralNetwork*
 		{
 			// TODO: Encapsulate
 			(*networkTile)[block.layer - 1].setBlockStep((*network)[block.layer - 1].blockStep());
+			(*networkTile)[block.layer - 1].setActivation((*network)[block.layer - 1].getActivation());
 			(*networkTile)[block.layer - 1][block.blockInTile()] = (*network)[block.layer - 1][block.blockInLayer()];
 			(*networkTile)[block.layer - 1].at_bias(block.blockInTile()) = (*network)[block.layer - 1].at_bias(block.blockInLayer());
 		}
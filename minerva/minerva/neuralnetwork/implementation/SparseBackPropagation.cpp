@@ -24,6 +24,16 @@ namespace minerva
 namespace neuralnetwork
 {
 
+static util::LogChannel sparseBackPropagationLog("SparseBackPropagation");
+static util::LogChannel sparseBackPropagationDetailLog("SparseBackPropagation::Detail");
+
+static util::Knob<float> lambdaKnob("NeuralNetwork::Lambda", 0.050f,
+	"The weight decay coefficient");
+static util::Knob<float> sparsityKnob("NeuralNetwork::Sparsity", 0.005f,
+	"The target mean activation of hidden units");
+static util::Knob<float> sparsityWeightKnob("NeuralNetwork::SparsityWeight", 0.600f,
+	"The weight of the sparsity penalty");
+
 typedef matrix::Matrix Matrix;
 typedef matrix::BlockSparseMatrix BlockSparseMatrix;
 typedef Matrix::FloatVector FloatVector;
@@ -43,9 +53,9 @@ SparseBackPropagation::SparseBackPropagation(NeuralNetwork* ann,
 	BlockSparseMatrix* ref)
 : BackPropagation(ann, input, ref), _lambda(0.0f), _sparsity(0.0f), _sparsityWeight(0.0f)
 {
-	_lambda         = util::KnobDatabase::getKnobValue("NeuralNetwork::Lambda",         0.050f);
-	_sparsity       = util::KnobDatabase::getKnobValue("NeuralNetwork::Sparsity",       0.005f);
-	_sparsityWeight = util::KnobDatabase::getKnobValue("NeuralNetwork::SparsityWeight", 0.600f);
+	_lambda         = lambdaKnob;
+	_sparsity       = sparsityKnob;
+	_sparsityWeight = sparsityWeightKnob;
 }
 
 BlockSparseMatrixVector SparseBackPropagation::getCostDerivative(const NeuralNetwork& neuralNetwork,
@@ -103,12 +113,8 @@ static float computeCostForNetwork(const NeuralNetwork& network, const BlockSpar
 
 	auto hx = network.runInputs(input);
 
-	auto errors = hx.subtract(referenceOutput);
-	auto squaredErrors = errors.elementMultiply(errors);
-
-	float sumOfSquaredErrors = squaredErrors.reduceSum();
-	
-	float costSum = sumOfSquaredErrors * 1.0f / (2.0f * m);
+	// squared errors, or cross entropy for a softmax output
+	float costSum = network.back().getOutputCost(hx, referenceOutput) / m;
 
 	#endif
 
@@ -135,7 +141,8 @@ static float computeCostForNetwork(const NeuralNetwork& network, const BlockSpar
 	return costSum;
 }
 
-static BlockSparseMatrixVector getActivations(const NeuralNetwork& network, const BlockSparseMatrix& input) 
+static BlockSparseMatrixVector getActivations(const NeuralNetwork& network, const BlockSparseMatrix& input,
+	BlockSparseMatrixVector& derivatives)
 {
 	BlockSparseMatrixVector activations;
 
@@ -144,25 +151,46 @@ static BlockSparseMatrixVector getActivations(const NeuralNetwork& network, cons
 	auto temp = input;
 
 	activations.push_back(temp);
-	//util::log("SparseBackPropagation") << " added activation of size ( " << activations.back().rows()
+	//logIf(sparseBackPropagationLog) << " added activation of size ( " << activations.back().rows()
 	// << " ) rows and ( " << activations.back().columns() << " )\n" ;
 
+	derivatives.reserve(network.size());
+
 	for (auto i = network.begin(); i != network.end(); ++i)
 	{
 		network.formatInputForLayer(*i, activations.back());
 	
-		activations.push_back((*i).runInputs(activations.back()));
-		util::log("SparseBackPropagation::Detail") << " added activation of size ( " << activations.back().rows()
+		// keep the derivative blocked like the activation it belongs to
+		if(!derivatives.empty() && !derivatives.back().empty())
+		{
+			network.formatInputForLayer(*i, derivatives.back());
+		}
+
+		// the output layer delta does not use the activation derivative
+		BlockSparseMatrix derivative;
+
+		if(i + 1 == network.end())
+		{
+			activations.push_back((*i).runInputs(activations.back()));
+		}
+		else
+		{
+			activations.push_back((*i).runInputs(activations.back(), derivative));
+		}
+
+		derivatives.push_back(std::move(derivative));
+		logIf(sparseBackPropagationDetailLog) << " added activation of size ( " << activations.back().rows()
 		<< " ) rows and ( " << activations.back().columns() << " )\n" ;
 	}
 
-	//util::log("SparseBackPropagation") << " intermediate stage ( " << activations[activations.size() / 2].toString() << "\n";
-	//util::log("SparseBackPropagation") << " final output ( " << activations.back().toString() << "\n";
+	//logIf(sparseBackPropagationLog) << " intermediate stage ( " << activations[activations.size() / 2].toString() << "\n";
+	//logIf(sparseBackPropagationLog) << " final output ( " << activations.back().toString() << "\n";
 
 	return activations;
 }
 
-static BlockSparseMatrixVector getDeltas(const NeuralNetwork& network, const BlockSparseMatrixVector& activations, const BlockSparseMatrix& reference,
+static BlockSparseMatrixVector getDeltas(const NeuralNetwork& network, const BlockSparseMatrixVector& activations,
+	const BlockSparseMatrixVector& derivatives, const BlockSparseMatrix& reference,
 	float sparsity, float sparsityWeight)
 {
 	BlockSparseMatrixVector deltas;
@@ -170,7 +198,7 @@ static BlockSparseMatrixVector getDeltas(const NeuralNetwork& network, const Blo
 	deltas.reserve(activations.size() - 1);
 	
 	auto i = activations.rbegin();
-	auto delta = (*i).subtract(reference).elementMultiply(i->sigmoidDerivative());
+	auto delta = network.back().getOutputDelta(*i, reference);
 	++i;
 
 	while (i != activations.rend())
@@ -184,8 +212,13 @@ static BlockSparseMatrixVector getDeltas(const NeuralNetwork& network, const Blo
 
 		network.formatOutputForLayer(layer, deltas.back());
 
-		auto activationDerivativeOfCurrentLayer = activation.sigmoidDerivative();
-		auto deltaPropagatedReverse = layer.runReverse(deltas.back());
+		// the input has no activation function, so it has no delta
+		if(layerNumber == 0)
+		{
+			break;
+		}
+
+		auto deltaPropagatedReverse = layer.runReverse(deltas.back(), activation);
 		
 		// add in the sparsity term
 		size_t samples = activation.rows();
@@ -194,20 +227,20 @@ static BlockSparseMatrixVector getDeltas(const NeuralNetwork& network, const Blo
 
 		auto sparsityTerm = klDivergenceDerivative.multiply(sparsityWeight);
 	   
-		delta = deltaPropagatedReverse.addBroadcastRow(sparsityTerm).elementMultiply(activationDerivativeOfCurrentLayer);
+		// the activation was produced by the previous layer
+		delta = network[layerNumber - 1].applyActivationDerivative(
+			deltaPropagatedReverse.addBroadcastRow(sparsityTerm), activation,
+			derivatives[layerNumber - 1]);
 
 		++i; 
 	}
 
 	std::reverse(deltas.begin(), deltas.end());
 	
-	if(util::isLogEnabled("SparseBackPropagation::Detail"))
+	for(auto& delta : deltas)
 	{
-		for(auto& delta : deltas)
-		{
-			util::log("SparseBackPropagation::Detail") << " added delta of size " << delta.shapeString() << "\n" ;
-			//util::log("SparseBackPropagation") << " delta contains " << delta.toString() << "\n";
-		}
+		logIf(sparseBackPropagationDetailLog) << " added delta of size " << delta.shapeString() << "\n" ;
+		//logIf(sparseBackPropagationLog) << " delta contains " << delta.toString() << "\n";
 	}
 
 	return deltas;
@@ -230,9 +263,10 @@ static BlockSparseMatrixVector computeCostDerivative(const NeuralNetwork& networ
 	const BlockSparseMatrix& referenceOutput, float lambda, float sparsity, float sparsityWeight)
 {
 	//get activations in a vector
-	auto activations = getActivations(network, input);
+	BlockSparseMatrixVector derivatives;
+	auto activations = getActivations(network, input, derivatives);
 	//get deltas in a vector
-	auto deltas = getDeltas(network, activations, referenceOutput, sparsity, sparsityWeight);
+	auto deltas = getDeltas(network, activations, derivatives, referenceOutput, sparsity, sparsityWeight);
 	
 	BlockSparseMatrixVector partialDerivative;
 	
@@ -247,6 +281,28 @@ static BlockSparseMatrixVector computeCostDerivative(const NeuralNetwork& networ
 		auto& activation = *j;
 		auto& delta      = *i;
 
+		if(layer->isPooling())
+		{
+			// nothing to learn
+			partialDerivative.push_back(layer->getWeightsWithoutBias());
+			partialDerivative.push_back(layer->getBias());
+			
+			continue;
+		}
+
+		if(layer->isWeightShared())
+		{
+			// one filter bank, the gradient is accumulated over every tile
+			auto lambdaTerm = layer->getWeightsWithoutBias().multiply(lambda);
+			
+			partialDerivative.push_back(lambdaTerm.add(
+				layer->getSharedWeightDerivative(activation, delta).multiply(1.0f/samples)));
+			partialDerivative.push_back(layer->getSharedBiasDerivative(
+				delta).multiply(1.0f/samples));
+			
+			continue;
+		}
+
 		auto  transposedDelta = delta.transpose();
 
 		transposedDelta.setRowSparse();
@@ -268,11 +324,11 @@ static BlockSparseMatrixVector computeCostDerivative(const NeuralNetwork& networ
 		
 		partialDerivative.push_back(std::move(regularizedPartialDerivative));
 	
-		util::log("SparseBackPropagation") << " computed derivative for layer "
+		logIf(sparseBackPropagationLog) << " computed derivative for layer "
 			<< std::distance(deltas.begin(), i)
 			<< " (" << partialDerivative.back().rows()
 			<< " rows, " << partialDerivative.back().columns() << " columns).\n";
-		util::log("SparseBackPropagation") << " PD contains " << partialDerivative.back().toString() << "\n";
+		logIf(sparseBackPropagationLog) << " PD contains " << partialDerivative.back().toString() << "\n";
 		
 		// Compute partial derivatives with respect to the bias
 		auto normalizedBiasPartialDerivative = transposedDelta.reduceSumAlongColumns().multiply(1.0f/samples);
@@ -287,10 +343,10 @@ static BlockSparseMatrixVector computeCostDerivative(const NeuralNetwork& networ
 }
 
 static BlockSparseMatrix getInputDelta(const NeuralNetwork& network, const BlockSparseMatrixVector& activations,
-	const BlockSparseMatrix& reference, float sparsity, float sparsityWeight)
+	const BlockSparseMatrixVector& derivatives, const BlockSparseMatrix& reference, float sparsity, float sparsityWeight)
 {
 	auto i = activations.rbegin();
-	auto delta = (*i).subtract(reference).elementMultiply(i->sigmoidDerivative());
+	auto delta = network.back().getOutputDelta(*i, reference);
 	++i;
 
 	while (i + 1 != activations.rend())
@@ -301,10 +357,10 @@ static BlockSparseMatrix getInputDelta(const NeuralNetwork& network, const Block
 		
 		network.formatOutputForLayer(layer, delta);
 
-		auto activationDerivativeOfCurrentLayer = activation.sigmoidDerivative();
-		auto deltaPropagatedReverse = layer.runReverse(delta);
+		auto deltaPropagatedReverse = layer.runReverse(delta, activation);
 		
-		delta = deltaPropagatedReverse.elementMultiply(activationDerivativeOfCurrentLayer);
+		delta = network[layerNumber - 1].applyActivationDerivative(
+			deltaPropagatedReverse, activation, derivatives[layerNumber - 1]);
 
 		util::log ("SparseBackPropagation") << " Computing input delta for layer number: " << layerNumber << "\n";
 
@@ -317,7 +373,7 @@ static BlockSparseMatrix getInputDelta(const NeuralNetwork& network, const Block
 
 	network.formatOutputForLayer(layer, delta);
 
-	auto deltaPropagatedReverse = layer.runReverse(delta);
+	auto deltaPropagatedReverse = layer.runReverse(delta, activations.front());
 
 	util::log ("SparseBackPropagation") << " Computing input delta for layer number: " << layerNumber << "\n";
 	
@@ -347,15 +403,12 @@ static float getActivationSparsityCost(const NeuralNetwork& network, const Block
 		// Get the KL divergence of each activation
 		auto klDivergence = averageActivations.klDivergence(sparsity);
 		
-		if(util::isLogEnabled("SparseBackPropagation::Detail"))
-		{
-			util::log("SparseBackPropagation::Detail") << " activations of size " << temp.shapeString() << "\n" ;
-			util::log("SparseBackPropagation::Detail") << " average activations of size " << averageActivations.shapeString() << "\n" ;
-			util::log("SparseBackPropagation::Detail") << " kl divergence of size " << klDivergence.shapeString() << "\n" ;
-			util::log("SparseBackPropagation::Detail") << " activations " << temp.debugString() << "\n" ;
-			util::log("SparseBackPropagation::Detail") << " average activations " << averageActivations.debugString() << "\n" ;
-			util::log("SparseBackPropagation::Detail") << " kl divergence " << klDivergence.toString() << "\n";
-		}
+		logIf(sparseBackPropagationDetailLog) << " activations of size " << temp.shapeString() << "\n" ;
+		logIf(sparseBackPropagationDetailLog) << " average activations of size " << averageActivations.shapeString() << "\n" ;
+		logIf(sparseBackPropagationDetailLog) << " kl divergence of size " << klDivergence.shapeString() << "\n" ;
+		logIf(sparseBackPropagationDetailLog) << " activations " << temp.debugString() << "\n" ;
+		logIf(sparseBackPropagationDetailLog) << " average activations " << averageActivations.debugString() << "\n" ;
+		logIf(sparseBackPropagationDetailLog) << " kl divergence " << klDivergence.toString() << "\n";
 	
 		// Add it into the cost
 		cost += sparsityWeight * klDivergence.reduceSum();
@@ -370,18 +423,19 @@ static BlockSparseMatrix computeInputDerivative(const NeuralNetwork& network,
 	float lambda, float sparsity, float sparsityWeight)
 {
 	//get activations in a vector
-	auto activations = getActivations(network, input);
+	BlockSparseMatrixVector derivatives;
+	auto activations = getActivations(network, input, derivatives);
 	//get deltas in a vector
-	auto delta = getInputDelta(network, activations, referenceOutput, sparsity, sparsityWeight);
+	auto delta = getInputDelta(network, activations, derivatives, referenceOutput, sparsity, sparsityWeight);
 	
-	util::log("SparseBackPropagation") << "Input delta: " << delta.toString();
+	logIf(sparseBackPropagationLog) << "Input delta: " << delta.toString();
 	unsigned int samples = input.rows();
 
 	auto partialDerivative = delta;
 
 	auto normalizedPartialDerivative = partialDerivative.multiply(1.0f/samples);
 
-	util::log("SparseBackPropagation") << "Input derivative: " << normalizedPartialDerivative.toString();
+	logIf(sparseBackPropagationLog) << "Input derivative: " << normalizedPartialDerivative.toString();
 
 	return normalizedPartialDerivative;
 }
@@ -30,9 +30,12 @@ private:
 	bool testDerivative();
 
 private:
-	BlockSparseMatrix getInputDelta(const NeuralNetwork& network, const BlockSparseMatrixVector& m) const;
-	BlockSparseMatrixVector getDeltas(const NeuralNetwork& network, const BlockSparseMatrixVector& m) const;
-	BlockSparseMatrixVector getActivations(const NeuralNetwork& network, const BlockSparseMatrix& inputs) const;
+	BlockSparseMatrix getInputDelta(const NeuralNetwork& network, const BlockSparseMatrixVector& m,
+		const BlockSparseMatrixVector& derivatives) const;
+	BlockSparseMatrixVector getDeltas(const NeuralNetwork& network, const BlockSparseMatrixVector& m,
+		const BlockSparseMatrixVector& derivatives) const;
+	BlockSparseMatrixVector getActivations(const NeuralNetwork& network, const BlockSparseMatrix& inputs,
+		BlockSparseMatrixVector& derivatives) const;
    
 private:
 	BlockSparseMatrixVector getCostDerivative(const NeuralNetwork& network) const;
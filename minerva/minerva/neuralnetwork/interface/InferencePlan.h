@@ -0,0 +1,163 @@
+/*! \file   InferencePlan.h
+	\author Gregory Diamos <gregory.diamos@gmail.com>
+	\date   Sunday October 18, 2026
+	\brief  The header file for the InferencePlan class.
+*/
+
+#pragma once
+
+// Minerva Includes
+#include <minerva/matrix/interface/Matrix.h>
+#include <minerva/matrix/interface/Int8Matrix.h>
+
+// Standard Library Includes
+#include <vector>
+#include <string>
+
+// Forward Declarations
+namespace minerva { namespace neuralnetwork { class NeuralNetwork; } }
+namespace minerva { namespace neuralnetwork { class Layer;         } }
+
+namespace minerva
+{
+
+namespace neuralnetwork
+{
+
+/*! \brief A precompiled forward propagation schedule for a chain of networks.
+
+	The plan references the layers of the networks in place, precomputes the
+	shape of every layer, and keeps two preallocated activation buffers that
+	alternate between layers.  Pooling layers become streaming reductions over
+	consecutive windows of their input, and softmax layers normalize each
+	output row once all of its windows are computed.  Steady state inference
+	(batches no larger than the largest batch seen so far) performs no
+	allocation.
+
+	The plan is invalidated if the layers of the networks are modified or moved.
+
+	After calibrate() has observed the range of every layer input on a sample
+	of representative data, quantize() switches the weighted layers to int8.
+	Weights are quantized symmetrically per output neuron, activations
+	asymmetrically per layer to 7 bits (0-127), products are accumulated in
+	32 bits, and the sigmoid (and tanh) is a lookup table.  Pooling stays in
+	fp32.
+*/
+class InferencePlan
+{
+public:
+	typedef matrix::Matrix Matrix;
+	typedef std::vector<const NeuralNetwork*> NeuralNetworkVector;
+
+public:
+	InferencePlan();
+
+public:
+	/*! \brief Build the plan for networks that are run back to back. */
+	void build(const NeuralNetworkVector& networks, size_t maximumBatchSize);
+
+	/*! \brief Release the plan and its buffers. */
+	void clear();
+
+public:
+	/*! \brief Run a batch (one sample per row) through the plan.
+
+		The result is owned by the plan and is valid until the next call.
+	*/
+	const Matrix& runInputs(const Matrix& input);
+
+public:
+	/*! \brief Run a batch in fp32, widening the recorded range of every
+		layer input to cover it. */
+	void calibrate(const Matrix& input);
+
+	/*! \brief Switch the weighted layers to int8 using the calibrated ranges. */
+	void quantize();
+
+	bool isQuantized() const;
+
+public:
+	/*! \brief The calibrated input ranges, as text that can be saved. */
+	std::string getCalibration() const;
+
+	/*! \brief Restore ranges produced by getCalibration() on the same model. */
+	void setCalibration(const std::string& calibration);
+
+public:
+	bool empty() const;
+	
+	size_t getInputCount()  const;
+	size_t getOutputCount() const;
+	
+	size_t getInputBlockingFactor() const;
+
+private:
+	class Step
+	{
+	public:
+		const Layer* layer;
+
+	public:
+		size_t inputColumns;
+		size_t outputColumns;
+		size_t step;
+		bool   pooling;
+		bool   softmax;
+
+	public:
+		size_t windows;
+		size_t weightRows;
+		size_t weightColumns;
+
+	public:
+		std::vector<size_t> weightBlockForWindow;
+		std::vector<size_t> biasBlockForWindow;
+
+	public:
+		float inputMinimum;
+		float inputMaximum;
+
+	public:
+		float   inputScale;
+		int32_t inputZero;
+		size_t  quantizedInputColumns;
+
+	public:
+		std::vector<matrix::Int8Matrix>   quantizedWeights;
+		std::vector<std::vector<float>>   weightScales;
+		std::vector<std::vector<int32_t>> weightSums;
+	};
+
+	typedef std::vector<Step> StepVector;
+
+private:
+	void _runStep(const Step& step, const Matrix& input, Matrix& output) const;
+	void _runPoolingStep(const Step& step, const Matrix& input,
+		Matrix& output) const;
+	void _runQuantizedStep(const Step& step, const Matrix& input,
+		Matrix& output);
+	void _quantizeStep(Step& step) const;
+	void _reserve(size_t batchSize);
+
+private:
+	StepVector _steps;
+
+private:
+	Matrix _buffers[2];
+	size_t _maximumBatchSize;
+	size_t _maximumColumns;
+
+private:
+	bool _quantized;
+
+	std::vector<uint8_t> _quantizedInput;
+	std::vector<int32_t> _accumulators;
+	size_t _maximumQuantizedColumns;
+	size_t _maximumAccumulatorColumns;
+
+};
+
+}
+
+}
+
@@ -11,6 +11,7 @@
 // Standard Library Includes
 #include <random>
 #include <set>
+#include <string>
 
 namespace minerva
 {
@@ -21,6 +22,20 @@ namespace neuralnetwork
 
 	Each layer is stored as a block sparse matrix.  Rows correspond to output neurons,
 	and columns correspond to input weights.  
+	
+	A layer with shared weights stores a single block (one filter bank) that is
+	applied at every tile position, so it has the shape of a layer with 'tiles'
+	blocks but a tile count times fewer parameters.
+	
+	A pooling layer has no weights, it reduces each group of
+	blockInput / blockOutput consecutive inputs to their maximum or average.
+	
+	Every other activation is applied element-wise, and its derivative is
+	computed from the stored output without calling exp() or tanh().
+	
+	A softmax layer normalizes each row of its output (across all blocks)
+	to a distribution, and is trained with a cross entropy cost against the
+	label of each sample, so it can only be the final layer of a network.
 */
 class Layer
 {
@@ -33,18 +48,91 @@ class Layer
 		
 		typedef std::set<size_t> NeuronSet;
 
+	public:
+		enum Type
+		{
+			Weighted,
+			MaxPooling,
+			AveragePooling
+		};
+
+		enum Activation
+		{
+			Sigmoid,
+			Softmax,
+			RectifiedLinear,
+			LeakyRectifiedLinear,
+			HardSigmoid,
+			Tanh
+		};
+
 	public:
 		Layer(unsigned totalBlocks = 0, size_t blockInput = 0,
-			size_t blockOutput = 0, size_t blockStep = 0);
+			size_t blockOutput = 0, size_t blockStep = 0,
+			bool sharedWeights = false);
+		Layer(Type pooling, size_t tiles, size_t blockInput,
+			size_t blockOutput);
 
 		Layer(const Layer&);
 		Layer& operator=(const Layer&);
 		Layer& operator=(Layer&&);
 
 	public:
+		/*! \brief Uniform weights, or Layer::SparseInitializationConnections
+			non-zero inputs per neuron, generated in parallel from a seed
+			drawn from the engine. */
 		void initializeRandomly(std::default_random_engine& engine, float epsilon = 6.0f);
 		BlockSparseMatrix runInputs(const BlockSparseMatrix& m) const;
-		BlockSparseMatrix runReverse(const BlockSparseMatrix& m) const;
+		/*! \brief Also return the derivative of the activation at each output,
+			written in the same pass as the output (empty for pooling and
+			softmax layers). */
+		BlockSparseMatrix runInputs(const BlockSparseMatrix& m,
+			BlockSparseMatrix& activationDerivative) const;
+		/*! \brief Propagate a delta at the output back to the input, the
+			input is the matrix the layer was run on (used by max pooling). */
+		BlockSparseMatrix runReverse(const BlockSparseMatrix& m,
+			const BlockSparseMatrix& input) const;
+
+	public:
+		/*! \brief Scale a delta at the output of this layer by the
+			derivative of its activation function at that output. */
+		BlockSparseMatrix applyActivationDerivative(
+			const BlockSparseMatrix& delta,
+			const BlockSparseMatrix& output) const;
+		/*! \brief The same, with the derivative saved by runInputs */
+		BlockSparseMatrix applyActivationDerivative(
+			const BlockSparseMatrix& delta,
+			const BlockSparseMatrix& output,
+			const BlockSparseMatrix& activationDerivative) const;
+
+		/*! \brief The derivative of the cost with respect to the input of the
+			activation function, for the output of the final layer.
+
+			For a softmax layer the delta is the output minus the one-hot
+			label, with no Jacobian.  The label of a sample is the largest
+			entry of its reference row, samples without a single largest
+			entry are unlabeled and add neither delta nor cost.
+
+			TODO: producers and engines only pass dense references, so
+			every batch still builds and scans one, pass label indices
+			through them instead. */
+		BlockSparseMatrix getOutputDelta(const BlockSparseMatrix& output,
+			const BlockSparseMatrix& reference) const;
+		/*! \brief The cost of the output of the final layer, summed over
+			samples (not normalized). */
+		float getOutputCost(const BlockSparseMatrix& output,
+			const BlockSparseMatrix& reference) const;
+
+	public:
+		/*! \brief The weight gradient of a shared layer, summed over all
+			tile positions and samples (not normalized). */
+		BlockSparseMatrix getSharedWeightDerivative(
+			const BlockSparseMatrix& activation,
+			const BlockSparseMatrix& delta) const;
+		/*! \brief The bias gradient of a shared layer, summed over all
+			tile positions and samples (not normalized). */
+		BlockSparseMatrix getSharedBiasDerivative(
+			const BlockSparseMatrix& delta) const;
  
  	public:
  		void transpose();
@@ -129,6 +217,40 @@ class Layer
 	public:
 		void setBlockStep(size_t s);
 
+	public:
+		/*! \brief The number of tile positions, equal to blocks() unless
+			the weights are shared or the layer is a pooling layer. */
+		size_t tiles() const;
+		bool isWeightShared() const;
+
+	public:
+		Type getType() const;
+		bool isPooling() const;
+
+	public:
+		/*! \brief "max" or "average" */
+		std::string getPoolingName() const;
+		static Type getPoolingTypeForName(const std::string& name);
+
+	public:
+		Activation getActivation() const;
+		void setActivation(Activation activation);
+
+	public:
+		/*! \brief "sigmoid", "softmax", "relu", "leaky-relu", "hard-sigmoid",
+			or "tanh" */
+		std::string getActivationName() const;
+		static Activation getActivationForName(const std::string& name);
+
+	public:
+		/*! \brief Apply an element-wise activation function to one value */
+		static float applyActivation(Activation activation, float value);
+
+	public:
+		/*! \brief Share the single weight block across this many tiles
+			(0 gives every tile its own block). */
+		void setSharedTiles(size_t tiles);
+
 	public:
 		void setBias(const BlockSparseMatrix& bias);
 		const BlockSparseMatrix& getBias() const;
@@ -139,12 +261,24 @@ class Layer
 		Layer getSubgraphConnectedToTheseOutputs(
 			const NeuronSet& outputs) const;
 
+	private:
+		BlockSparseMatrix _runInputs(const BlockSparseMatrix& m,
+			BlockSparseMatrix* activationDerivative) const;
+
 	private:
 		BlockSparseMatrix m_sparseMatrix;
 		BlockSparseMatrix m_bias;
 		
 	private:
 		size_t m_blockStep;
+		size_t m_tiles;
+
+	private:
+		Type   m_type;
+		size_t m_poolingOutputs;
+
+	private:
+		Activation m_activation;
 		
 
 };
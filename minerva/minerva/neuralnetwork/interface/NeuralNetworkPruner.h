@@ -0,0 +1,73 @@
+/*! \file   NeuralNetworkPruner.h
+	\author Gregory Diamos <gregory.diamos@gmail.com>
+	\date   Sunday October 18, 2026
+	\brief  The header file for the NeuralNetworkPruner class.
+*/
+
+#pragma once
+
+// Minerva Includes
+#include <minerva/matrix/interface/BlockSparseMatrix.h>
+
+// Standard Library Includes
+#include <vector>
+
+// Forward Declarations
+namespace minerva { namespace neuralnetwork { class NeuralNetwork; } }
+
+namespace minerva
+{
+
+namespace neuralnetwork
+{
+
+/*! \brief Magnitude pruning of a trained network.
+
+	prune() zeros individual weights, output neurons (weight columns), and
+	whole blocks whose magnitude falls below a threshold, and remembers them
+	in a mask.  The network can then be fine-tuned, calling applyMask() after
+	each update to keep the pruned weights at zero.
+
+	compact() physically removes the pruned neurons.  A neuron with no input
+	weights produces a constant, which is folded into the bias of the next
+	layer before its row of input weights is dropped.  Blocks must stay the
+	same shape, so each block of a layer loses the same number of neurons
+	(the fewest pruned in any block), and neurons are only removed from
+	layers whose outputs map directly onto whole blocks of the next layer.
+	The outputs of the final layer are never removed.  Whole blocks are
+	never removed either, a block that is pruned entirely keeps a single
+	neuron with zero weights.
+*/
+class NeuralNetworkPruner
+{
+public:
+	typedef matrix::BlockSparseMatrix BlockSparseMatrix;
+	typedef std::vector<BlockSparseMatrix> BlockSparseMatrixVector;
+
+public:
+	NeuralNetworkPruner();
+
+public:
+	/*! \brief Zero weights, neurons, and blocks with a root mean square
+		magnitude below the threshold, and record the mask. */
+	void prune(NeuralNetwork& network, float threshold);
+
+	/*! \brief Zero the weights pruned by the last call to prune(). */
+	void applyMask(NeuralNetwork& network) const;
+
+	/*! \brief Remove pruned neurons from the network storage. */
+	void compact(NeuralNetwork& network);
+
+public:
+	/*! \brief The fraction of weights that are masked. */
+	float getSparsity() const;
+
+private:
+	BlockSparseMatrixVector _masks;
+
+};
+
+}
+
+}
+
@@ -35,13 +35,14 @@ typedef neuralnetwork::NeuralNetwork NeuralNetwork;
 
 static NeuralNetwork createNetwork(
 	size_t layerSize, size_t blockCount, size_t layerCount,
-	std::default_random_engine& engine)
+	bool sharedWeights, std::default_random_engine& engine)
 {
 	NeuralNetwork network;
 	
 	for(size_t layer = 0; layer < layerCount; ++layer)
 	{
-		network.addLayer(Layer(blockCount, layerSize, layerSize));
+		network.addLayer(Layer(blockCount, layerSize, layerSize, layerSize,
+			sharedWeights));
 	}
 
 	network.initializeRandomly(engine);
@@ -173,7 +174,8 @@ static bool gradientCheck(NeuralNetwork& network, std::default_random_engine& en
 	return isInRange(difference/total, epsilon);
 }
 
-static void runTest(size_t layerSize, size_t blockCount, size_t layerCount, bool seed)
+static void runTest(size_t layerSize, size_t blockCount, size_t layerCount,
+	bool sharedWeights, const std::string& activation, bool softmax, bool seed)
 {
 	std::default_random_engine generator;
 
@@ -182,7 +184,18 @@ static void runTest(size_t layerSize, size_t blockCount, size_t layerCount, bool
 		generator.seed(std::time(0));
 	}
 	
-	auto network = createNetwork(layerSize, blockCount, layerCount, generator);
+	auto network = createNetwork(layerSize, blockCount, layerCount,
+		sharedWeights, generator);
+
+	for(auto& layer : network)
+	{
+		layer.setActivation(Layer::getActivationForName(activation));
+	}
+
+	if(softmax)
+	{
+		network.back().setActivation(Layer::Softmax);
+	}
 	
 	if(gradientCheck(network, generator))
 	{
@@ -204,6 +217,9 @@ int main(int argc, char** argv)
     
     bool verbose = false;
     bool seed = false;
+    bool sharedWeights = false;
+    bool softmax = false;
+    std::string activation;
     std::string loggingEnabledModules;
 
 	size_t layerSize  = 0;
@@ -218,6 +234,13 @@ int main(int argc, char** argv)
 		"The number of blocks per layer.");
 	parser.parse("-l", "--layer-count", layerCount, 5,
 		"The number of layers.");
+	parser.parse("-w", "--shared-weights", sharedWeights, false,
+		"Share one block of weights across the blocks of each layer.");
+	parser.parse("-a", "--activation", activation, "sigmoid",
+		"The activation function of each layer (sigmoid, relu, leaky-relu, "
+		"hard-sigmoid, or tanh).");
+	parser.parse("-m", "--softmax", softmax, false,
+		"Use a softmax output layer with a cross entropy cost.");
 
     parser.parse("-L", "--log-module", loggingEnabledModules, "",
 		"Print out log messages during execution for specified modules "
@@ -242,7 +265,8 @@ int main(int argc, char** argv)
     
     try
     {
-        minerva::neuralnetwork::runTest(layerSize, blockCount, layerCount, seed);
+        minerva::neuralnetwork::runTest(layerSize, blockCount, layerCount,
+			sharedWeights, activation, softmax, seed);
     }
     catch(const std::exception& e)
     {
@@ -0,0 +1,285 @@
+/*! \file   test-inference-plan.cpp
+	\author Gregory Diamos
+	\date   Sunday October 18, 2026
+	\brief  A unit test for the precompiled neural network inference plan.
+*/
+
+// Minerva Includes
+#include <minerva/neuralnetwork/interface/NeuralNetwork.h>
+#include <minerva/neuralnetwork/interface/InferencePlan.h>
+
+#include <minerva/matrix/interface/Matrix.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/ArgumentParser.h>
+
+// Standard Library Includes
+#include <random>
+#include <iostream>
+#include <cmath>
+#include <ctime>
+
+namespace minerva
+{
+
+namespace neuralnetwork
+{
+
+typedef matrix::Matrix Matrix;
+
+static NeuralNetwork createFeatureSelector(size_t layerSize, size_t blockCount,
+	std::default_random_engine& engine)
+{
+	NeuralNetwork network;
+	
+	// convolutional layer with overlapping windows
+	network.addLayer(Layer(blockCount, layerSize, layerSize, layerSize / 2));
+	
+	// reduction layer
+	network.addLayer(Layer(network.back().blocks(), network.back().getOutputBlockingFactor(),
+		network.back().getOutputBlockingFactor() / 2));
+	
+	// pooling layer
+	network.addLayer(Layer(Layer::MaxPooling, network.back().tiles(),
+		network.back().getOutputBlockingFactor(),
+		network.back().getOutputBlockingFactor() / 2));
+	
+	network.initializeRandomly(engine);
+
+	return network;
+}
+
+static NeuralNetwork createClassifier(size_t inputs, size_t outputs,
+	std::default_random_engine& engine)
+{
+	NeuralNetwork network;
+	
+	network.addLayer(Layer(1, inputs, outputs));
+	
+	network.initializeRandomly(engine);
+
+	return network;
+}
+
+static Matrix generateInput(size_t samples, size_t inputs,
+	std::default_random_engine& engine)
+{
+	Matrix inputData(samples, inputs);
+
+	std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+	for(auto& value : inputData)
+	{
+		value = distribution(engine);
+	}
+
+	return inputData;
+}
+
+static bool matches(const Matrix& computed, const Matrix& reference,
+	float tolerance = 1.0e-4f)
+{
+	if(computed.rows() != reference.rows() || computed.columns() != reference.columns())
+	{
+		std::cout << " Shape mismatch (" << computed.rows() << ", " << computed.columns()
+			<< ") vs (" << reference.rows() << ", " << reference.columns() << ")\n";
+		return false;
+	}
+	
+	for(size_t i = 0; i < computed.size(); ++i)
+	{
+		if(std::fabs(computed[i] - reference[i]) > tolerance)
+		{
+			std::cout << " Value mismatch at " << i << ": " << computed[i]
+				<< " vs " << reference[i] << "\n";
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+/*! \brief Cycle through the element-wise activations, starting at 'index' */
+static void assignActivations(NeuralNetwork& network, size_t& index)
+{
+	Layer::Activation activations[] = {Layer::RectifiedLinear,
+		Layer::LeakyRectifiedLinear, Layer::HardSigmoid, Layer::Tanh};
+	
+	for(auto& layer : network)
+	{
+		if(!layer.isPooling())
+		{
+			layer.setActivation(activations[index++ % 4]);
+		}
+	}
+}
+
+static bool testPlanMatchesNetwork(size_t layerSize, size_t blockCount,
+	size_t batchSize, std::default_random_engine& engine)
+{
+	auto featureSelector = createFeatureSelector(layerSize, blockCount, engine);
+	auto classifier      = createClassifier(featureSelector.getOutputCount(), 10, engine);
+	
+	size_t activation = 0;
+	
+	assignActivations(featureSelector, activation);
+	assignActivations(classifier,      activation);
+	
+	NeuralNetwork aggregate;
+	
+	for(auto& layer : featureSelector) aggregate.addLayer(layer);
+	for(auto& layer : classifier)      aggregate.addLayer(layer);
+	
+	InferencePlan plan;
+	
+	InferencePlan::NeuralNetworkVector networks;
+	
+	networks.push_back(&featureSelector);
+	networks.push_back(&classifier);
+	
+	plan.build(networks, batchSize);
+	
+	bool passed = true;
+	
+	// run several batches, including a smaller one, through the same buffers
+	size_t batchSizes[] = {batchSize, batchSize / 2 + 1, batchSize};
+	
+	for(auto samples : batchSizes)
+	{
+		auto input = generateInput(samples, aggregate.getInputCount(), engine);
+		
+		auto reference = aggregate.runInputs(input);
+		
+		passed &= matches(plan.runInputs(input), reference);
+	}
+	
+	if(passed)
+	{
+		std::cout << " Inference Plan Test Passed\n";
+	}
+	else
+	{
+		std::cout << " Inference Plan Test Failed\n";
+	}
+	
+	return passed;
+}
+
+static bool testQuantizedPlan(size_t layerSize, size_t blockCount,
+	size_t batchSize, std::default_random_engine& engine)
+{
+	auto featureSelector = createFeatureSelector(layerSize, blockCount, engine);
+	auto classifier      = createClassifier(featureSelector.getOutputCount(), 10, engine);
+	
+	size_t activation = 1;
+	
+	assignActivations(featureSelector, activation);
+	assignActivations(classifier,      activation);
+	
+	InferencePlan::NeuralNetworkVector networks;
+	
+	networks.push_back(&featureSelector);
+	networks.push_back(&classifier);
+	
+	InferencePlan reference;
+	InferencePlan quantized;
+	
+	reference.build(networks, batchSize);
+	quantized.build(networks, batchSize);
+	
+	quantized.calibrate(generateInput(batchSize, reference.getInputCount(), engine));
+	
+	// the calibration must survive a round trip through the model attribute
+	InferencePlan restored;
+	
+	restored.build(networks, batchSize);
+	restored.setCalibration(quantized.getCalibration());
+	restored.quantize();
+	
+	auto input = generateInput(batchSize, reference.getInputCount(), engine);
+	
+	bool passed = matches(restored.runInputs(input), reference.runInputs(input), 0.05f);
+	
+	if(passed)
+	{
+		std::cout << " Quantized Inference Plan Test Passed\n";
+	}
+	else
+	{
+		std::cout << " Quantized Inference Plan Test Failed\n";
+	}
+	
+	return passed;
+}
+
+static void runTest(size_t layerSize, size_t blockCount, size_t batchSize, bool seed)
+{
+	std::default_random_engine generator;
+
+	if(seed)
+	{
+		generator.seed(std::time(0));
+	}
+	
+	bool passed = testPlanMatchesNetwork(layerSize, blockCount, batchSize, generator);
+	
+	passed &= testQuantizedPlan(layerSize, blockCount, batchSize, generator);
+	
+	if(passed)
+	{
+		std::cout << "Test Passed\n";
+	}
+	else
+	{
+		std::cout << "Test Failed\n";
+	}
+}
+
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+	
+	bool verbose = false;
+	bool seed = false;
+
+	size_t layerSize  = 0;
+	size_t blockCount = 0;
+	size_t batchSize  = 0;
+
+	parser.description("The minerva inference plan test.");
+
+	parser.parse("-S", "--layer-size", layerSize, 16,
+		"The number of neurons per block.");
+	parser.parse("-b", "--blocks", blockCount, 4,
+		"The number of blocks in the first layer.");
+	parser.parse("-B", "--batch-size", batchSize, 8,
+		"The number of samples per batch.");
+	parser.parse("-s", "--seed", seed, false,
+		"Seed with time.");
+	parser.parse("-v", "--verbose", verbose, false,
+		"Print out log messages during execution");
+
+	parser.parse();
+
+	if(verbose)
+	{
+		minerva::util::enableAllLogs();
+	}
+	
+	try
+	{
+		minerva::neuralnetwork::runTest(layerSize, blockCount, batchSize, seed);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Inference Plan Test Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+	}
+
+	return 0;
+}
+
@@ -0,0 +1,173 @@
+/*! \file   test-layer-initialization.cpp
+	\author Gregory Diamos
+	\date   Sunday October 18, 2026
+	\brief  A unit test for parallel random layer initialization.
+*/
+
+// Minerva Includes
+#include <minerva/neuralnetwork/interface/Layer.h>
+
+#include <minerva/matrix/interface/BlockSparseMatrix.h>
+#include <minerva/matrix/interface/Matrix.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/ArgumentParser.h>
+
+// Standard Library Includes
+#include <random>
+#include <iostream>
+#include <cstring>
+#include <sstream>
+
+namespace minerva
+{
+
+namespace neuralnetwork
+{
+
+typedef matrix::BlockSparseMatrix BlockSparseMatrix;
+
+static std::string toString(size_t value)
+{
+	std::stringstream stream;
+
+	stream << value;
+
+	return stream.str();
+}
+
+static BlockSparseMatrix initialize(size_t blocks, size_t layerSize,
+	size_t threads, size_t seed)
+{
+	// force even a small layer onto the parallel path
+	util::KnobDatabase::setKnob("Layer::ParallelInitializationWeights", "1");
+	util::KnobDatabase::setKnob("Layer::InitializationThreads",
+		toString(threads));
+
+	std::default_random_engine engine(seed);
+
+	Layer layer(blocks, layerSize, layerSize);
+
+	layer.initializeRandomly(engine);
+
+	return layer.getWeightsWithoutBias();
+}
+
+static bool isBitIdentical(const BlockSparseMatrix& left,
+	const BlockSparseMatrix& right)
+{
+	if(left.blocks() != right.blocks())
+	{
+		std::cout << " Block count mismatch " << left.blocks() << " vs "
+			<< right.blocks() << "\n";
+		return false;
+	}
+
+	for(size_t block = 0; block < left.blocks(); ++block)
+	{
+		auto& leftData  = left[block].data();
+		auto& rightData = right[block].data();
+
+		if(leftData.size() != rightData.size() || std::memcmp(leftData.data(),
+			rightData.data(), leftData.size() * sizeof(float)) != 0)
+		{
+			std::cout << " Weights differ in block " << block << "\n";
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool testThreadCountDoesNotChangeWeights(size_t blocks, size_t layerSize,
+	size_t threads, size_t connections, size_t seed)
+{
+	util::KnobDatabase::setKnob("Layer::SparseInitializationConnections",
+		toString(connections));
+
+	auto serial   = initialize(blocks, layerSize, 1,       seed);
+	auto parallel = initialize(blocks, layerSize, threads, seed);
+
+	bool passed = isBitIdentical(serial, parallel);
+
+	if(passed)
+	{
+		std::cout << " Initialization Test Passed for " << threads
+			<< " threads and " << connections << " connections per neuron\n";
+	}
+	else
+	{
+		std::cout << " Initialization Test Failed for " << threads
+			<< " threads and " << connections << " connections per neuron\n";
+	}
+
+	return passed;
+}
+
+static void runTest(size_t blocks, size_t layerSize, size_t threads, size_t seed)
+{
+	bool passed = testThreadCountDoesNotChangeWeights(blocks, layerSize,
+		threads, 0, seed);
+
+	passed &= testThreadCountDoesNotChangeWeights(blocks, layerSize,
+		threads, layerSize / 4, seed);
+
+	if(passed)
+	{
+		std::cout << "Test Passed\n";
+	}
+	else
+	{
+		std::cout << "Test Failed\n";
+	}
+}
+
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+
+	bool verbose = false;
+
+	size_t blocks    = 0;
+	size_t layerSize = 0;
+	size_t threads   = 0;
+	size_t seed      = 0;
+
+	parser.description("The minerva layer initialization test.");
+
+	parser.parse("-b", "--blocks", blocks, 16,
+		"The number of blocks in the layer.");
+	parser.parse("-S", "--layer-size", layerSize, 32,
+		"The number of neurons per block.");
+	parser.parse("-t", "--threads", threads, 4,
+		"The number of threads to compare against a single thread.");
+	parser.parse("-s", "--seed", seed, 7,
+		"The seed for the random engine.");
+	parser.parse("-v", "--verbose", verbose, false,
+		"Print out log messages during execution");
+
+	parser.parse();
+
+	if(verbose)
+	{
+		minerva::util::enableAllLogs();
+	}
+
+	try
+	{
+		minerva::neuralnetwork::runTest(blocks, layerSize, threads, seed);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Layer Initialization Test Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+	}
+
+	return 0;
+}
+
@@ -57,17 +57,19 @@ static void createAndInitializeNeuralNetworks(
 	featureSelector.addLayer(Layer(blocks, blockSize, blockSize));
 	
 	// pooling layer
-	featureSelector.addLayer(Layer(featureSelector.back().blocks(),
+	featureSelector.addLayer(Layer(Layer::MaxPooling,
+		featureSelector.back().tiles(),
 		featureSelector.back().getInputBlockingFactor(),
 		featureSelector.back().getInputBlockingFactor() / reductionFactor));
 	
 	// convolutional layer
-	featureSelector.addLayer(Layer(featureSelector.back().blocks() / reductionFactor,
+	featureSelector.addLayer(Layer(featureSelector.back().tiles() / reductionFactor,
 		featureSelector.back().getInputBlockingFactor(),
 		featureSelector.back().getInputBlockingFactor()));
 	
 	// pooling layer
-	featureSelector.addLayer(Layer(featureSelector.back().blocks(),
+	featureSelector.addLayer(Layer(Layer::MaxPooling,
+		featureSelector.back().tiles(),
 		featureSelector.back().getInputBlockingFactor(),
 		featureSelector.back().getInputBlockingFactor() / reductionFactor));
 
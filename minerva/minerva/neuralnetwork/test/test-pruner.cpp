@@ -0,0 +1,268 @@
+/*! \file   test-pruner.cpp
+	\author Gregory Diamos
+	\date   Sunday October 18, 2026
+	\brief  A unit test for compacting a pruned neural network.
+*/
+
+// Minerva Includes
+#include <minerva/neuralnetwork/interface/NeuralNetworkPruner.h>
+#include <minerva/neuralnetwork/interface/NeuralNetwork.h>
+#include <minerva/neuralnetwork/interface/Layer.h>
+
+#include <minerva/matrix/interface/BlockSparseMatrix.h>
+#include <minerva/matrix/interface/Matrix.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/ArgumentParser.h>
+
+// Standard Library Includes
+#include <random>
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+namespace minerva
+{
+
+namespace neuralnetwork
+{
+
+typedef matrix::Matrix Matrix;
+typedef matrix::BlockSparseMatrix BlockSparseMatrix;
+typedef std::vector<size_t> IndexVector;
+
+/*! \brief Shrink the input weights of some neurons so that they are pruned */
+static void weakenNeurons(Layer& layer, size_t block, const IndexVector& neurons)
+{
+	auto weights = layer.getWeightsWithoutBias();
+
+	for(auto neuron : neurons)
+	{
+		for(size_t row = 0; row < weights[block].rows(); ++row)
+		{
+			weights[block](row, neuron) *= 1.0e-4f;
+		}
+	}
+
+	layer.setWeightsWithoutBias(weights);
+}
+
+/*! \brief Give every neuron a bias, so that pruned neurons output constants */
+static void randomizeBias(Layer& layer, std::default_random_engine& engine)
+{
+	std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+	auto bias = layer.getBias();
+
+	for(auto& block : bias)
+	{
+		for(auto& value : block.data())
+		{
+			value = distribution(engine);
+		}
+	}
+
+	layer.setBias(bias);
+}
+
+static void initialize(NeuralNetwork& network, std::default_random_engine& engine)
+{
+	network.initializeRandomly(engine);
+
+	for(auto& layer : network)
+	{
+		randomizeBias(layer, engine);
+	}
+}
+
+static Matrix createInput(size_t rows, size_t columns,
+	std::default_random_engine& engine)
+{
+	std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+	Matrix input(rows, columns);
+
+	for(auto& value : input.data())
+	{
+		value = distribution(engine);
+	}
+
+	return input;
+}
+
+static bool isClose(const Matrix& left, const Matrix& right)
+{
+	if(left.rows() != right.rows() || left.columns() != right.columns())
+	{
+		return false;
+	}
+
+	for(size_t i = 0; i < left.data().size(); ++i)
+	{
+		float expected = right.data()[i];
+
+		if(std::fabs(left.data()[i] - expected) >
+			1.0e-5f * std::max(1.0f, std::fabs(expected)))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*! \brief Prune and compact the network, and check that its outputs do not
+	change, and whether it shrinks. */
+static bool testCompact(NeuralNetwork& network, bool shouldShrink,
+	std::default_random_engine& engine, const std::string& name)
+{
+	NeuralNetworkPruner pruner;
+
+	pruner.prune(network, 1.0e-2f);
+
+	auto input = createInput(5, network.getInputCount(), engine);
+
+	auto outputBefore = network.runInputs(input);
+	auto weightsBefore = network.totalWeights();
+
+	pruner.compact(network);
+
+	auto outputAfter = network.runInputs(input);
+	auto weightsAfter = network.totalWeights();
+
+	bool passed = true;
+
+	if(!isClose(outputAfter, outputBefore))
+	{
+		std::cout << "  Outputs changed after compacting\n";
+		passed = false;
+	}
+
+	if(shouldShrink != (weightsAfter < weightsBefore))
+	{
+		std::cout << "  Compacting went from " << weightsBefore << " to "
+			<< weightsAfter << " weights\n";
+		passed = false;
+	}
+
+	std::cout << " Pruner " << name << " Test " << (passed ? "Passed" : "Failed")
+		<< "\n";
+
+	return passed;
+}
+
+static bool testSeparateWeights(std::default_random_engine& engine)
+{
+	NeuralNetwork network;
+
+	network.addLayer(Layer(2, 8, 6));
+	network.addLayer(Layer(2, 6, 4));
+	network.addLayer(Layer(1, 8, 3));
+
+	initialize(network, engine);
+
+	// two neurons of one block, but only one of the other, can be removed
+	weakenNeurons(network[0], 0, {1, 4});
+	weakenNeurons(network[0], 1, {2});
+	weakenNeurons(network[1], 0, {0});
+	weakenNeurons(network[1], 1, {3});
+
+	return testCompact(network, true, engine, "Separate Weights");
+}
+
+static bool testSharedWeights(std::default_random_engine& engine)
+{
+	NeuralNetwork network;
+
+	network.addLayer(Layer(4, 4, 3, 4, true));
+	network.addLayer(Layer(2, 6, 2, 6, true));
+	network.addLayer(Layer(1, 4, 2));
+
+	initialize(network, engine);
+
+	weakenNeurons(network[0], 0, {1});
+	weakenNeurons(network[1], 0, {0});
+
+	return testCompact(network, true, engine, "Shared Weights");
+}
+
+static bool testOverlappingWindows(std::default_random_engine& engine)
+{
+	NeuralNetwork network;
+
+	// windows overlap in the second layer, so its neurons can not be
+	// removed, and neither can the outputs of the first layer that feed it
+	network.addLayer(Layer(3, 4, 4));
+	network.addLayer(Layer(3, 4, 2, 2));
+	network.addLayer(Layer(1, 12, 3));
+
+	initialize(network, engine);
+
+	weakenNeurons(network[0], 0, {1});
+	weakenNeurons(network[0], 1, {1});
+	weakenNeurons(network[0], 2, {1});
+	weakenNeurons(network[1], 0, {0});
+	weakenNeurons(network[1], 1, {0});
+	weakenNeurons(network[1], 2, {0});
+
+	return testCompact(network, false, engine, "Overlapping Windows");
+}
+
+static void runTest(size_t seed)
+{
+	std::default_random_engine engine(seed);
+
+	bool passed = testSeparateWeights(engine);
+
+	passed &= testSharedWeights(engine);
+	passed &= testOverlappingWindows(engine);
+
+	if(passed)
+	{
+		std::cout << "Test Passed\n";
+	}
+	else
+	{
+		std::cout << "Test Failed\n";
+	}
+}
+
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+
+	bool verbose = false;
+
+	size_t seed = 0;
+
+	parser.description("The minerva neural network pruner test.");
+
+	parser.parse("-s", "--seed", seed, 7,
+		"The seed for the random engine.");
+	parser.parse("-v", "--verbose", verbose, false,
+		"Print out log messages during execution");
+
+	parser.parse();
+
+	if(verbose)
+	{
+		minerva::util::enableAllLogs();
+	}
+
+	try
+	{
+		minerva::neuralnetwork::runTest(seed);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Pruner Test Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+	}
+
+	return 0;
+}
+
@@ -0,0 +1,182 @@
+/*! \file   test-softmax-output.cpp
+	\author Gregory Diamos
+	\date   Sunday October 18, 2026
+	\brief  A unit test for the cross entropy delta and cost of a softmax layer.
+*/
+
+// Minerva Includes
+#include <minerva/neuralnetwork/interface/Layer.h>
+
+#include <minerva/matrix/interface/BlockSparseMatrix.h>
+#include <minerva/matrix/interface/Matrix.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/ArgumentParser.h>
+
+// Standard Library Includes
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+namespace minerva
+{
+
+namespace neuralnetwork
+{
+
+typedef matrix::BlockSparseMatrix BlockSparseMatrix;
+typedef std::vector<float> FloatVector;
+typedef std::vector<FloatVector> FloatTable;
+
+/*! \brief Split the rows of a table into column blocks, as a layer output */
+static BlockSparseMatrix toBlocks(const FloatTable& table, size_t blocks)
+{
+	size_t rows    = table.size();
+	size_t columns = table.front().size() / blocks;
+
+	BlockSparseMatrix result(blocks, rows, columns, false);
+
+	for(size_t block = 0; block < blocks; ++block)
+	{
+		for(size_t row = 0; row < rows; ++row)
+		{
+			for(size_t column = 0; column < columns; ++column)
+			{
+				result[block](row, column) = table[row][block * columns + column];
+			}
+		}
+	}
+
+	return result;
+}
+
+static float getValue(const BlockSparseMatrix& m, size_t row, size_t column)
+{
+	size_t columns = m[0].columns();
+
+	return m[column / columns](row, column % columns);
+}
+
+static bool isClose(float left, float right)
+{
+	return std::fabs(left - right) <= 1.0e-5f * std::max(1.0f, std::fabs(right));
+}
+
+static void runTest()
+{
+	const size_t blocks = 2;
+
+	Layer layer(blocks, 3, 3);
+
+	layer.setActivation(Layer::Softmax);
+
+	// row 0 is labeled in the first block, row 1 in the second, row 2 has a
+	// label that is not among the outputs, and row 3 has two labels
+	FloatTable reference = {
+		{0.1f, 0.9f, 0.1f, 0.1f, 0.1f, 0.1f},
+		{0.1f, 0.1f, 0.1f, 0.1f, 0.9f, 0.1f},
+		{0.1f, 0.1f, 0.1f, 0.1f, 0.1f, 0.1f},
+		{0.9f, 0.1f, 0.1f, 0.9f, 0.1f, 0.1f}
+	};
+
+	std::vector<size_t> labels = {1, 4};
+
+	FloatTable output(reference.size(), FloatVector(reference.front().size()));
+
+	for(size_t row = 0; row < output.size(); ++row)
+	{
+		for(size_t column = 0; column < output[row].size(); ++column)
+		{
+			output[row][column] = (row * output[row].size() + column + 1) / 100.0f;
+		}
+	}
+
+	auto outputBlocks    = toBlocks(output,    blocks);
+	auto referenceBlocks = toBlocks(reference, blocks);
+
+	auto delta = layer.getOutputDelta(outputBlocks, referenceBlocks);
+	auto cost  = layer.getOutputCost(outputBlocks, referenceBlocks);
+
+	bool passed = true;
+
+	for(size_t row = 0; row < output.size(); ++row)
+	{
+		for(size_t column = 0; column < output[row].size(); ++column)
+		{
+			float expected = 0.0f;
+
+			if(row < labels.size())
+			{
+				expected = output[row][column] -
+					(column == labels[row] ? 1.0f : 0.0f);
+			}
+
+			float computed = getValue(delta, row, column);
+
+			if(!isClose(computed, expected))
+			{
+				std::cout << " Delta mismatch at (" << row << ", " << column
+					<< "): " << computed << " vs " << expected << "\n";
+				passed = false;
+			}
+		}
+	}
+
+	float expectedCost = 0.0f;
+
+	for(size_t row = 0; row < labels.size(); ++row)
+	{
+		expectedCost -= std::log(output[row][labels[row]]);
+	}
+
+	if(!isClose(cost, expectedCost))
+	{
+		std::cout << " Cost mismatch: " << cost << " vs " << expectedCost << "\n";
+		passed = false;
+	}
+
+	if(passed)
+	{
+		std::cout << "Test Passed\n";
+	}
+	else
+	{
+		std::cout << "Test Failed\n";
+	}
+}
+
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+
+	bool verbose = false;
+
+	parser.description("The minerva softmax output layer test.");
+
+	parser.parse("-v", "--verbose", verbose, false,
+		"Print out log messages during execution");
+
+	parser.parse();
+
+	if(verbose)
+	{
+		minerva::util::enableAllLogs();
+	}
+
+	try
+	{
+		minerva::neuralnetwork::runTest();
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Softmax Output Test Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+	}
+
+	return 0;
+}
+
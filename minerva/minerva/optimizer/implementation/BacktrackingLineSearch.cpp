@@ -13,6 +13,7 @@
 
 #include <minerva/util/interface/Knobs.h>
 #include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Profiler.h>
 
 namespace minerva
 {
@@ -20,13 +21,27 @@ namespace minerva
 namespace optimizer
 {
 
+static util::LogChannel backtrackingLineSearchLog("BacktrackingLineSearch");
+
+static util::Knob<float> machinePrecisionKnob("LineSearch::MachinePrecision", 1.0e-13f);
+static util::Knob<float> gradientAccuracyKnob("LineSearch::GradientAccuracy", 0.9f);
+static util::Knob<float> functionAccuracyKnob("LineSearch::FunctionAccuracy", 1.0e-4f);
+static util::Knob<float> maximumStepKnob("LineSearch::MaximumStep", 1.0e20f);
+static util::Knob<float> minimumStepKnob("LineSearch::MinimumStep", 1.0e-20f);
+static util::Knob<int>   maximumIterationsKnob("LineSearch::MaximumIterations", 10);
+
+static util::Knob<float> increaseKnob("BacktrackingLineSearch::Increase", 2.1f);
+static util::Knob<float> decreaseKnob("BacktrackingLineSearch::Decrease", 0.5f);
+static util::Knob<float> wolfeConditionKnob(
+	"BacktrackingLineSearch::WolfeCondition", 0.9f);
+
 BacktrackingLineSearch::BacktrackingLineSearch()
-: _xTolerance(util::KnobDatabase::getKnobValue("LineSearch::MachinePrecision", 1.0e-13f)),
-  _gTolerance(util::KnobDatabase::getKnobValue("LineSearch::GradientAccuracy", 0.9f)),
-  _fTolerance(util::KnobDatabase::getKnobValue("LineSearch::FunctionAccuracy", 1.0e-4f)),
-  _maxStep(util::KnobDatabase::getKnobValue("LineSearch::MaximumStep", 1.0e20f)),
-  _minStep(util::KnobDatabase::getKnobValue("LineSearch::MinimumStep", 1.0e-20f)),
-  _maxLineSearch(util::KnobDatabase::getKnobValue("LineSearch::MaximumIterations", 10))
+: _xTolerance(machinePrecisionKnob),
+  _gTolerance(gradientAccuracyKnob),
+  _fTolerance(functionAccuracyKnob),
+  _maxStep(maximumStepKnob),
+  _minStep(minimumStepKnob),
+  _maxLineSearch(maximumIterationsKnob)
 {
 	if(_fTolerance < 0.0f)
 	{
@@ -68,13 +83,13 @@ void BacktrackingLineSearch::search(
 	float step, const BlockSparseMatrixVector& previousInputs,
 	const BlockSparseMatrixVector& previousGradients)
 {
-	float increase = util::KnobDatabase::getKnobValue("BacktrackingLineSearch::Increase", 2.1f);
-	float decrease = util::KnobDatabase::getKnobValue("BacktrackingLineSearch::Decrease", 0.5f);
-	float wolfe    = util::KnobDatabase::getKnobValue("BacktrackingLineSearch::WolfeCondition", 0.9f);
+	float increase = increaseKnob;
+	float decrease = decreaseKnob;
+	float wolfe    = wolfeConditionKnob;
 
 	float initialCost = cost;
 
-	util::log("BacktrackingLineSearch") << "Starting line search with initial cost " << cost << "\n";
+	logIf(backtrackingLineSearchLog) << "Starting line search with initial cost " << cost << "\n";
 
 	size_t iteration = 0;
 	float  initialGradientDirection = gradient.dotProduct(direction);
@@ -88,6 +103,8 @@ void BacktrackingLineSearch::search(
 
 	while(true)
 	{
+		util::ProfilerScope scope("BacktrackingLineSearch::probe");
+
 		float width = 0.0f;
 
 		// Compute the current value of : inputs <- previousInputs + step * direction
@@ -136,7 +153,7 @@ void BacktrackingLineSearch::search(
 		step = step * width;
 	}
 	
-	util::log("BacktrackingLineSearch") << " Updated (step size " << (step) << ", cost " << cost << ", iteration " << iteration << ")\n";
+	logIf(backtrackingLineSearchLog) << " Updated (step size " << (step) << ", cost " << cost << ", iteration " << iteration << ")\n";
 }
 
 }
@@ -15,6 +15,8 @@
 
 #include <minerva/util/interface/debug.h>
 #include <minerva/util/interface/knobs.h>
+#include <minerva/util/interface/Profiler.h>
+#include <minerva/util/interface/Metrics.h>
 
 // Standard Library Includes
 #include <deque>
@@ -27,6 +29,24 @@ namespace minerva
 namespace optimizer
 {
 
+static util::LogChannel gpuLbfgsSolverLog("GPULBFGSSolver");
+
+static util::Counter& solverIterations = util::Metrics::getCounter(
+	"minerva_solver_iterations_total", "Iterations run by all solvers.");
+static util::Gauge& solverCost = util::Metrics::getGauge(
+	"minerva_solver_cost", "Cost after the latest solver iteration.");
+static util::Gauge& solverGradientNorm = util::Metrics::getGauge(
+	"minerva_solver_gradient_norm", "Gradient norm after the latest iteration.");
+static util::Gauge& solverStep = util::Metrics::getGauge(
+	"minerva_solver_step", "Line search step of the latest iteration.");
+
+static util::Knob<int> maximumIterationsKnob("LBFGSSolver::MaxIterations", 500);
+static util::Knob<float> stoppingGradientEpsilonKnob(
+	"LBFGSSolver::StoppingGradientEpsilon", 1e-6f);
+static util::Knob<float> minimumImprovementKnob(
+	"LBFGSSolver::MinimumImprovement", 1e-6f);
+static util::Knob<int> historySizeKnob("LBFGSSolver::HistorySize", 5);
+
 typedef GPULBFGSSolver::BlockSparseMatrixVector BlockSparseMatrixVector;
 
 GPULBFGSSolver::~GPULBFGSSolver()
@@ -55,10 +75,10 @@ public:
 };
 
 GPULBFGSSolverParameters::GPULBFGSSolverParameters()
-: maximumIterations(util::KnobDatabase::getKnobValue("LBFGSSolver::MaxIterations", 500)), 
-  stoppingGradientEpsilon(util::KnobDatabase::getKnobValue("LBFGSSolver::StoppingGradientEpsilon", 1e-6f)),
-  minimumImprovement(util::KnobDatabase::getKnobValue("LBFGSSolver::MinimumImprovement", 1e-6f)),
-  historySize(util::KnobDatabase::getKnobValue("LBFGSSolver::HistorySize", 5))
+: maximumIterations(maximumIterationsKnob), 
+  stoppingGradientEpsilon(stoppingGradientEpsilonKnob),
+  minimumImprovement(minimumImprovementKnob),
+  historySize(historySizeKnob)
 {
 
 }
@@ -307,7 +327,12 @@ static void reportProgress(float cost, const BlockSparseMatrixVector& gradient,
 	float inputNorm, float gradientNorm, float step, size_t iteration,
 	size_t totalIterations)
 {
-	util::log("GPULBFGSSolver") << "LBFGS Update (cost " << cost << ", input-norm "
+	solverIterations.increment();
+	solverCost.set(cost);
+	solverGradientNorm.set(gradientNorm);
+	solverStep.set(step);
+
+	logIf(gpuLbfgsSolverLog) << "LBFGS Update (cost " << cost << ", input-norm "
 		<< inputNorm << ", gradient-norm " << gradientNorm << ", step " << step
 		<< ", iteration " << iteration << " / " << totalIterations << ")\n";
 }
@@ -351,6 +376,8 @@ float GPULBFGSSolverImplementation::solve()
 	// Iterate
 	while(true)
 	{
+		util::ProfilerScope scope("GPULBFGSSolver::iteration");
+
 		// save the inputs and gradient
 		auto previousInputs   = _inputs;
 		auto previousGradient = gradient;
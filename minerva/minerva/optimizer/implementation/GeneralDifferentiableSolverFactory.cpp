@@ -18,6 +18,10 @@ namespace minerva
 namespace optimizer
 {
 
+static util::Knob<std::string> solverTypeKnob(
+	"GeneralDifferentiableSolver::Type", "LBFGSSolver",
+	"The solver used for general differentiable cost functions");
+
 GeneralDifferentiableSolver* GeneralDifferentiableSolverFactory::create(const std::string& name)
 {
 	GeneralDifferentiableSolver* solver = nullptr;
@@ -44,8 +48,7 @@ GeneralDifferentiableSolver* GeneralDifferentiableSolverFactory::create(const st
 
 static std::string getSolverName()
 {
-	return util::KnobDatabase::getKnobValue("GeneralDifferentiableSolver::Type",
-		"LBFGSSolver");
+	return solverTypeKnob;
 }
 
 GeneralDifferentiableSolver* GeneralDifferentiableSolverFactory::create()
@@ -16,6 +16,8 @@
 
 #include <minerva/util/interface/Knobs.h>
 #include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Profiler.h>
+#include <minerva/util/interface/Metrics.h>
 
 // Standard Library Includes
 #include <stdexcept>
@@ -25,6 +27,22 @@ namespace minerva
 namespace optimizer
 {
 
+static util::LogChannel gradientDescentSolverLog("GradientDescentSolver");
+
+static util::Knob<float> learningRateKnob(
+	"GradientDescentSolver::LearningRate", 0.4f);
+static util::Knob<float> epsilonKnob(
+	"GradientDescentSolver::Epsilon", 1.0e-6f);
+static util::Knob<float> learningRateBackoffKnob(
+	"GradientDescentSolver::LearningRateBackoff", 0.5f);
+static util::Knob<float> iterationsKnob(
+	"GradientDescentSolver::Iterations", 10000000);
+
+static util::Counter& solverIterations = util::Metrics::getCounter(
+	"minerva_solver_iterations_total", "Iterations run by all solvers.");
+static util::Gauge& solverCost = util::Metrics::getGauge(
+	"minerva_solver_cost", "Cost after the latest solver iteration.");
+
 GradientDescentSolver::~GradientDescentSolver()
 {
 
@@ -37,14 +55,10 @@ static void applyConstraints(BlockSparseMatrixVector& weights, const ConstraintV
 
 float GradientDescentSolver::solve(BlockSparseMatrixVector& weights, const CostAndGradientFunction& callback)
 {
-   float learningRate = util::KnobDatabase::getKnobValue<float>(
-		"GradientDescentSolver::LearningRate", 0.4f);
-	float epsilon = util::KnobDatabase::getKnobValue<float>(
-		"GradientDescentSolver::Epsilon", 1.0e-6f);
-	float learningRateBackoff = util::KnobDatabase::getKnobValue<float>(
-		"GradientDescentSolver::LearningRateBackoff", 0.5f);
-	unsigned iterations = util::KnobDatabase::getKnobValue<float>(
-		"GradientDescentSolver::Iterations", 10000000);
+	float    learningRate        = learningRateKnob;
+	float    epsilon             = epsilonKnob;
+	float    learningRateBackoff = learningRateBackoffKnob;
+	unsigned iterations          = iterationsKnob;
 
 	auto derivative = callback.getUninitializedDataStructure();
 
@@ -53,11 +67,13 @@ float GradientDescentSolver::solve(BlockSparseMatrixVector& weights, const CostA
 
 	float learningRateBaseline = learningRate;
 	
-	util::log("GradientDescentSolver") << "Solving for at most "
+	logIf(gradientDescentSolverLog) << "Solving for at most "
 		<< iterations << " iterations\n";
 		
 	for(unsigned i = 0; i < iterations; ++i)
 	{
+		util::ProfilerScope scope("GradientDescentSolver::iteration");
+
 		BlockSparseMatrixVector newWeights;
 		
 		newWeights.reserve(derivative.size());
@@ -72,9 +88,12 @@ float GradientDescentSolver::solve(BlockSparseMatrixVector& weights, const CostA
 	
 		float newCost = callback.computeCostAndGradient(derivative, newWeights);
 		
+		solverIterations.increment();
+		solverCost.set(newCost);
+		
 		if(newCost < previousCost)
 		{
-			util::log("GradientDescentSolver") << " Cost is now " << (newCost)
+			logIf(gradientDescentSolverLog) << " Cost is now " << (newCost)
 				<< " (changed by " << (newCost - previousCost) << ")\n";
 			
 			weights      = newWeights;
@@ -97,7 +116,7 @@ float GradientDescentSolver::solve(BlockSparseMatrixVector& weights, const CostA
 
 			learningRateBaseline = learningRate;
 			
-			util::log("GradientDescentSolver") << " Backing off learning rate to "
+			logIf(gradientDescentSolverLog) << " Backing off learning rate to "
 				<< learningRate << "\n";
 		}
 	}
@@ -28,6 +28,12 @@ namespace minerva
 namespace optimizer
 {
 
+static util::LogChannel lbfgsSolverLog("LBFGSSolver");
+
+static util::Knob<int> maximumLineSearchIterationsKnob(
+	"LBFGSSolver::MaxLineSearchIterations", 10);
+static util::Knob<int> maximumIterationsKnob("LBFGSSolver::MaxIterations", 500);
+
 typedef matrix::Matrix Matrix;
 typedef Matrix::FloatVector FloatVector;
 
@@ -115,7 +121,7 @@ static int lbfgsProgress(void* instance, const double* x,
 	const CostAndGradientFunction* callback =
 		reinterpret_cast<const CostAndGradientFunction*>(instance);
 
-	util::log("LBFGSSolver") << "LBFGS Update (cost " << fx << ", xnorm "
+	logIf(lbfgsSolverLog) << "LBFGS Update (cost " << fx << ", xnorm "
 		<< xnorm << ", gnorm " << gnorm << ", step " << step << ", n " << n
 		<< ", k " << k << ", ls " << ls << ")\n";
 
@@ -245,11 +251,9 @@ float LBFGSSolver::solve(BlockSparseMatrixVector& inputs, const CostAndGradientF
 	//parameters.ftol = 1e-10;
 	//parameters.gtol = 1e-10;
 	
-	parameters.max_linesearch = util::KnobDatabase::getKnobValue(
-		"LBFGSSolver::MaxLineSearchIterations", 10);
+	parameters.max_linesearch = maximumLineSearchIterationsKnob;
 
-	parameters.max_iterations =
-		util::KnobDatabase::getKnobValue("LBFGSSolver::MaxIterations", 500);
+	parameters.max_iterations = maximumIterationsKnob;
 	
 	int status = LBFGSSolverLibrary::lbfgs(getSize(inputs), inputArray,
 		&finalCost, lbfgsCallback, lbfgsProgress,
@@ -272,7 +276,7 @@ float LBFGSSolver::solve(BlockSparseMatrixVector& inputs, const CostAndGradientF
 				code.str() + ") message (" + getMessage(status) + ").");		
 		}
 
-		util::log("LBFGSSolver") << "Terminated search early "
+		logIf(lbfgsSolverLog) << "Terminated search early "
 			<< getMessage(status) << ".\n";
 	}
 	
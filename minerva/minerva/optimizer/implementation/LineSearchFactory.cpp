@@ -19,6 +19,9 @@ namespace minerva
 namespace optimizer
 {
 
+static util::Knob<std::string> defaultLineSearchKnob("LineSearch::Default",
+	"BacktrackingLineSearch", "The line search used by the solvers");
+
 std::unique_ptr<LineSearch> LineSearchFactory::create(const std::string& searchName)
 {
 	std::unique_ptr<LineSearch> lineSearch;
@@ -37,7 +40,7 @@ std::unique_ptr<LineSearch> LineSearchFactory::create(const std::string& searchN
 
 std::unique_ptr<LineSearch> LineSearchFactory::create()
 {
-	return create(util::KnobDatabase::getKnobValue("LineSearch::Default", "BacktrackingLineSearch"));
+	return create(defaultLineSearchKnob);
 }
 
 }
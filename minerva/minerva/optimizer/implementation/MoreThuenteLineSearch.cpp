@@ -13,6 +13,7 @@
 
 #include <minerva/util/interface/Knobs.h>
 #include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Profiler.h>
 
 // Standard Library Includes
 #include <algorithm>
@@ -26,6 +27,15 @@ namespace minerva
 namespace optimizer
 {
 
+static util::LogChannel moreThuenteLineSearchLog("MoreThuenteLineSearch");
+
+static util::Knob<float> machinePrecisionKnob("LineSearch::MachinePrecision", 1.0e-13f);
+static util::Knob<float> gradientAccuracyKnob("LineSearch::GradientAccuracy", 0.9f);
+static util::Knob<float> functionAccuracyKnob("LineSearch::FunctionAccuracy", 1.0e-4f);
+static util::Knob<float> maximumStepKnob("LineSearch::MaximumStep", 1.0e20f);
+static util::Knob<float> minimumStepKnob("LineSearch::MinimumStep", 1.0e-20f);
+static util::Knob<int>   maximumIterationsKnob("LineSearch::MaximumIterations", 10);
+
 static bool isSignDifferent(float left, float right)
 {
 	return std::copysign(1.0f, left) != std::copysign(1.0f, right);
@@ -420,12 +430,12 @@ static void updateIntervalOfUncertainty(
 
 
 MoreThuenteLineSearch::MoreThuenteLineSearch()
-: _xTolerance(util::KnobDatabase::getKnobValue("LineSearch::MachinePrecision", 1.0e-13f)),
-  _gTolerance(util::KnobDatabase::getKnobValue("LineSearch::GradientAccuracy", 0.9f)),
-  _fTolerance(util::KnobDatabase::getKnobValue("LineSearch::FunctionAccuracy", 1.0e-4f)),
-  _maxStep(util::KnobDatabase::getKnobValue("LineSearch::MaximumStep", 1.0e20f)),
-  _minStep(util::KnobDatabase::getKnobValue("LineSearch::MinimumStep", 1.0e-20f)),
-  _maxLineSearch(util::KnobDatabase::getKnobValue("LineSearch::MaximumIterations", 10))
+: _xTolerance(machinePrecisionKnob),
+  _gTolerance(gradientAccuracyKnob),
+  _fTolerance(functionAccuracyKnob),
+  _maxStep(maximumStepKnob),
+  _minStep(minimumStepKnob),
+  _maxLineSearch(maximumIterationsKnob)
 {
 	if(_fTolerance < 0.0f)
 	{
@@ -461,7 +471,7 @@ void MoreThuenteLineSearch::search(
 	float step, const BlockSparseMatrixVector& previousInputs,
 	const BlockSparseMatrixVector& previousGradients)
 {
-	util::log("MoreThuenteLineSearch") << "Starting line search with initial cost " << cost << "\n";
+	logIf(moreThuenteLineSearchLog) << "Starting line search with initial cost " << cost << "\n";
 	
 	// check the inputs for errors
 	assert(step > 0.0f);
@@ -506,7 +516,9 @@ void MoreThuenteLineSearch::search(
 	
 	while(true)
 	{
-		util::log("MoreThuenteLineSearch") << " iteration " << iteration << "\n";
+		util::ProfilerScope scope("MoreThuenteLineSearch::probe");
+
+		logIf(moreThuenteLineSearchLog) << " iteration " << iteration << "\n";
 
 		// Set the min/max steps to correspond to the current interval of uncertainty
 		float minStep = 0.0f;
@@ -527,7 +539,7 @@ void MoreThuenteLineSearch::search(
 		if(step < _minStep) step = _minStep;
 		if(_maxStep < step) step = _maxStep;
 		
-		util::log("MoreThuenteLineSearch") << "  " << cost << " cost, " << bestStep
+		logIf(moreThuenteLineSearchLog) << "  " << cost << " cost, " << bestStep
 			<< " begin step (" << bestCost << " cost, " << bestGradientDirection
 			<< " direction), " << intervalEndStep << " end step (" << intervalEndCost
 			<< " cost, " << intervalEndGradientDirection << " direction)\n";
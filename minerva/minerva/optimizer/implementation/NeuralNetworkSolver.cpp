@@ -15,6 +15,9 @@ namespace minerva
 namespace optimizer
 {
 
+static util::Knob<std::string> solverTypeKnob("Solver::Type",
+	"TiledConvolutionalSolver", "The solver used to train neural networks");
+
 NeuralNetworkSolver::NeuralNetworkSolver(BackPropagation* b)
 : m_backPropDataPtr(b)
 {
@@ -33,8 +36,14 @@ void NeuralNetworkSolver::solve()
 
 NeuralNetworkSolver* NeuralNetworkSolver::create(BackPropagation* d)
 {
-	auto solverName = util::KnobDatabase::getKnobValue("Solver::Type",
-		"TiledConvolutionalSolver");
+	// avoid the string knob lock in the common case
+	if(solverTypeKnob.isSet() &&
+		solverTypeKnob.get() != "TiledConvolutionalSolver")
+	{
+		util::log("NeuralNetworkSolver") << "Unknown solver type '"
+			<< solverTypeKnob.get() << "', falling back to "
+			"TiledConvolutionalSolver.\n";
+	}
 
 	// Fall back to tiled solver
 	return new TiledConvolutionalSolver(d);
@@ -23,6 +23,11 @@ namespace minerva
 namespace optimizer
 {
 
+static util::LogChannel simulatedAnnealingSolverLog("SimulatedAnnealingSolver");
+
+static util::Knob<unsigned> iterationsKnob("SimulatedAnnealing::Iterations", 50000);
+static util::Knob<float> tempuratureKnob("SimulatedAnnealing::Tempurature", 50.0f);
+
 typedef matrix::Matrix Matrix;
 
 SimulatedAnnealingSolver::~SimulatedAnnealingSolver()
@@ -79,8 +84,7 @@ static float simulatedAnnealing(Matrix& inputs, const CostFunction& callback)
 	std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
 	std::default_random_engine generator(std::time(0));
 
-	unsigned iterations = util::KnobDatabase::getKnobValue(
-		"SimulatedAnnealing::Iterations", 50000);
+	unsigned iterations = iterationsKnob;
 	
 	auto  currentInputs = inputs;
 	float currentCost	= callback.computeCost(currentInputs);
@@ -88,12 +92,11 @@ static float simulatedAnnealing(Matrix& inputs, const CostFunction& callback)
 	float bestCostSoFar = currentCost;
 	auto  bestInputs    = currentInputs;
 
-	util::log("SimulatedAnnealingSolver")
+	logIf(simulatedAnnealingSolverLog)
 		<< "   Running simmulated annealing for "
 		<< iterations << " iterations\n";
 
-	float tempurature = util::KnobDatabase::getKnobValue(
-		"SimulatedAnnealing::Tempurature", 50.0f);
+	float tempurature = tempuratureKnob;
 	
 	for(unsigned i = 0; i < iterations; ++i)
 	{
@@ -110,7 +113,7 @@ static float simulatedAnnealing(Matrix& inputs, const CostFunction& callback)
 			currentInputs = newInputs;
 			currentCost	  = newCost;
 			
-			util::log("SimulatedAnnealingSolver") << "	accepted new inputs, "
+			logIf(simulatedAnnealingSolverLog) << "	accepted new inputs, "
 				"cost is now: " << currentCost << " (iteration " << i << ")\n";
 		}
 
@@ -119,7 +122,7 @@ static float simulatedAnnealing(Matrix& inputs, const CostFunction& callback)
 			bestInputs    = newInputs;
 			bestCostSoFar = newCost;
 
-			util::log("SimulatedAnnealingSolver") << "	 best cost is now: "
+			logIf(simulatedAnnealingSolverLog) << "	 best cost is now: "
 				<< bestCostSoFar << " (iteration " << i << ")\n";
 		}
 	}
@@ -33,6 +33,9 @@ namespace minerva
 namespace optimizer
 {
 
+static util::LogChannel tiledConvolutionalSolverLog("TiledConvolutionalSolver");
+static util::LogChannel tiledConvolutionalSolverDetailLog("TiledConvolutionalSolver::Detail");
+
 typedef neuralnetwork::BackPropagation BackPropagation;
 typedef neuralnetwork::NeuralNetwork NeuralNetwork;
 typedef neuralnetwork::NeuralNetworkSubgraphExtractor NeuralNetworkSubgraphExtractor;
@@ -66,14 +69,11 @@ public:
 	{
 		gradient = _backPropDataPtr->computePartialDerivativesForNewWeights(inputs);
 		
-		if(util::isLogEnabled("TiledConvolutionalSolver::Detail"))
-		{	
-			util::log("TiledConvolutionalSolver::Detail") << " new gradient is : " << gradient.front().toString();
-		}
+		logIf(tiledConvolutionalSolverDetailLog) << " new gradient is : " << gradient.front().toString();
 		
 		float newCost = _backPropDataPtr->computeCostForNewWeights(inputs);
 		
-		util::log("TiledConvolutionalSolver::Detail") << " new cost is : " << newCost << "\n";
+		logIf(tiledConvolutionalSolverDetailLog) << " new cost is : " << newCost << "\n";
 		
 		return newCost;
 	}
@@ -84,7 +84,7 @@ private:
 
 static float differentiableSolver(BackPropagation* backPropData)
 {
-	util::log("TiledConvolutionalSolver") << "  starting general solver\n";
+	logIf(tiledConvolutionalSolverLog) << "  starting general solver\n";
 		
 	auto solver = GeneralDifferentiableSolverFactory::create();
 	
@@ -92,7 +92,7 @@ static float differentiableSolver(BackPropagation* backPropData)
 	
 	if(solver == nullptr)
 	{
-		util::log("TiledConvolutionalSolver") << "   failed to allocate solver\n";
+		logIf(tiledConvolutionalSolverLog) << "   failed to allocate solver\n";
 		return newCost;
 	}
 	
@@ -106,14 +106,14 @@ static float differentiableSolver(BackPropagation* backPropData)
 	}
 	catch(...)
 	{
-		util::log("TiledConvolutionalSolver") << "   solver produced an error.\n";
+		logIf(tiledConvolutionalSolverLog) << "   solver produced an error.\n";
 		delete solver;
 		throw;
 	}
 	
 	delete solver;
 	
-	util::log("TiledConvolutionalSolver") << "   solver produced new cost: "
+	logIf(tiledConvolutionalSolverLog) << "   solver produced new cost: "
 		<< newCost << ".\n";
 
 	backPropData->setWeights(weights);
@@ -122,23 +122,44 @@ static float differentiableSolver(BackPropagation* backPropData)
 }
 
 
+static bool canBeTiled(const NeuralNetwork& network)
+{
+	for(auto& layer : network)
+	{
+		if(layer.isWeightShared() || layer.isPooling())
+		{
+			return false;
+		}
+	}
+	
+	return true;
+}
+
 void TiledConvolutionalSolver::solve()
 {
-    util::log("TiledConvolutionalSolver") << "Solve\n";
+    logIf(tiledConvolutionalSolverLog) << "Solve\n";
 	
 	// Accuracy 
-	if(util::isLogEnabled("TiledConvolutionalSolver::Detail"))
-	{
-		util::log("TiledConvolutionalSolver::Detail") << " accuracy before training: "
-			<< m_backPropDataPtr->getNeuralNetwork()->computeAccuracy(*m_backPropDataPtr->getInput(),
-				*m_backPropDataPtr->getReferenceOutput()) << "\n";
-	}
+	logIf(tiledConvolutionalSolverDetailLog) << " accuracy before training: "
+		<< m_backPropDataPtr->getNeuralNetwork()->computeAccuracy(*m_backPropDataPtr->getInput(),
+			*m_backPropDataPtr->getReferenceOutput()) << "\n";
 
 	// Save the initial back prop parameters	
 	auto neuralNetwork = m_backPropDataPtr->getNeuralNetwork();
 	auto input         = m_backPropDataPtr->getInput();
 	auto reference     = m_backPropDataPtr->getReferenceOutput();
 
+	// Shared weights couple every tile, and pooling layers have no weight
+	//  blocks to split into tiles, so those networks are solved whole
+	if(!canBeTiled(*neuralNetwork))
+	{
+		logIf(tiledConvolutionalSolverLog)
+			<< " layers share weights or pool, solving entire network at once.\n";
+		differentiableSolver(m_backPropDataPtr);
+		
+		return;
+	}
+
 	// Tile the network
 	NeuralNetworkSubgraphExtractor extractor(neuralNetwork, input, reference);
 	
@@ -153,7 +174,7 @@ void TiledConvolutionalSolver::solve()
 			BlockSparseMatrix inputTile(input->isRowSparse());
 			BlockSparseMatrix referenceTile(reference->isRowSparse());
 			
-			util::log("TiledConvolutionalSolver") << " solving tile " << extractor.getTileIndex(tile)
+			logIf(tiledConvolutionalSolverLog) << " solving tile " << extractor.getTileIndex(tile)
 				<< " out of " << extractor.tiles() << " with "
 				<< extractor.getTotalConnections(tile) << " connections\n";
 			
@@ -175,18 +196,15 @@ void TiledConvolutionalSolver::solve()
 	}
 	else
 	{
-		util::log("TiledConvolutionalSolver")
+		logIf(tiledConvolutionalSolverLog)
 			<< " no need for tiling, solving entire network at once.\n";
 		differentiableSolver(m_backPropDataPtr);
 	}
 	
 	// Accuracy 
-	if(util::isLogEnabled("TiledConvolutionalSolver::Detail"))
-	{
-		util::log("TiledConvolutionalSolver::Detail") << "  accuracy after training: "
-			<< m_backPropDataPtr->getNeuralNetwork()->computeAccuracy(*m_backPropDataPtr->getInput(),
-				*m_backPropDataPtr->getReferenceOutput()) << "\n";
-	}
+	logIf(tiledConvolutionalSolverDetailLog) << "  accuracy after training: "
+		<< m_backPropDataPtr->getNeuralNetwork()->computeAccuracy(*m_backPropDataPtr->getInput(),
+			*m_backPropDataPtr->getReferenceOutput()) << "\n";
 }
 
 }
@@ -0,0 +1,25 @@
+/*	\file   TimestampedLabelResult.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The source file for the TimestampedLabelResult class.
+*/
+
+#include <minerva/results/interface/TimestampedLabelResult.h>
+
+namespace minerva
+{
+
+namespace results
+{
+
+TimestampedLabelResult::TimestampedLabelResult(const std::string& l,
+	size_t f, double t, double lat)
+: LabelResult(l), frame(f), timestamp(t), latency(lat)
+{
+
+}
+
+}
+
+}
+
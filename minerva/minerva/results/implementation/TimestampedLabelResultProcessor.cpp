@@ -0,0 +1,65 @@
+/*	\file   TimestampedLabelResultProcessor.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The source file for the TimestampedLabelResultProcessor class.
+*/
+
+// Minerva Includes
+#include <minerva/results/interface/TimestampedLabelResultProcessor.h>
+#include <minerva/results/interface/TimestampedLabelResult.h>
+#include <minerva/results/interface/ResultVector.h>
+
+#include <minerva/util/interface/debug.h>
+
+// Standard Library Includes
+#include <iostream>
+#include <stdexcept>
+
+namespace minerva
+{
+
+namespace results
+{
+
+TimestampedLabelResultProcessor::~TimestampedLabelResultProcessor()
+{
+
+}
+
+void TimestampedLabelResultProcessor::process(const ResultVector& results)
+{
+	std::ostream& stream = _output.is_open() ? _output : std::cout;
+	
+	for(auto result : results)
+	{
+		auto labelResult = dynamic_cast<TimestampedLabelResult*>(result);
+		
+		assertM(labelResult != nullptr, "Expecting timestamped label results.");
+		
+		stream << labelResult->frame << " " << labelResult->timestamp << " "
+			<< labelResult->label << "\n";
+	}
+	
+	stream.flush();
+}
+
+void TimestampedLabelResultProcessor::setOutputFilename(const std::string& filename)
+{
+	if(filename.empty())
+	{
+		return;
+	}
+	
+	_output.open(filename);
+	
+	if(!_output.is_open())
+	{
+		throw std::runtime_error("Failed to open output file '" +
+			filename + "' for writing.");
+	}
+}
+
+}
+
+}
+
@@ -0,0 +1,41 @@
+/*	\file   TimestampedLabelResult.h
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The header file for the TimestampedLabelResult class.
+*/
+
+#pragma once
+
+// Minerva Includes
+#include <minerva/results/interface/LabelResult.h>
+
+// Standard Library Includes
+#include <cstddef>
+
+namespace minerva
+{
+
+namespace results
+{
+
+/*! \brief The label assigned to a frame of a stream, along with its timing.  */
+class TimestampedLabelResult : public LabelResult
+{
+public:
+	TimestampedLabelResult(const std::string& label, size_t frame,
+		double timestamp, double latency);
+	
+public:
+	/*! \brief The index of the frame in the stream */
+	size_t frame;
+	/*! \brief The time (seconds) at which the frame was captured */
+	double timestamp;
+	/*! \brief The time (seconds) from frame capture to classification */
+	double latency;
+
+};
+
+}
+
+}
+
@@ -0,0 +1,41 @@
+/*	\file   TimestampedLabelResultProcessor.h
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The header file for the TimestampedLabelResultProcessor class.
+*/
+
+#pragma once
+
+#include <minerva/results/interface/ResultProcessor.h>
+
+// Standard Library Includes
+#include <fstream>
+
+namespace minerva
+{
+
+namespace results
+{
+
+/*! \brief A class for emitting the labels of a stream as they are produced. */
+class TimestampedLabelResultProcessor : public ResultProcessor
+{
+public:
+	virtual ~TimestampedLabelResultProcessor();
+
+public:
+	/*! \brief Process a batch of results */
+	virtual void process(const ResultVector& );
+
+public:
+	virtual void setOutputFilename(const std::string& filename);
+
+private:
+	std::ofstream _output;
+
+};
+
+}
+
+}
+
@@ -0,0 +1,1124 @@
+/*	\file   minerva-benchmark.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The micro, meso, and macro benchmark suite for minerva.
+*/
+
+// Minerva Includes
+#include <minerva/classifiers/interface/EngineFactory.h>
+#include <minerva/classifiers/interface/Engine.h>
+
+#include <minerva/model/interface/ModelBuilder.h>
+#include <minerva/model/interface/Model.h>
+
+#include <minerva/neuralnetwork/interface/NeuralNetwork.h>
+#include <minerva/neuralnetwork/interface/Layer.h>
+
+#include <minerva/matrix/interface/Matrix.h>
+#include <minerva/matrix/interface/BlockSparseMatrix.h>
+#include <minerva/matrix/interface/ActivationFunction.h>
+
+#include <minerva/video/interface/Image.h>
+
+#include <minerva/util/interface/ArgumentParser.h>
+#include <minerva/util/interface/SystemCompatibility.h>
+#include <minerva/util/interface/Timer.h>
+#include <minerva/util/interface/paths.h>
+#include <minerva/util/interface/string.h>
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/json.h>
+
+// Standard Library Includes
+#include <stdexcept>
+#include <functional>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <memory>
+#include <vector>
+#include <map>
+#include <utility>
+
+// System Includes
+#include <cstdlib>
+
+namespace minerva
+{
+
+typedef matrix::Matrix                Matrix;
+typedef matrix::BlockSparseMatrix     BlockSparseMatrix;
+typedef neuralnetwork::Layer          Layer;
+typedef neuralnetwork::NeuralNetwork  NeuralNetwork;
+typedef model::Model                  Model;
+typedef util::StringVector            StringVector;
+
+class BenchmarkResult
+{
+public:
+	BenchmarkResult(const std::string& tier = "", const std::string& name = "")
+	: tier(tier), name(name), iterations(0), seconds(0.0),
+	  floatingPointOperations(0.0), items(0.0), bytes(0.0), skipped(false)
+	{
+
+	}
+
+public:
+	double gigaflops() const
+	{
+		return seconds > 0.0 ? floatingPointOperations / (seconds * 1.0e9) : 0.0;
+	}
+
+	double itemsPerSecond() const
+	{
+		return seconds > 0.0 ? items / seconds : 0.0;
+	}
+
+public:
+	std::string tier;
+	std::string name;
+
+public:
+	size_t iterations;
+	double seconds; // median seconds per iteration
+
+public:
+	// Work done by a single iteration
+	double floatingPointOperations;
+	double items;
+	double bytes;
+
+public:
+	bool        skipped;
+	std::string reason;
+
+};
+
+typedef std::vector<BenchmarkResult> BenchmarkResultVector;
+typedef std::function<void()> Kernel;
+
+/*! \brief Runs benchmarks selected by the options and collects the results */
+class BenchmarkSuite
+{
+public:
+	BenchmarkSuite(const StringVector& tiers, const std::string& filter,
+		double minimumSeconds, size_t maximumIterations)
+	: _tiers(tiers), _filter(filter), _minimumSeconds(minimumSeconds),
+	  _maximumIterations(maximumIterations)
+	{
+
+	}
+
+public:
+	bool isTierSelected(const std::string& tier) const
+	{
+		return std::find(_tiers.begin(), _tiers.end(), tier) != _tiers.end() ||
+			std::find(_tiers.begin(), _tiers.end(), "all") != _tiers.end();
+	}
+
+	bool isSelected(const std::string& tier, const std::string& name) const
+	{
+		return isTierSelected(tier) && (_filter.empty() ||
+			name.find(_filter) != std::string::npos);
+	}
+
+public:
+	/*! \brief Time a kernel, the work is given per call */
+	void run(const std::string& tier, const std::string& name,
+		double floatingPointOperations, double items, double bytes,
+		const Kernel& kernel)
+	{
+		if(!isSelected(tier, name))
+		{
+			return;
+		}
+
+		BenchmarkResult result(tier, name);
+
+		result.floatingPointOperations = floatingPointOperations;
+		result.items                   = items;
+		result.bytes                   = bytes;
+
+		std::cout << " " << std::left << std::setw(48) << name << std::flush;
+
+		try
+		{
+			// warm up caches and lazily created state
+			kernel();
+
+			std::vector<double> samples;
+
+			double total = 0.0;
+
+			while(samples.size() < _maximumIterations &&
+				(total < _minimumSeconds || samples.size() < 3))
+			{
+				util::Timer timer;
+
+				timer.start();
+
+				kernel();
+
+				timer.stop();
+
+				samples.push_back(timer.seconds());
+				total += timer.seconds();
+			}
+
+			std::sort(samples.begin(), samples.end());
+
+			result.iterations = samples.size();
+			result.seconds    = samples[samples.size() / 2];
+
+			std::cout << std::right << std::setw(14) << std::scientific
+				<< std::setprecision(3) << result.seconds << " s";
+
+			if(result.floatingPointOperations > 0.0)
+			{
+				std::cout << std::setw(10) << std::fixed << std::setprecision(2)
+					<< result.gigaflops() << " GFLOP/s";
+			}
+
+			std::cout << "\n";
+		}
+		catch(const std::exception& e)
+		{
+			skip(result, e.what());
+			return;
+		}
+
+		_results.push_back(result);
+	}
+
+	/*! \brief Record that a benchmark could not be run */
+	void skip(const std::string& tier, const std::string& name,
+		const std::string& reason)
+	{
+		if(!isSelected(tier, name))
+		{
+			return;
+		}
+
+		std::cout << " " << std::left << std::setw(48) << name;
+
+		skip(BenchmarkResult(tier, name), reason);
+	}
+
+public:
+	const BenchmarkResultVector& results() const
+	{
+		return _results;
+	}
+
+private:
+	void skip(BenchmarkResult result, const std::string& reason)
+	{
+		result.skipped = true;
+		result.reason  = reason;
+
+		std::cout << " skipped (" << reason << ")\n";
+
+		_results.push_back(result);
+	}
+
+private:
+	StringVector _tiers;
+	std::string  _filter;
+	double       _minimumSeconds;
+	size_t       _maximumIterations;
+
+private:
+	BenchmarkResultVector _results;
+
+};
+
+static Matrix createRandomMatrix(size_t rows, size_t columns,
+	std::default_random_engine& engine)
+{
+	Matrix matrix(rows, columns);
+
+	matrix.assignUniformRandomValues(engine, 0.0f, 1.0f);
+
+	return matrix;
+}
+
+static BlockSparseMatrix createRandomBlockSparseMatrix(size_t blocks,
+	size_t rows, size_t columns, bool rowSparse,
+	std::default_random_engine& engine)
+{
+	BlockSparseMatrix matrix(blocks, rows, columns, rowSparse);
+
+	matrix.assignUniformRandomValues(engine, 0.0f, 1.0f);
+
+	return matrix;
+}
+
+static std::string shapeName(const std::string& prefix, size_t m, size_t n,
+	size_t k)
+{
+	std::stringstream stream;
+
+	stream << prefix << "-" << m << "x" << n << "x" << k;
+
+	return stream.str();
+}
+
+static void runGemmBenchmarks(BenchmarkSuite& suite,
+	std::default_random_engine& engine)
+{
+	// (m, n, k) - square, skinny, and fat shapes seen in the fully connected
+	//  and convolutional layers
+	const size_t shapes[][3] = {
+		{  64,   64,   64},
+		{ 128,  128,  128},
+		{ 256,  256,  256},
+		{ 512,  512,  512},
+		{   1, 1024, 1024},
+		{ 128, 1024,   64},
+		{1024,   64,  128},
+		{ 128,   64, 1024}
+	};
+
+	for(auto& shape : shapes)
+	{
+		size_t m = shape[0];
+		size_t n = shape[1];
+		size_t k = shape[2];
+
+		auto name = shapeName("matrix/gemm", m, n, k);
+
+		if(!suite.isSelected("micro", name))
+		{
+			continue;
+		}
+
+		auto left  = createRandomMatrix(m, k, engine);
+		auto right = createRandomMatrix(k, n, engine);
+
+		suite.run("micro", name, 2.0 * m * n * k, 0.0,
+			sizeof(float) * (m * k + k * n + m * n),
+			[&]()
+			{
+				auto result = left.multiply(right);
+			});
+	}
+}
+
+static void runBlockSparseBenchmarks(BenchmarkSuite& suite,
+	std::default_random_engine& engine)
+{
+	const size_t blocks  = 16;
+	const size_t rows    = 128;
+	const size_t columns = 64;
+
+	auto left  = createRandomBlockSparseMatrix(blocks, rows, columns, true, engine);
+	auto right = createRandomBlockSparseMatrix(blocks, columns, columns, false, engine);
+
+	double elements = blocks * rows * columns;
+
+	suite.run("micro", "block-sparse/multiply",
+		2.0 * blocks * rows * columns * columns, 0.0,
+		sizeof(float) * (elements * 2 + blocks * columns * columns),
+		[&]()
+		{
+			auto result = left.multiply(right);
+		});
+
+	suite.run("micro", "block-sparse/add", elements, elements,
+		3 * sizeof(float) * elements,
+		[&]()
+		{
+			auto result = left.add(left);
+		});
+
+	suite.run("micro", "block-sparse/transpose", 0.0, elements,
+		2 * sizeof(float) * elements,
+		[&]()
+		{
+			auto result = left.transpose();
+		});
+
+	suite.run("micro", "block-sparse/reduce-sum-along-columns", elements,
+		elements, sizeof(float) * elements,
+		[&]()
+		{
+			auto result = left.reduceSumAlongColumns();
+		});
+}
+
+static void runConvolutionalBenchmarks(BenchmarkSuite& suite,
+	std::default_random_engine& engine)
+{
+	const size_t samples   = 128;
+	const size_t blocks    = 16;
+	const size_t blockSize = 64;
+
+	auto input   = createRandomBlockSparseMatrix(1, samples,
+		blocks * blockSize, false, engine);
+	auto weights = createRandomBlockSparseMatrix(blocks, blockSize,
+		blockSize, true, engine);
+
+	if(suite.isSelected("micro", "convolution/forward"))
+	{
+		auto output = input.convolutionalMultiply(weights, blockSize);
+
+		suite.run("micro", "convolution/forward",
+			2.0 * output.rows() * output.columns() * blockSize, samples,
+			sizeof(float) * (input.size() + weights.size() + output.size()),
+			[&]()
+			{
+				auto result = input.convolutionalMultiply(weights, blockSize);
+			});
+	}
+
+	if(suite.isSelected("micro", "convolution/reverse"))
+	{
+		auto delta = input.convolutionalMultiply(weights, blockSize);
+		auto transposedWeights = weights.transpose();
+
+		auto output = delta.reverseConvolutionalMultiply(transposedWeights);
+
+		suite.run("micro", "convolution/reverse",
+			2.0 * output.rows() * output.columns() * blockSize, samples,
+			sizeof(float) * (delta.size() + weights.size() + output.size()),
+			[&]()
+			{
+				auto result = delta.reverseConvolutionalMultiply(
+					transposedWeights);
+			});
+	}
+}
+
+static void runTranscendentalBenchmarks(BenchmarkSuite& suite,
+	std::default_random_engine& engine)
+{
+	const size_t rows    = 256;
+	const size_t columns = 1024;
+
+	// keep the inputs positive so that log stays in its domain
+	auto input = createRandomMatrix(rows, columns, engine).add(0.5f);
+
+	double elements = rows * columns;
+	double bytes    = 2 * sizeof(float) * elements;
+
+	suite.run("micro", "transcendental/sigmoid", elements, elements, bytes,
+		[&]()
+		{
+			auto result = input.sigmoid();
+		});
+
+	suite.run("micro", "transcendental/sigmoid-derivative", elements,
+		elements, bytes,
+		[&]()
+		{
+			auto result = input.sigmoidDerivative();
+		});
+
+	suite.run("micro", "transcendental/log", elements, elements, bytes,
+		[&]()
+		{
+			auto result = input.log();
+		});
+
+	suite.run("micro", "transcendental/kl-divergence", elements, elements,
+		bytes,
+		[&]()
+		{
+			auto result = input.klDivergence(0.1f);
+		});
+}
+
+static void runActivationBenchmarks(BenchmarkSuite& suite,
+	std::default_random_engine& engine)
+{
+	const size_t blocks  = 16;
+	const size_t rows    = 256;
+	const size_t columns = 64;
+
+	typedef matrix::ActivationFunction ActivationFunction;
+
+	const std::pair<std::string, ActivationFunction::Type> activations[] =
+	{
+		{"sigmoid",      ActivationFunction::Sigmoid},
+		{"relu",         ActivationFunction::RectifiedLinear},
+		{"leaky-relu",   ActivationFunction::LeakyRectifiedLinear},
+		{"hard-sigmoid", ActivationFunction::HardSigmoid},
+		{"tanh",         ActivationFunction::Tanh}
+	};
+
+	auto output = createRandomBlockSparseMatrix(blocks, rows, columns, false,
+		engine);
+	auto bias   = createRandomBlockSparseMatrix(blocks, 1, columns, false,
+		engine);
+
+	double elements = output.size();
+	double bytes    = 2 * sizeof(float) * elements;
+
+	for(auto& activation : activations)
+	{
+		// the bias add, activation, and derivative in one pass
+		suite.run("micro", "activation/" + activation.first, elements, elements,
+			3 * sizeof(float) * elements,
+			[&]()
+			{
+				auto result = output;
+				BlockSparseMatrix derivative;
+
+				result.addBiasAndActivateSelf(bias, activation.second, derivative);
+			});
+
+		suite.run("micro", "activation/" + activation.first + "-derivative",
+			elements, elements, bytes,
+			[&]()
+			{
+				auto result = output;
+				result.activationDerivativeSelf(activation.second);
+			});
+	}
+}
+
+static void runAllocatorBenchmarks(BenchmarkSuite& suite)
+{
+	const size_t allocations = 64;
+
+	const size_t sizes[] = {16, 256, 1024};
+
+	for(auto size : sizes)
+	{
+		std::stringstream name;
+
+		name << "allocator/matrix-" << size << "x" << size;
+
+		suite.run("micro", name.str(), 0.0, allocations,
+			allocations * size * size * sizeof(float),
+			[&]()
+			{
+				for(size_t i = 0; i < allocations; ++i)
+				{
+					Matrix matrix(size, size);
+				}
+			});
+	}
+}
+
+/*! \brief A header shaped like model.json for a deep, many-block model */
+static std::string createSyntheticModelHeader(size_t layers, size_t blocks)
+{
+	std::stringstream header;
+
+	header << "{\n\t\"xPixels\": 32, \"yPixels\": 32, \"colors\": 3,\n"
+		<< "\t\"neuralnetworks\": [ {\n\t\t\"name\": \"FeatureSelector\",\n"
+		<< "\t\t\"costFunction\": \"sparse\",\n\t\t\"layers\": [\n";
+
+	for(size_t layer = 0; layer < layers; ++layer)
+	{
+		header << (layer == 0 ? "" : ",\n") << "\t\t\t{ \"step\": 1, \"weights\": [";
+
+		for(size_t block = 0; block < blocks; ++block)
+		{
+			header << (block == 0 ? "" : ", ") << "\"layer" << layer
+				<< "-weights-" << block << "\"";
+		}
+
+		header << "], \"biases\": [";
+
+		for(size_t block = 0; block < blocks; ++block)
+		{
+			header << (block == 0 ? "" : ", ") << "\"layer" << layer
+				<< "-bias-" << block << "\"";
+		}
+
+		header << "] }";
+	}
+
+	header << "\n\t\t],\n\t\t\"output-names\": [\"a\", \"b\"]\n\t} ]\n}\n";
+
+	return header.str();
+}
+
+static void runJsonBenchmarks(BenchmarkSuite& suite)
+{
+	auto header = createSyntheticModelHeader(64, 256);
+
+	suite.run("micro", "json/document", 0.0, header.size(), header.size(),
+		[&]()
+		{
+			util::json::Document document;
+
+			document.parse(header);
+		});
+
+	suite.run("micro", "json/stream-parser", 0.0, header.size(),
+		header.size(),
+		[&]()
+		{
+			std::stringstream stream(header);
+
+			util::json::Parser parser;
+
+			std::unique_ptr<util::json::Object> object(
+				parser.parse_object(stream));
+		});
+}
+
+static void runMicrobenchmarks(BenchmarkSuite& suite,
+	std::default_random_engine& engine)
+{
+	if(!suite.isTierSelected("micro"))
+	{
+		return;
+	}
+
+	std::cout << "Microbenchmarks:\n";
+
+	runGemmBenchmarks(suite, engine);
+	runBlockSparseBenchmarks(suite, engine);
+	runConvolutionalBenchmarks(suite, engine);
+	runTranscendentalBenchmarks(suite, engine);
+	runActivationBenchmarks(suite, engine);
+	runAllocatorBenchmarks(suite);
+	runJsonBenchmarks(suite);
+}
+
+static void runLayerBenchmarks(BenchmarkSuite& suite,
+	std::default_random_engine& engine)
+{
+	const size_t samples   = 128;
+	const size_t blocks    = 16;
+	const size_t blockSize = 64;
+
+	Layer layer(blocks, blockSize, blockSize);
+
+	layer.initializeRandomly(engine);
+
+	auto input = createRandomBlockSparseMatrix(1, samples,
+		layer.getInputCount(), false, engine);
+
+	auto output = layer.runInputs(input);
+
+	double forwardFlops = 2.0 * output.rows() * output.columns() *
+		layer.getInputBlockingFactor();
+
+	suite.run("meso", "layer/forward", forwardFlops, samples,
+		sizeof(float) * (input.size() + layer.size() + output.size()),
+		[&]()
+		{
+			auto result = layer.runInputs(input);
+		});
+
+	suite.run("meso", "layer/backward", forwardFlops, samples,
+		sizeof(float) * (input.size() + layer.size() + output.size()),
+		[&]()
+		{
+			auto result = layer.runReverse(output, input);
+		});
+}
+
+static NeuralNetwork createFullyConnectedNetwork(size_t inputs,
+	size_t hidden, size_t outputs, std::default_random_engine& engine)
+{
+	NeuralNetwork network;
+
+	network.addLayer(Layer(1, inputs, hidden));
+	network.addLayer(Layer(1, hidden, outputs));
+
+	network.initializeRandomly(engine);
+
+	return network;
+}
+
+static double getForwardFlops(const NeuralNetwork& network, size_t samples)
+{
+	return 2.0 * samples * network.totalConnections();
+}
+
+static void runNetworkBenchmarks(BenchmarkSuite& suite,
+	std::default_random_engine& engine)
+{
+	const size_t samples = 128;
+
+	auto network = createFullyConnectedNetwork(1024, 256, 16, engine);
+
+	auto input     = createRandomMatrix(samples, network.getInputCount(), engine);
+	auto reference = createRandomMatrix(samples, network.getOutputCount(), engine);
+
+	suite.run("meso", "network/forward", getForwardFlops(network, samples),
+		samples, sizeof(float) * (input.size() + network.totalConnections()),
+		[&]()
+		{
+			auto result = network.runInputs(input);
+		});
+
+	// a single solver iteration, forward and back propagation are about
+	//  three times the work of the forward pass, each line search probe
+	//  does it again
+	util::KnobDatabase::setKnob("LBFGSSolver::MaxIterations", "1");
+	util::KnobDatabase::setKnob("GradientDescentSolver::Iterations", "1");
+
+	const char* solvers[][2] = {
+		{"solver/lbfgs-iteration",            "LBFGSSolver"},
+		{"solver/gradient-descent-iteration", "GradientDescentSolver"}
+	};
+
+	// the line searches make full solves expensive, keep the network small
+	auto smallNetwork = createFullyConnectedNetwork(256, 64, 16, engine);
+
+	auto smallInput = createRandomMatrix(samples,
+		smallNetwork.getInputCount(), engine);
+	auto smallReference = createRandomMatrix(samples,
+		smallNetwork.getOutputCount(), engine);
+
+	for(auto& solver : solvers)
+	{
+		util::KnobDatabase::setKnob("GeneralDifferentiableSolver::Type",
+			solver[1]);
+
+		auto trained = smallNetwork;
+
+		suite.run("meso", solver[0],
+			3.0 * getForwardFlops(smallNetwork, samples), samples,
+			sizeof(float) * (smallInput.size() + smallReference.size() +
+			3 * smallNetwork.totalConnections()),
+			[&]()
+			{
+				trained.train(smallInput, smallReference);
+			});
+	}
+}
+
+static void runMesobenchmarks(BenchmarkSuite& suite,
+	std::default_random_engine& engine)
+{
+	if(!suite.isTierSelected("meso"))
+	{
+		return;
+	}
+
+	std::cout << "Mesobenchmarks:\n";
+
+	runLayerBenchmarks(suite, engine);
+	runNetworkBenchmarks(suite, engine);
+}
+
+static std::string toString(size_t value)
+{
+	std::stringstream stream;
+
+	stream << value;
+
+	return stream.str();
+}
+
+/*! \brief Write two classes of images (bright and dark noise) and a database
+	file that lists them, returning the path to the database. */
+static std::string createSyntheticImageDatabase(const std::string& directory,
+	size_t images, size_t xPixels, size_t yPixels, size_t colors,
+	std::default_random_engine& engine)
+{
+	auto databasePath = util::joinPaths(directory, "database.txt");
+
+	std::ofstream database(databasePath);
+
+	if(!database.good())
+	{
+		throw std::runtime_error("Could not open '" + databasePath +
+			"' for writing.");
+	}
+
+	database << "labels: bright, dark\n";
+
+	std::uniform_int_distribution<int> distribution(0, 127);
+
+	for(size_t i = 0; i < images; ++i)
+	{
+		bool bright = (i % 2) == 0;
+
+		std::string label = bright ? "bright" : "dark";
+		std::string name  = "image-" + toString(i) + ".png";
+
+		video::Image::ByteVector pixels(xPixels * yPixels * colors);
+
+		for(auto& pixel : pixels)
+		{
+			pixel = distribution(engine) + (bright ? 128 : 0);
+		}
+
+		video::Image image(xPixels, yPixels, colors, 1,
+			util::joinPaths(directory, name), label, pixels);
+
+		image.save();
+
+		database << name << ", " << label << "\n";
+	}
+
+	return databasePath;
+}
+
+static void runEngine(const std::string& engineName, const Model& model,
+	const std::string& databasePath)
+{
+	std::unique_ptr<classifiers::Engine> engine(
+		classifiers::EngineFactory::create(engineName));
+
+	if(!engine)
+	{
+		throw std::runtime_error("Failed to create " + engineName + ".");
+	}
+
+	engine->setModel(new Model(model));
+
+	engine->runOnDatabaseFile(databasePath);
+}
+
+static void runMacrobenchmarks(BenchmarkSuite& suite,
+	const std::string& scratchDirectory, size_t images, size_t batchSize,
+	std::default_random_engine& engine)
+{
+	if(!suite.isTierSelected("macro"))
+	{
+		return;
+	}
+
+	std::cout << "Macrobenchmarks:\n";
+
+	const size_t xPixels = 32;
+	const size_t yPixels = 32;
+	const size_t colors  = 3;
+
+	std::string directoryTemplate = util::joinPaths(scratchDirectory,
+		"minerva-benchmark-XXXXXX");
+
+	if(mkdtemp(&directoryTemplate[0]) == nullptr)
+	{
+		suite.skip("macro", "engine/learner", "could not create a directory in '" +
+			scratchDirectory + "'");
+		suite.skip("macro", "engine/classifier", "could not create a directory in '" +
+			scratchDirectory + "'");
+		return;
+	}
+
+	auto directory = directoryTemplate;
+
+	std::string databasePath;
+
+	try
+	{
+		databasePath = createSyntheticImageDatabase(directory, images,
+			xPixels, yPixels, colors, engine);
+	}
+	catch(const std::exception& e)
+	{
+		std::string reason = "could not write synthetic images: ";
+
+		suite.skip("macro", "engine/learner",    reason + e.what());
+		suite.skip("macro", "engine/classifier", reason + e.what());
+		return;
+	}
+
+	util::KnobDatabase::setKnob("ModelBuilder::ResolutionX", toString(xPixels));
+	util::KnobDatabase::setKnob("ModelBuilder::ResolutionY", toString(yPixels));
+	util::KnobDatabase::setKnob("ModelBuilder::ColorComponents", toString(colors));
+	util::KnobDatabase::setKnob("Classifier::NeuralNetwork::Outputs", "2");
+
+	util::KnobDatabase::setKnob("InputDataProducer::BatchSize", toString(batchSize));
+	util::KnobDatabase::setKnob("InputDataProducer::MaximumSamplesToRun",
+		toString(images));
+
+	util::KnobDatabase::setKnob("GeneralDifferentiableSolver::Type", "LBFGSSolver");
+	util::KnobDatabase::setKnob("LBFGSSolver::MaxIterations", "5");
+
+	model::ModelBuilder builder;
+
+	std::unique_ptr<Model> model(builder.create(
+		util::joinPaths(directory, "model.tgz")));
+
+	auto& classifier = model->getNeuralNetwork("Classifier");
+
+	classifier.setLabelForOutputNeuron(0, "bright");
+	classifier.setLabelForOutputNeuron(1, "dark");
+
+	suite.run("macro", "engine/learner", 0.0, images, 0.0,
+		[&]()
+		{
+			runEngine("LearnerEngine", *model, databasePath);
+		});
+
+	suite.run("macro", "engine/classifier", 0.0, images, 0.0,
+		[&]()
+		{
+			runEngine("ClassifierEngine", *model, databasePath);
+		});
+}
+
+static std::string escapeString(const std::string& string)
+{
+	std::string result;
+
+	for(auto character : string)
+	{
+		if(character == '"' || character == '\\')
+		{
+			result.push_back('\\');
+		}
+		else if(character == '\n')
+		{
+			character = ' ';
+		}
+
+		result.push_back(character);
+	}
+
+	return result;
+}
+
+static void writeResults(std::ostream& stream,
+	const BenchmarkResultVector& results)
+{
+	stream << "{\n";
+	stream << "\t\"hardware\": {\n";
+	stream << "\t\t\"hardware-threads\": " << util::getHardwareThreadCount() << ",\n";
+	stream << "\t\t\"machine-flops\": " << util::getMachineFlops() << ",\n";
+	stream << "\t\t\"clock-speed\": " << util::getMaxClockSpeed() << ",\n";
+	stream << "\t\t\"free-memory\": " << util::getFreePhysicalMemory() << ",\n";
+	stream << "\t\t\"compiler\": \"" << __VERSION__ << "\"\n";
+	stream << "\t},\n";
+	stream << "\t\"benchmarks\": [\n";
+
+	for(auto result = results.begin(); result != results.end(); ++result)
+	{
+		stream << std::scientific << std::setprecision(6);
+
+		stream << "\t\t{\"name\": \"" << result->name << "\", \"tier\": \""
+			<< result->tier << "\", ";
+
+		if(result->skipped)
+		{
+			stream << "\"skipped\": true, \"reason\": \""
+				<< escapeString(result->reason) << "\"}";
+		}
+		else
+		{
+			stream << "\"skipped\": false"
+				<< ", \"iterations\": " << result->iterations
+				<< ", \"seconds\": " << result->seconds
+				<< ", \"gflops\": " << result->gigaflops()
+				<< ", \"items-per-second\": " << result->itemsPerSecond()
+				<< ", \"bytes\": " << result->bytes << "}";
+		}
+
+		if(result + 1 != results.end())
+		{
+			stream << ",";
+		}
+
+		stream << "\n";
+	}
+
+	stream << "\t]\n";
+	stream << "}\n";
+}
+
+typedef std::map<std::string, double> BaselineMap;
+
+static BaselineMap loadBaseline(const std::string& path)
+{
+	util::json::Document document;
+
+	util::json::Visitor visitor(document.load(path));
+	util::json::Visitor benchmarks(visitor["benchmarks"]);
+
+	BaselineMap baseline;
+
+	for(auto benchmark = benchmarks.begin_array();
+		benchmark != benchmarks.end_array(); ++benchmark)
+	{
+		util::json::Visitor benchmarkVisitor(*benchmark);
+
+		if((bool)benchmarkVisitor["skipped"])
+		{
+			continue;
+		}
+
+		baseline[(std::string)benchmarkVisitor["name"]] =
+			(double)benchmarkVisitor["seconds"];
+	}
+
+	return baseline;
+}
+
+/*! \brief Compare against the baseline, returns the number of regressions */
+static size_t compareToBaseline(const BenchmarkResultVector& results,
+	const std::string& baselinePath, double threshold)
+{
+	auto baseline = loadBaseline(baselinePath);
+
+	std::cout << "Comparison against baseline '" << baselinePath
+		<< "' (regression threshold " << (threshold * 100.0) << "%):\n";
+
+	size_t regressions = 0;
+
+	for(auto& result : results)
+	{
+		if(result.skipped)
+		{
+			continue;
+		}
+
+		std::cout << " " << std::left << std::setw(48) << result.name;
+
+		auto reference = baseline.find(result.name);
+
+		if(reference == baseline.end() || reference->second <= 0.0)
+		{
+			std::cout << " new\n";
+			continue;
+		}
+
+		double change = result.seconds / reference->second - 1.0;
+
+		std::cout << std::right << std::showpos << std::fixed
+			<< std::setprecision(1) << std::setw(9) << (change * 100.0)
+			<< std::noshowpos << "%";
+
+		if(change > threshold)
+		{
+			std::cout << "  REGRESSION";
+			++regressions;
+		}
+
+		std::cout << "\n";
+	}
+
+	return regressions;
+}
+
+static size_t runBenchmarks(const std::string& tiers,
+	const std::string& filter, const std::string& outputPath,
+	const std::string& baselinePath, double threshold, double minimumSeconds,
+	size_t maximumIterations, const std::string& scratchDirectory,
+	size_t images, size_t batchSize)
+{
+	BenchmarkSuite suite(util::split(tiers, ","), filter, minimumSeconds,
+		maximumIterations);
+
+	std::default_random_engine engine(1);
+
+	runMicrobenchmarks(suite, engine);
+	runMesobenchmarks(suite, engine);
+	runMacrobenchmarks(suite, scratchDirectory, images, batchSize, engine);
+
+	if(!outputPath.empty())
+	{
+		std::ofstream stream(outputPath);
+
+		if(!stream.good())
+		{
+			throw std::runtime_error("Could not open '" + outputPath +
+				"' for writing.");
+		}
+
+		writeResults(stream, suite.results());
+	}
+	else
+	{
+		writeResults(std::cout, suite.results());
+	}
+
+	if(baselinePath.empty())
+	{
+		return 0;
+	}
+
+	return compareToBaseline(suite.results(), baselinePath, threshold);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+
+	std::string tiers;
+	std::string filter;
+	std::string outputPath;
+	std::string baselinePath;
+	std::string scratchDirectory;
+	std::string loggingEnabledModules;
+
+	double threshold      = 0.0;
+	double minimumSeconds = 0.0;
+
+	size_t maximumIterations = 0;
+	size_t images            = 0;
+	size_t batchSize         = 0;
+
+	bool verbose = false;
+
+	parser.description("The Minerva benchmark suite.");
+
+	parser.parse("-t", "--tiers", tiers, "micro,meso,macro",
+		"A comma-separated list of benchmark tiers to run "
+		"(micro, meso, macro, or all).");
+	parser.parse("-f", "--filter", filter, "",
+		"Only run benchmarks with names containing this string.");
+	parser.parse("-o", "--output", outputPath, "",
+		"Write the JSON results to this file rather than stdout.");
+	parser.parse("-B", "--baseline", baselinePath, "",
+		"Compare against results from a previous run, fail on regressions.");
+	parser.parse("-r", "--regression-threshold", threshold, 0.10,
+		"The relative slowdown over the baseline that is a regression.");
+	parser.parse("-m", "--minimum-seconds", minimumSeconds, 0.25,
+		"Repeat each benchmark for at least this many seconds.");
+	parser.parse("-i", "--maximum-iterations", maximumIterations, 1000,
+		"Repeat each benchmark at most this many times.");
+	parser.parse("-d", "--scratch-directory", scratchDirectory, "/tmp",
+		"Where to generate synthetic databases for the macrobenchmarks.");
+	parser.parse("-n", "--images", images, 64,
+		"The number of synthetic images for the macrobenchmarks.");
+	parser.parse("-b", "--batch-size", batchSize, 32,
+		"The batch size for the macrobenchmarks.");
+	parser.parse("-L", "--log-module", loggingEnabledModules, "",
+		"Print out log messages during execution for specified modules "
+		"(comma-separated list of modules, e.g. NeuralNetwork, Layer, ...).");
+	parser.parse("-v", "--verbose", verbose, false,
+		"Print out log messages during execution");
+
+	parser.parse();
+
+	if(verbose)
+	{
+		minerva::util::enableAllLogs();
+	}
+	else
+	{
+		minerva::util::enableSpecificLogs(loggingEnabledModules);
+	}
+
+	try
+	{
+		size_t regressions = minerva::runBenchmarks(tiers, filter, outputPath,
+			baselinePath, threshold, minimumSeconds, maximumIterations,
+			scratchDirectory, images, batchSize);
+
+		if(regressions > 0)
+		{
+			std::cout << "Benchmark Failed: " << regressions
+				<< " regressions over the baseline\n";
+
+			return 1;
+		}
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Benchmark Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+
+		return 1;
+	}
+
+	return 0;
+}
+
@@ -7,6 +7,8 @@
 // Minerva Includes
 #include <minerva/classifiers/interface/EngineFactory.h>
 #include <minerva/classifiers/interface/Engine.h>
+#include <minerva/classifiers/interface/StreamingClassifierEngine.h>
+#include <minerva/classifiers/interface/ClassifierServer.h>
 
 #include <minerva/model/interface/ModelBuilder.h>
 #include <minerva/model/interface/Model.h>
@@ -33,12 +35,12 @@ static void setOptions(const std::string& options);
 static void checkInputs(const std::string& inputFileNames,
 	const std::string& modelFileName, bool& shouldClassify,
 	bool& shouldTrain, bool& shouldLearnFeatures,
-	bool& shouldExtractFeatures);
+	bool& shouldExtractFeatures, bool& shouldPrune, bool& shouldQuantize);
 
 static classifiers::Engine* createEngine(
 	const std::string& outputFilename, bool shouldClassify,
 	bool shouldTrain, bool shouldLearnFeatures,
-	bool shouldExtractFeatures);
+	bool shouldExtractFeatures, bool shouldPrune, bool shouldQuantize);
 
 static std::string loadFile(const std::string& path);
 
@@ -88,9 +90,47 @@ static void visualizeNeurons(const std::string& modelFileName,
 	image.save();
 }
 
+static void runStreamingClassifier(const std::string& outputFilename,
+	const std::string& inputStream, const std::string& modelFileName)
+{
+	util::log("minerva-classifier") << "Loading streaming classifier.\n";
+
+	std::unique_ptr<classifiers::Engine> engine(
+		classifiers::EngineFactory::create("StreamingClassifierEngine"));
+	
+	if(!engine)
+	{
+		throw std::runtime_error("Failed to create streaming classifier engine.");
+	}
+	
+	engine->setOutputFilename(outputFilename);
+	engine->loadModel(modelFileName);
+	
+	static_cast<classifiers::StreamingClassifierEngine*>(
+		engine.get())->runOnVideoStream(inputStream);
+}
+
+static void runClassifierServer(const std::string& modelFileName, size_t port)
+{
+	util::log("minerva-classifier") << "Loading classifier server.\n";
+
+	std::unique_ptr<classifiers::Engine> engine(
+		classifiers::EngineFactory::create("ClassifierServer"));
+	
+	if(!engine)
+	{
+		throw std::runtime_error("Failed to create classifier server.");
+	}
+	
+	engine->loadModel(modelFileName);
+	
+	static_cast<classifiers::ClassifierServer*>(engine.get())->serve(port);
+}
+
 static void runClassifier(const std::string& outputFilename,
 	const std::string& inputFileNames, const std::string& modelFileName,
-	bool shouldClassify, bool shouldTrain, bool shouldLearnFeatures, bool shouldExtractFeatures)
+	bool shouldClassify, bool shouldTrain, bool shouldLearnFeatures, bool shouldExtractFeatures,
+	bool shouldPrune, bool shouldQuantize)
 {
 	util::log("minerva-classifier") << "Loading classifier.\n";
 
@@ -99,10 +139,12 @@ static void runClassifier(const std::string& outputFilename,
 	try
 	{
 		checkInputs(inputFileNames, modelFileName, shouldClassify,
-			shouldTrain, shouldLearnFeatures, shouldExtractFeatures);
+			shouldTrain, shouldLearnFeatures, shouldExtractFeatures, shouldPrune,
+			shouldQuantize);
 	
 		engine = createEngine(outputFilename, shouldClassify, shouldTrain,
-			shouldLearnFeatures, shouldExtractFeatures);
+			shouldLearnFeatures, shouldExtractFeatures, shouldPrune,
+			shouldQuantize);
 		
 		if(engine == nullptr)
 		{
@@ -141,12 +183,33 @@ static void setOptions(const std::string& options)
 	
 		util::KnobDatabase::addKnob(keyAndValue[0], keyAndValue[1]);
 	}
+
+	// knobs read lazily are not known yet, so only flag likely typos here
+	for(auto& knob : util::KnobDatabase::getUnrecognizedKnobs())
+	{
+		if(knob.second.empty())
+		{
+			continue;
+		}
+
+		std::cout << "Warning: unknown knob '" << knob.first
+			<< "', did you mean '" << knob.second << "'?\n";
+	}
+}
+
+static void warnAboutUnusedKnobs()
+{
+	for(auto& knob : util::KnobDatabase::getUnrecognizedKnobs())
+	{
+		std::cout << "Warning: knob '" << knob.first
+			<< "' was set but never used.\n";
+	}
 }
 
 static void checkInputs(const std::string& inputFileNames,
 	const std::string& modelFileName, bool& shouldClassify,
 	bool& shouldTrain, bool& shouldLearnFeatures,
-	bool& shouldExtractFeatures)
+	bool& shouldExtractFeatures, bool& shouldPrune, bool& shouldQuantize)
 {
 	unsigned int count = 0;
 	
@@ -154,6 +217,8 @@ static void checkInputs(const std::string& inputFileNames,
 	if(shouldTrain)           count += 1;
 	if(shouldLearnFeatures)   count += 1;
 	if(shouldExtractFeatures) count += 1;
+	if(shouldPrune)           count += 1;
+	if(shouldQuantize)        count += 1;
 	
 	if(count == 0)
 	{
@@ -163,13 +228,15 @@ static void checkInputs(const std::string& inputFileNames,
 	if(count > 1)
 	{
 		throw std::runtime_error("Only one operation "
-			"(learn, classify, or train) can be specified at a time.");
+			"(learn, classify, train, prune, or quantize) can be specified "
+			"at a time.");
 	}
 }
 
 static classifiers::Engine* createEngine(
 	const std::string& outputFilename, bool shouldClassify,
-	bool shouldTrain, bool shouldLearnFeatures, bool shouldExtractFeatures)
+	bool shouldTrain, bool shouldLearnFeatures, bool shouldExtractFeatures,
+	bool shouldPrune, bool shouldQuantize)
 {
 	classifiers::Engine* engine = nullptr;
 	
@@ -181,6 +248,14 @@ static classifiers::Engine* createEngine(
 	{
 		engine = classifiers::EngineFactory::create("UnsupervisedLearnerEngine");
 	}
+	else if(shouldPrune)
+	{
+		engine = classifiers::EngineFactory::create("PrunerEngine");
+	}
+	else if(shouldQuantize)
+	{
+		engine = classifiers::EngineFactory::create("QuantizerEngine");
+	}
 	else if(shouldExtractFeatures)
 	{
 		engine = classifiers::EngineFactory::create("FeatureExtractorEngine");
@@ -239,11 +314,12 @@ static std::string toString(size_t value)
 	return stream.str();
 }
 
-static void setupKnobs(size_t maximumSamples, size_t batchSize)
+static void setupKnobs(size_t maximumSamples, size_t batchSize, bool resume,
+	bool pretrainGreedily)
 {
 	if(maximumSamples > 0)
 	{
-		util::KnobDatabase::setKnob("InputDataProducer::MaximumSampleCount",
+		util::KnobDatabase::setKnob("InputDataProducer::MaximumSamplesToRun",
 			toString(maximumSamples));
 	}
 	if(batchSize > 0)
@@ -251,6 +327,15 @@ static void setupKnobs(size_t maximumSamples, size_t batchSize)
 		util::KnobDatabase::setKnob("InputDataProducer::BatchSize",
 			toString(batchSize));
 	}
+	if(resume)
+	{
+		util::KnobDatabase::setKnob("Engine::ResumeFromCheckpoint", "1");
+	}
+	if(pretrainGreedily)
+	{
+		util::KnobDatabase::setKnob(
+			"UnsupervisedLearnerEngine::PretrainGreedily", "1");
+	}
 }
 
 }
@@ -269,11 +354,18 @@ int main(int argc, char** argv)
 	bool shouldTrain           = false;
 	bool shouldLearnFeatures   = false;
 	bool shouldExtractFeatures = false;
+	bool shouldPrune           = false;
+	bool shouldQuantize        = false;
 	bool createNewModel        = false;
 	bool visualizeNetwork      = false;
+	bool shouldStream          = false;
+	bool shouldServe           = false;
+	bool shouldResume          = false;
+	bool pretrainGreedily      = false;
 	
 	size_t maximumSamples = 0;
 	size_t batchSize      = 0;
+	size_t port           = 0;
 	
 	std::string loggingEnabledModules;
 	
@@ -300,8 +392,25 @@ int main(int argc, char** argv)
 		"Perform supervised learning and labeled input data.");
 	parser.parse("-l", "--learn", shouldLearnFeatures, false,
 		"Perform unsupervised learning on unlabeled input data.");
+	parser.parse("", "--greedy", pretrainGreedily, false,
+		"Learn features one group of layers at a time over the entire input, "
+		"streaming the features of finished layers from disk.");
+	parser.parse("", "--prune", shouldPrune, false,
+		"Prune small weights and neurons, fine-tune on labeled input data, "
+		"and compact the model.");
+	parser.parse("", "--quantize", shouldQuantize, false,
+		"Calibrate int8 inference on labeled input data, report its accuracy, "
+		"and save the calibration with the model.");
+	parser.parse("", "--resume", shouldResume, false,
+		"Continue training from the newest valid checkpoint of the model.");
 	parser.parse("-V", "--visualize-network", visualizeNetwork, false,
 		"Produce visualization for each neuron.");
+	parser.parse("-r", "--stream", shouldStream, false,
+		"Classify the frames of the input video (file or device) as they arrive.");
+	parser.parse("", "--serve", shouldServe, false,
+		"Serve classification requests (one image path per line) on a local port.");
+	parser.parse("-p", "--port", port, 8080,
+		"The port to serve classification requests on.");
 	parser.parse("", "--options", options, "", 
 		"A comma separated list of options (option_name=option_value, ...).");
 
@@ -319,7 +428,8 @@ int main(int argc, char** argv)
 		"(comma-separated list of modules, e.g. NeuralNetwork, Layer, ...).");
 	parser.parse();
 
-	minerva::setupKnobs(maximumSamples, batchSize);
+	minerva::setupKnobs(maximumSamples, batchSize, shouldResume,
+		pretrainGreedily);
 
 	if(verbose)
 	{
@@ -342,11 +452,20 @@ int main(int argc, char** argv)
 		{
 			minerva::visualizeNeurons(modelFileName, outputPath);
 		}
+		else if(shouldServe)
+		{
+			minerva::runClassifierServer(modelFileName, port);
+		}
+		else if(shouldStream)
+		{
+			minerva::runStreamingClassifier(outputPath, inputFileNames,
+				modelFileName);
+		}
 		else
 		{
 			minerva::runClassifier(outputPath, inputFileNames, modelFileName, 
 				shouldClassify, shouldTrain, shouldLearnFeatures,
-				shouldExtractFeatures);
+				shouldExtractFeatures, shouldPrune, shouldQuantize);
 		}
 	}
 	catch(const std::exception& e)
@@ -355,6 +474,8 @@ int main(int argc, char** argv)
 		std::cout << "Message: " << e.what() << "\n\n";
 	}
 
+	minerva::warnAboutUnusedKnobs();
+
 	return 0;
 
 }
@@ -0,0 +1,194 @@
+/*	\file   minerva-load-generator.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  A load generator for the classifier server.
+*/
+
+// Minerva Includes
+#include <minerva/util/interface/ArgumentParser.h>
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/math.h>
+
+// System Includes
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+// Standard Library Includes
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+namespace minerva
+{
+
+typedef std::chrono::steady_clock Clock;
+
+static int connectToServer(size_t port)
+{
+	int connection = ::socket(AF_INET, SOCK_STREAM, 0);
+	
+	sockaddr_in address;
+	
+	std::memset(&address, 0, sizeof(address));
+	
+	address.sin_family      = AF_INET;
+	address.sin_port        = htons(port);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	
+	if(connection < 0 || ::connect(connection, (sockaddr*)&address, sizeof(address)) != 0)
+	{
+		throw std::runtime_error("Failed to connect to the classifier server.");
+	}
+	
+	return connection;
+}
+
+static std::string request(int connection, const std::string& line)
+{
+	std::string message = line + "\n";
+	
+	if(::send(connection, message.data(), message.size(), 0) != (ssize_t)message.size())
+	{
+		throw std::runtime_error("Failed to send request.");
+	}
+	
+	std::string response;
+	
+	char character = 0;
+	
+	while(::recv(connection, &character, 1, 0) == 1 && character != '\n')
+	{
+		response.push_back(character);
+	}
+	
+	return response;
+}
+
+static void runClient(size_t port, const std::string& imagePath,
+	size_t requests, std::vector<double>& latencies, std::mutex& mutex)
+{
+	std::vector<double> clientLatencies;
+	
+	try
+	{
+		int connection = connectToServer(port);
+		
+		for(size_t i = 0; i < requests; ++i)
+		{
+			auto start = Clock::now();
+			
+			auto label = request(connection, imagePath);
+			
+			clientLatencies.push_back(std::chrono::duration<double>(
+				Clock::now() - start).count());
+			
+			util::log("LoadGenerator") << "Got label '" << label << "'\n";
+		}
+		
+		request(connection, "QUIT");
+		
+		::close(connection);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Client failed: " << e.what() << "\n";
+	}
+	
+	std::unique_lock<std::mutex> lock(mutex);
+	
+	latencies.insert(latencies.end(), clientLatencies.begin(), clientLatencies.end());
+}
+
+static void generateLoad(size_t port, const std::string& imagePath,
+	size_t clients, size_t requestsPerClient)
+{
+	std::vector<double> latencies;
+	std::mutex mutex;
+	
+	auto start = Clock::now();
+	
+	std::vector<std::thread> threads;
+	
+	for(size_t client = 0; client < clients; ++client)
+	{
+		threads.push_back(std::thread(runClient, port, imagePath,
+			requestsPerClient, std::ref(latencies), std::ref(mutex)));
+	}
+	
+	for(auto& thread : threads)
+	{
+		thread.join();
+	}
+	
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	
+	int connection = connectToServer(port);
+	
+	auto statistics = request(connection, "STATS");
+	
+	request(connection, "QUIT");
+	
+	::close(connection);
+	
+	std::cout << "Load Generator Results:\n";
+	std::cout << " Requests:     " << latencies.size() << "\n";
+	std::cout << " Throughput:   " << latencies.size() / seconds << " requests/s\n";
+	std::cout << " p50 latency:  " << util::getPercentile(latencies, 50.0) << " s\n";
+	std::cout << " p99 latency:  " << util::getPercentile(latencies, 99.0) << " s\n";
+	std::cout << " Server stats: " << statistics << "\n";
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+	
+	std::string imagePath;
+	
+	size_t port     = 0;
+	size_t clients  = 0;
+	size_t requests = 0;
+	
+	bool verbose = false;
+
+	parser.description("A load generator for the Minerva classifier server.");
+
+	parser.parse("-i", "--image", imagePath, "",
+		"The path of the image to request a classification for.");
+	parser.parse("-p", "--port", port, 8080,
+		"The port that the classifier server is listening on.");
+	parser.parse("-c", "--clients", clients, 8,
+		"The number of concurrent clients.");
+	parser.parse("-r", "--requests", requests, 100,
+		"The number of requests sent by each client.");
+	parser.parse("-v", "--verbose", verbose, false,
+		"Print out log messages during execution");
+	parser.parse();
+
+	if(verbose)
+	{
+		minerva::util::enableAllLogs();
+	}
+
+	try
+	{
+		minerva::generateLoad(port, imagePath, clients, requests);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Load Generator Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+	}
+
+	return 0;
+}
+
@@ -13,6 +13,9 @@
 // Standard Library Includes
 #include <stdexcept>
 #include <map>
+#include <set>
+#include <mutex>
+#include <algorithm>
 
 namespace minerva
 {
@@ -24,22 +27,56 @@ class KnobDatabaseImplementation
 {
 public:
 	typedef std::map<std::string, std::string> StringMap;
+	typedef std::multimap<std::string, KnobBase*> KnobMap;
+	typedef std::set<std::string> StringSet;
 
 public:
 	KnobDatabaseImplementation();
-	
-private:
+
+public:
 	void loadKnobFiles(); 
 
+public:
+	/*! \brief Re-parse the handles of a knob and run their callbacks */
+	void updateHandles(const std::string& name);
+
 public:
 	StringMap knobs;
+	KnobMap   handles;
+	StringSet lookedUp;
+
+public:
+	bool loaded;
+
+public:
+	// recursive, knob files and change callbacks set knobs while it is held
+	std::recursive_mutex mutex;
 };
 
-static KnobDatabaseImplementation database;
+typedef std::unique_lock<std::recursive_mutex> DatabaseLock;
+
+/*! \brief A function-local static, so that static Knob handles in other
+	translation units can register during static initialization
+*/
+static KnobDatabaseImplementation& getDatabase()
+{
+	static KnobDatabaseImplementation database;
+
+	DatabaseLock lock(database.mutex);
+
+	if(!database.loaded)
+	{
+		database.loaded = true;
+		database.loadKnobFiles();
+	}
+
+	return database;
+}
 
 KnobDatabaseImplementation::KnobDatabaseImplementation()
+: loaded(false)
 {
-	loadKnobFiles();
+
 }
 
 void KnobDatabaseImplementation::loadKnobFiles()
@@ -53,23 +90,85 @@ void KnobDatabaseImplementation::loadKnobFiles()
 	}
 }
 
+void KnobDatabaseImplementation::updateHandles(const std::string& name)
+{
+	auto value = knobs.find(name);
+
+	const std::string* string = value == knobs.end() ? nullptr : &value->second;
+
+	auto range = handles.equal_range(name);
+
+	for(auto handle = range.first; handle != range.second; ++handle)
+	{
+		handle->second->update(string);
+	}
+
+	for(auto handle = range.first; handle != range.second; ++handle)
+	{
+		handle->second->notify();
+	}
+}
+
 void KnobDatabase::addKnob(const std::string& name, const std::string& value)
 {
-	database.knobs[name] = value;
+	setKnob(name, value);
 }
 
 void KnobDatabase::setKnob(const std::string& name, const std::string& value)
 {
+	auto& database = getDatabase();
+
+	DatabaseLock lock(database.mutex);
+
+	auto previous = database.knobs.find(name);
+
+	bool existed = previous != database.knobs.end();
+
+	std::string previousValue = existed ? previous->second : "";
+
 	database.knobs[name] = value;
+
+	try
+	{
+		database.updateHandles(name);
+	}
+	catch(const std::exception&)
+	{
+		// a malformed value leaves the knob as it was
+		if(existed)
+		{
+			database.knobs[name] = previousValue;
+		}
+		else
+		{
+			database.knobs.erase(name);
+		}
+
+		database.updateHandles(name);
+
+		throw;
+	}
 }
 
 bool KnobDatabase::knobExists(const std::string& knobname)
 {
+	auto& database = getDatabase();
+
+	DatabaseLock lock(database.mutex);
+
+	database.lookedUp.insert(knobname);
+
 	return database.knobs.count(knobname) != 0;
 }
 
 std::string KnobDatabase::getKnobValueAsString(const std::string& knobname)
 {
+	auto& database = getDatabase();
+
+	DatabaseLock lock(database.mutex);
+
+	database.lookedUp.insert(knobname);
+
 	auto knob = database.knobs.find(knobname);
 	
 	if(knob == database.knobs.end())
@@ -92,6 +191,156 @@ std::string KnobDatabase::getKnobValue(const std::string& knobname,
 	return getKnobValueAsString(knobname);
 }
 
+static size_t getEditDistance(const std::string& left, const std::string& right)
+{
+	std::vector<size_t> previous(right.size() + 1);
+	std::vector<size_t> current(right.size() + 1);
+
+	for(size_t j = 0; j <= right.size(); ++j)
+	{
+		previous[j] = j;
+	}
+
+	for(size_t i = 1; i <= left.size(); ++i)
+	{
+		current[0] = i;
+
+		for(size_t j = 1; j <= right.size(); ++j)
+		{
+			size_t substitution = previous[j - 1] +
+				(left[i - 1] == right[j - 1] ? 0 : 1);
+
+			current[j] = std::min(substitution,
+				std::min(previous[j], current[j - 1]) + 1);
+		}
+
+		std::swap(previous, current);
+	}
+
+	return previous[right.size()];
+}
+
+KnobDatabase::StringPairVector KnobDatabase::getUnrecognizedKnobs()
+{
+	auto& database = getDatabase();
+
+	DatabaseLock lock(database.mutex);
+
+	KnobDatabaseImplementation::StringSet known = database.lookedUp;
+
+	for(auto& handle : database.handles)
+	{
+		known.insert(handle.first);
+	}
+
+	StringPairVector unrecognized;
+
+	for(auto& knob : database.knobs)
+	{
+		if(known.count(knob.first) != 0)
+		{
+			continue;
+		}
+
+		// only suggest names that are a typo or two away
+		size_t closestDistance = std::max<size_t>(3, knob.first.size() / 8) + 1;
+
+		std::string closest;
+
+		for(auto& name : known)
+		{
+			size_t distance = getEditDistance(knob.first, name);
+
+			if(distance < closestDistance)
+			{
+				closestDistance = distance;
+				closest         = name;
+			}
+		}
+
+		unrecognized.push_back(std::make_pair(knob.first, closest));
+	}
+
+	return unrecognized;
+}
+
+void KnobDatabase::registerKnob(KnobBase* knob)
+{
+	auto& database = getDatabase();
+
+	DatabaseLock lock(database.mutex);
+
+	database.handles.insert(std::make_pair(knob->name(), knob));
+
+	auto value = database.knobs.find(knob->name());
+
+	if(value != database.knobs.end())
+	{
+		knob->update(&value->second);
+	}
+}
+
+void KnobDatabase::unregisterKnob(KnobBase* knob)
+{
+	auto& database = getDatabase();
+
+	DatabaseLock lock(database.mutex);
+
+	auto range = database.handles.equal_range(knob->name());
+
+	for(auto handle = range.first; handle != range.second; ++handle)
+	{
+		if(handle->second == knob)
+		{
+			database.handles.erase(handle);
+			break;
+		}
+	}
+}
+
+KnobBase::KnobBase(const std::string& name, const std::string& description)
+: _isSet(false), _name(name), _description(description)
+{
+
+}
+
+KnobBase::~KnobBase()
+{
+
+}
+
+const std::string& KnobBase::name() const
+{
+	return _name;
+}
+
+const std::string& KnobBase::description() const
+{
+	return _description;
+}
+
+bool KnobBase::isSet() const
+{
+	return _isSet.load(std::memory_order_relaxed);
+}
+
+void KnobBase::onChange(const Callback& callback)
+{
+	auto& database = getDatabase();
+
+	DatabaseLock lock(database.mutex);
+
+	_callbacks.push_back(callback);
+}
+
+void KnobBase::notify()
+{
+	for(auto& callback : _callbacks)
+	{
+		callback();
+	}
+}
+
 }
 
 }
@@ -0,0 +1,95 @@
+/*	\file   MemoryMappedFile.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The source file for the MemoryMappedFile class.
+*/
+
+// Minerva Includes
+#include <minerva/util/interface/MemoryMappedFile.h>
+
+#include <minerva/util/interface/debug.h>
+
+// System Includes
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Standard Library Includes
+#include <stdexcept>
+
+namespace minerva
+{
+
+namespace util
+{
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path)
+: _path(path), _data(nullptr), _size(0)
+{
+	int file = ::open(path.c_str(), O_RDONLY);
+	
+	if(file < 0)
+	{
+		throw std::runtime_error("Failed to open '" + path + "' for mapping.");
+	}
+	
+	struct stat status;
+	
+	if(::fstat(file, &status) != 0)
+	{
+		::close(file);
+		
+		throw std::runtime_error("Failed to get the size of '" + path + "'.");
+	}
+	
+	_size = status.st_size;
+	
+	if(_size > 0)
+	{
+		void* mapping = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file, 0);
+		
+		if(mapping == MAP_FAILED)
+		{
+			::close(file);
+			
+			throw std::runtime_error("Failed to map '" + path + "' into memory.");
+		}
+		
+		_data = static_cast<const char*>(mapping);
+	}
+	
+	// the mapping remains valid after the descriptor is closed
+	::close(file);
+	
+	util::log("MemoryMappedFile") << "Mapped " << _size << " bytes from '"
+		<< path << "'\n";
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+	if(_data != nullptr)
+	{
+		::munmap(const_cast<char*>(_data), _size);
+	}
+}
+
+const char* MemoryMappedFile::data() const
+{
+	return _data;
+}
+
+size_t MemoryMappedFile::size() const
+{
+	return _size;
+}
+
+const std::string& MemoryMappedFile::path() const
+{
+	return _path;
+}
+
+}
+
+}
+
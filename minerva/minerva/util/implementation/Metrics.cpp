@@ -0,0 +1,506 @@
+/*	\file   Metrics.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The source file for the Metrics registry and metric classes.
+*/
+
+// Minerva Includes
+#include <minerva/util/interface/Metrics.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+
+// Standard Library Includes
+#include <map>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <cstring>
+#include <cstdio>
+
+// System Includes
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+namespace minerva
+{
+
+namespace util
+{
+
+Histogram::BucketVector Histogram::getDefaultLatencyBuckets()
+{
+	BucketVector buckets;
+
+	for(double bound = 1.0e-4; bound < 200.0; bound *= 4.0)
+	{
+		buckets.push_back(bound);
+	}
+
+	return buckets;
+}
+
+class MetricEntry
+{
+public:
+	enum Type
+	{
+		CounterType,
+		GaugeType,
+		HistogramType
+	};
+
+public:
+	MetricEntry(const std::string& name, const std::string& help, Type type)
+	: name(name), help(help), type(type)
+	{
+
+	}
+
+public:
+	const char* typeName() const
+	{
+		switch(type)
+		{
+		case CounterType: return "counter";
+		case GaugeType:   return "gauge";
+		default:          return "histogram";
+		}
+	}
+
+public:
+	std::string name;
+	std::string help;
+	Type        type;
+
+public:
+	std::unique_ptr<Counter>   counter;
+	std::unique_ptr<Gauge>     gauge;
+	std::unique_ptr<Histogram> histogram;
+
+};
+
+/*! \brief Serves the metrics over HTTP and/or writes them to a file */
+class MetricsExporter
+{
+public:
+	MetricsExporter()
+	: _started(false), _stopped(false), _listenSocket(-1), _interval(10.0)
+	{
+
+	}
+
+	~MetricsExporter()
+	{
+		stop();
+	}
+
+public:
+	void start()
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		if(_started)
+		{
+			return;
+		}
+
+		unsigned int port = KnobDatabase::getKnobValue("Metrics::Port", 0U);
+
+		_path     = KnobDatabase::getKnobValue("Metrics::Path", "");
+		_interval = KnobDatabase::getKnobValue("Metrics::IntervalSeconds", 10.0);
+
+		if(port != 0)
+		{
+			_listenSocket = _openListenSocket(port);
+		}
+
+		_started = true;
+		_stopped = false;
+
+		if(port != 0)
+		{
+			log("Metrics") << "Serving metrics on port " << port << "\n";
+
+			_server = std::thread(&MetricsExporter::_serve, this);
+		}
+
+		if(!_path.empty())
+		{
+			log("Metrics") << "Writing metrics to '" << _path << "' every "
+				<< _interval << " seconds\n";
+
+			_writer = std::thread(&MetricsExporter::_writePeriodically, this);
+		}
+	}
+
+	void stop()
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			if(!_started)
+			{
+				return;
+			}
+
+			_started = false;
+			_stopped = true;
+
+			if(_listenSocket >= 0)
+			{
+				::shutdown(_listenSocket, SHUT_RDWR);
+			}
+		}
+
+		_condition.notify_all();
+
+		if(_server.joinable())
+		{
+			_server.join();
+		}
+
+		if(_writer.joinable())
+		{
+			_writer.join();
+		}
+
+		if(_listenSocket >= 0)
+		{
+			::close(_listenSocket);
+
+			_listenSocket = -1;
+		}
+	}
+
+private:
+	static int _openListenSocket(unsigned int port)
+	{
+		int listenSocket = ::socket(AF_INET, SOCK_STREAM, 0);
+
+		if(listenSocket < 0)
+		{
+			throw std::runtime_error("Failed to create metrics socket.");
+		}
+
+		int reuse = 1;
+
+		::setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse,
+			sizeof(reuse));
+
+		sockaddr_in address;
+
+		std::memset(&address, 0, sizeof(address));
+
+		address.sin_family      = AF_INET;
+		address.sin_port        = htons(port);
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+		if(::bind(listenSocket, (sockaddr*)&address, sizeof(address)) != 0 ||
+			::listen(listenSocket, SOMAXCONN) != 0)
+		{
+			::close(listenSocket);
+
+			std::stringstream message;
+
+			message << "Failed to serve metrics on port " << port << ".";
+
+			throw std::runtime_error(message.str());
+		}
+
+		return listenSocket;
+	}
+
+	void _serve()
+	{
+		while(true)
+		{
+			int connection = ::accept(_listenSocket, nullptr, nullptr);
+
+			if(connection < 0)
+			{
+				break;
+			}
+
+			// the request is not inspected, every path returns the metrics
+			char request[1024];
+
+			::recv(connection, request, sizeof(request), 0);
+
+			std::stringstream body;
+
+			Metrics::write(body);
+
+			std::stringstream response;
+
+			response << "HTTP/1.0 200 OK\r\n"
+				<< "Content-Type: text/plain; version=0.0.4\r\n"
+				<< "Content-Length: " << body.str().size() << "\r\n"
+				<< "Connection: close\r\n\r\n" << body.str();
+
+			auto message = response.str();
+
+			#ifdef MSG_NOSIGNAL
+			int flags = MSG_NOSIGNAL;
+			#else
+			int flags = 0;
+			#endif
+
+			size_t sent = 0;
+
+			while(sent < message.size())
+			{
+				auto bytes = ::send(connection, message.data() + sent,
+					message.size() - sent, flags);
+
+				if(bytes <= 0)
+				{
+					break;
+				}
+
+				sent += bytes;
+			}
+
+			::close(connection);
+		}
+	}
+
+	void _writePeriodically()
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		while(!_stopped)
+		{
+			_condition.wait_for(lock, std::chrono::duration<double>(_interval));
+
+			lock.unlock();
+
+			_writeFile();
+
+			lock.lock();
+		}
+	}
+
+	void _writeFile()
+	{
+		// write then rename, so readers never see a partial dump
+		auto temporaryPath = _path + ".partial";
+
+		{
+			std::ofstream file(temporaryPath);
+
+			if(!file.good())
+			{
+				log("Metrics") << "Failed to open '" << temporaryPath
+					<< "' for writing.\n";
+				return;
+			}
+
+			Metrics::write(file);
+		}
+
+		std::rename(temporaryPath.c_str(), _path.c_str());
+	}
+
+private:
+	bool _started;
+	bool _stopped;
+
+private:
+	int         _listenSocket;
+	std::string _path;
+	double      _interval;
+
+private:
+	std::thread _server;
+	std::thread _writer;
+
+private:
+	std::mutex              _mutex;
+	std::condition_variable _condition;
+
+};
+
+class MetricsRegistry
+{
+public:
+	~MetricsRegistry()
+	{
+		exporter.stop();
+	}
+
+public:
+	MetricEntry& getEntry(const std::string& name, const std::string& help,
+		MetricEntry::Type type)
+	{
+		auto entry = index.find(name);
+
+		if(entry != index.end())
+		{
+			if(entry->second->type != type)
+			{
+				throw std::runtime_error("Metric '" + name +
+					"' was already registered as a " +
+					entry->second->typeName() + ".");
+			}
+
+			return *entry->second;
+		}
+
+		entries.push_back(std::unique_ptr<MetricEntry>(
+			new MetricEntry(name, help, type)));
+
+		index[name] = entries.back().get();
+
+		return *entries.back();
+	}
+
+public:
+	typedef std::vector<std::unique_ptr<MetricEntry>> MetricEntryVector;
+	typedef std::map<std::string, MetricEntry*> NameToMetricMap;
+
+public:
+	std::mutex        mutex;
+	MetricEntryVector entries;
+	NameToMetricMap   index;
+
+public:
+	// declared last, its threads read the metrics until it is destroyed
+	MetricsExporter exporter;
+
+};
+
+static MetricsRegistry& getMetricsRegistry()
+{
+	static MetricsRegistry registry;
+
+	return registry;
+}
+
+Counter& Metrics::getCounter(const std::string& name, const std::string& help)
+{
+	auto& registry = getMetricsRegistry();
+
+	std::unique_lock<std::mutex> lock(registry.mutex);
+
+	auto& entry = registry.getEntry(name, help, MetricEntry::CounterType);
+
+	if(!entry.counter)
+	{
+		entry.counter.reset(new Counter);
+	}
+
+	return *entry.counter;
+}
+
+Gauge& Metrics::getGauge(const std::string& name, const std::string& help)
+{
+	auto& registry = getMetricsRegistry();
+
+	std::unique_lock<std::mutex> lock(registry.mutex);
+
+	auto& entry = registry.getEntry(name, help, MetricEntry::GaugeType);
+
+	if(!entry.gauge)
+	{
+		entry.gauge.reset(new Gauge);
+	}
+
+	return *entry.gauge;
+}
+
+Histogram& Metrics::getHistogram(const std::string& name,
+	const std::string& help, const Histogram::BucketVector& buckets)
+{
+	auto& registry = getMetricsRegistry();
+
+	std::unique_lock<std::mutex> lock(registry.mutex);
+
+	auto& entry = registry.getEntry(name, help, MetricEntry::HistogramType);
+
+	if(!entry.histogram)
+	{
+		entry.histogram.reset(new Histogram(buckets));
+	}
+
+	return *entry.histogram;
+}
+
+static void writeHistogram(std::ostream& stream, const std::string& name,
+	const Histogram& histogram)
+{
+	uint64_t cumulative = 0;
+
+	auto& buckets = histogram.buckets();
+
+	for(size_t bucket = 0; bucket < buckets.size(); ++bucket)
+	{
+		cumulative += histogram.bucketCount(bucket);
+
+		stream << name << "_bucket{le=\"" << buckets[bucket] << "\"} "
+			<< cumulative << "\n";
+	}
+
+	cumulative += histogram.bucketCount(buckets.size());
+
+	stream << name << "_bucket{le=\"+Inf\"} " << cumulative << "\n";
+	stream << name << "_sum " << histogram.sum() << "\n";
+	stream << name << "_count " << histogram.count() << "\n";
+}
+
+void Metrics::write(std::ostream& stream)
+{
+	auto& registry = getMetricsRegistry();
+
+	std::unique_lock<std::mutex> lock(registry.mutex);
+
+	stream << std::setprecision(15);
+
+	for(auto& entry : registry.entries)
+	{
+		stream << "# HELP " << entry->name << " " << entry->help << "\n";
+		stream << "# TYPE " << entry->name << " " << entry->typeName() << "\n";
+
+		switch(entry->type)
+		{
+		case MetricEntry::CounterType:
+		{
+			stream << entry->name << " " << entry->counter->value() << "\n";
+			break;
+		}
+		case MetricEntry::GaugeType:
+		{
+			stream << entry->name << " " << entry->gauge->value() << "\n";
+			break;
+		}
+		case MetricEntry::HistogramType:
+		{
+			writeHistogram(stream, entry->name, *entry->histogram);
+			break;
+		}
+		}
+	}
+}
+
+void Metrics::startExporting()
+{
+	getMetricsRegistry().exporter.start();
+}
+
+void Metrics::stopExporting()
+{
+	getMetricsRegistry().exporter.stop();
+}
+
+}
+
+}
+
@@ -0,0 +1,113 @@
+/*! \file   PhiloxRandomEngine.cpp
+	\author Gregory Diamos <gregory.diamos@gmail.com>
+	\date   Sunday October 18, 2026
+	\brief  The source file for the PhiloxRandomEngine class.
+*/
+
+// Minerva Includes
+#include <minerva/util/interface/PhiloxRandomEngine.h>
+
+namespace minerva
+{
+
+namespace util
+{
+
+// The constants of Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3"
+static const uint32_t multiplier0 = 0xD2511F53;
+static const uint32_t multiplier1 = 0xCD9E8D57;
+static const uint32_t keyStep0    = 0x9E3779B9;
+static const uint32_t keyStep1    = 0xBB67AE85;
+
+static const size_t rounds = 10;
+
+PhiloxRandomEngine::PhiloxRandomEngine(uint64_t seed, uint64_t stream)
+: _index(0)
+{
+	_key[0] = (uint32_t)seed;
+	_key[1] = (uint32_t)(seed >> 32);
+	
+	// the low half of the counter is the position, the high half the stream
+	_counter[0] = 0;
+	_counter[1] = 0;
+	_counter[2] = (uint32_t)stream;
+	_counter[3] = (uint32_t)(stream >> 32);
+	
+	_generate();
+}
+
+PhiloxRandomEngine::result_type PhiloxRandomEngine::operator()()
+{
+	if(_index == 4)
+	{
+		if(++_counter[0] == 0)
+		{
+			++_counter[1];
+		}
+		
+		_generate();
+	}
+	
+	return _values[_index++];
+}
+
+void PhiloxRandomEngine::discard(uint64_t values)
+{
+	uint64_t position = ((uint64_t)_counter[1] << 32) + _counter[0];
+	
+	uint64_t next = position * 4 + _index + values;
+	
+	_counter[0] = (uint32_t)(next / 4);
+	_counter[1] = (uint32_t)((next / 4) >> 32);
+	
+	_generate();
+	
+	_index = next % 4;
+}
+
+float PhiloxRandomEngine::uniform(float min, float max)
+{
+	float unit = ((*this)() >> 8) * (1.0f / 16777216.0f);
+	
+	return min + unit * (max - min);
+}
+
+void PhiloxRandomEngine::_generate()
+{
+	uint32_t counter[4] = {_counter[0], _counter[1], _counter[2], _counter[3]};
+	uint32_t key[2]     = {_key[0], _key[1]};
+	
+	for(size_t round = 0; round < rounds; ++round)
+	{
+		uint64_t product0 = (uint64_t)multiplier0 * counter[0];
+		uint64_t product1 = (uint64_t)multiplier1 * counter[2];
+		
+		uint32_t next[4] =
+		{
+			(uint32_t)(product1 >> 32) ^ counter[1] ^ key[0],
+			(uint32_t)product1,
+			(uint32_t)(product0 >> 32) ^ counter[3] ^ key[1],
+			(uint32_t)product0
+		};
+		
+		counter[0] = next[0];
+		counter[1] = next[1];
+		counter[2] = next[2];
+		counter[3] = next[3];
+		
+		key[0] += keyStep0;
+		key[1] += keyStep1;
+	}
+	
+	for(size_t i = 0; i < 4; ++i)
+	{
+		_values[i] = counter[i];
+	}
+	
+	_index = 0;
+}
+
+}
+
+}
+
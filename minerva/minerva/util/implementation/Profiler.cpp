@@ -0,0 +1,483 @@
+/*	\file   Profiler.cpp
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The source file for the Profiler and ProfilerScope classes.
+*/
+
+// Minerva Includes
+#include <minerva/util/interface/Profiler.h>
+
+#include <minerva/util/interface/SystemCompatibility.h>
+#include <minerva/util/interface/Knobs.h>
+
+// Standard Library Includes
+#include <map>
+#include <list>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+namespace minerva
+{
+
+namespace util
+{
+
+class ProfileNode
+{
+public:
+	ProfileNode(const char* name, ProfileNode* parent)
+	: name(name), parent(parent), calls(0), seconds(0.0),
+	  floatingPointOperations(0), bytesAllocated(0)
+	{
+
+	}
+
+public:
+	ProfileNode* getChild(const char* childName)
+	{
+		auto child = children.find(childName);
+
+		if(child == children.end())
+		{
+			child = children.insert(std::make_pair(childName,
+				std::unique_ptr<ProfileNode>(
+				new ProfileNode(childName, this)))).first;
+		}
+
+		return child->second.get();
+	}
+
+public:
+	typedef std::map<const char*, std::unique_ptr<ProfileNode>> NodeMap;
+
+public:
+	const char*  name;
+	ProfileNode* parent;
+
+public:
+	NodeMap children;
+
+public:
+	size_t calls;
+	double seconds;
+	size_t floatingPointOperations;
+	size_t bytesAllocated;
+
+};
+
+class TraceEvent
+{
+public:
+	TraceEvent(const char* name, double start, double duration)
+	: name(name), start(start), duration(duration)
+	{
+
+	}
+
+public:
+	const char* name;
+	double      start;
+	double      duration;
+
+};
+
+class ThreadProfile
+{
+public:
+	ThreadProfile(size_t id)
+	: root("root", nullptr), current(&root), bytesAllocated(0), id(id)
+	{
+
+	}
+
+public:
+	typedef std::vector<TraceEvent> TraceEventVector;
+
+public:
+	ProfileNode  root;
+	ProfileNode* current;
+	size_t       bytesAllocated;
+	size_t       id;
+
+public:
+	TraceEventVector events;
+
+};
+
+class ProfilerDatabase
+{
+public:
+	typedef std::chrono::steady_clock Clock;
+	typedef std::list<std::unique_ptr<ThreadProfile>> ThreadProfileList;
+
+public:
+	ProfilerDatabase()
+	: tracing(false), maximumTraceEvents(0), epoch(Clock::now())
+	{
+
+	}
+
+	~ProfilerDatabase();
+
+public:
+	ThreadProfile* createThreadProfile()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		threads.push_back(std::unique_ptr<ThreadProfile>(
+			new ThreadProfile(threads.size())));
+
+		return threads.back().get();
+	}
+
+public:
+	std::mutex        mutex;
+	ThreadProfileList threads;
+
+public:
+	std::string reportPath;
+	std::string tracePath;
+
+public:
+	bool   tracing;
+	size_t maximumTraceEvents;
+
+public:
+	Clock::time_point epoch;
+
+};
+
+static ProfilerDatabase& getProfilerDatabase()
+{
+	static ProfilerDatabase database;
+
+	return database;
+}
+
+static thread_local ThreadProfile* threadProfile = nullptr;
+
+static ThreadProfile& getThreadProfile()
+{
+	if(threadProfile == nullptr)
+	{
+		threadProfile = getProfilerDatabase().createThreadProfile();
+	}
+
+	return *threadProfile;
+}
+
+std::atomic<int> Profiler::_state(Profiler::Unknown);
+
+void Profiler::enable(bool enabled)
+{
+	getProfilerDatabase();
+
+	_state.store(enabled ? Enabled : Disabled, std::memory_order_relaxed);
+}
+
+void Profiler::recordAllocation(size_t bytes)
+{
+	if(!isEnabled())
+	{
+		return;
+	}
+
+	getThreadProfile().bytesAllocated += bytes;
+}
+
+class MergedNode
+{
+public:
+	MergedNode()
+	: calls(0), seconds(0.0), floatingPointOperations(0), bytesAllocated(0)
+	{
+
+	}
+
+public:
+	void merge(const ProfileNode& node)
+	{
+		calls                   += node.calls;
+		seconds                 += node.seconds;
+		floatingPointOperations += node.floatingPointOperations;
+		bytesAllocated          += node.bytesAllocated;
+
+		for(auto& child : node.children)
+		{
+			children[child.first].merge(*child.second);
+		}
+	}
+
+public:
+	std::map<std::string, MergedNode> children;
+
+public:
+	size_t calls;
+	double seconds;
+	size_t floatingPointOperations;
+	size_t bytesAllocated;
+
+};
+
+static void reportNode(std::ostream& stream, const std::string& name,
+	const MergedNode& node, double parentSeconds, size_t depth);
+
+/*! \brief Report the children of a node, slowest first */
+static void reportChildren(std::ostream& stream, const MergedNode& node,
+	double seconds, size_t depth)
+{
+	std::vector<std::pair<std::string, const MergedNode*>> children;
+
+	for(auto& child : node.children)
+	{
+		children.push_back(std::make_pair(child.first, &child.second));
+	}
+
+	std::sort(children.begin(), children.end(), [](
+		const std::pair<std::string, const MergedNode*>& left,
+		const std::pair<std::string, const MergedNode*>& right)
+	{
+		return left.second->seconds > right.second->seconds;
+	});
+
+	for(auto& child : children)
+	{
+		reportNode(stream, child.first, *child.second, seconds, depth);
+	}
+}
+
+static void reportNode(std::ostream& stream, const std::string& name,
+	const MergedNode& node, double parentSeconds, size_t depth)
+{
+	double peakGigaflops = getMachineFlops() / 1.0e9;
+
+	double gigaflops = node.seconds > 0.0 ?
+		node.floatingPointOperations / (node.seconds * 1.0e9) : 0.0;
+
+	stream << std::left << std::setw(56)
+		<< (std::string(2 * depth, ' ') + name) << std::right
+		<< std::setw(10) << node.calls
+		<< std::setw(12) << std::fixed << std::setprecision(4) << node.seconds
+		<< std::setw(8)  << std::setprecision(1)
+		<< (parentSeconds > 0.0 ? 100.0 * node.seconds / parentSeconds : 100.0)
+		<< std::setw(10) << std::setprecision(2) << gigaflops
+		<< std::setw(8)  << std::setprecision(1)
+		<< (peakGigaflops > 0.0 ? 100.0 * gigaflops / peakGigaflops : 0.0)
+		<< std::setw(12) << std::setprecision(2)
+		<< node.bytesAllocated / (1024.0 * 1024.0) << "\n";
+
+	reportChildren(stream, node, node.seconds, depth + 1);
+}
+
+void Profiler::writeReport(std::ostream& stream)
+{
+	auto& database = getProfilerDatabase();
+
+	std::unique_lock<std::mutex> lock(database.mutex);
+
+	MergedNode root;
+
+	for(auto& thread : database.threads)
+	{
+		root.merge(thread->root);
+	}
+
+	double totalSeconds = 0.0;
+
+	for(auto& child : root.children)
+	{
+		totalSeconds += child.second.seconds;
+	}
+
+	stream << "Profile (" << database.threads.size() << " threads, machine peak "
+		<< std::fixed << std::setprecision(2) << getMachineFlops() / 1.0e9
+		<< " GFLOP/s)\n";
+
+	stream << std::left << std::setw(56) << "scope" << std::right
+		<< std::setw(10) << "calls"
+		<< std::setw(12) << "seconds"
+		<< std::setw(8)  << "%parent"
+		<< std::setw(10) << "GFLOP/s"
+		<< std::setw(8)  << "%peak"
+		<< std::setw(12) << "MB alloc" << "\n";
+
+	reportChildren(stream, root, totalSeconds, 0);
+}
+
+static std::string escapeJson(const char* name)
+{
+	std::string result;
+
+	for(const char* character = name; *character != '\0'; ++character)
+	{
+		if(*character == '"' || *character == '\\')
+		{
+			result.push_back('\\');
+		}
+
+		result.push_back(*character);
+	}
+
+	return result;
+}
+
+void Profiler::writeChromeTrace(std::ostream& stream)
+{
+	auto& database = getProfilerDatabase();
+
+	std::unique_lock<std::mutex> lock(database.mutex);
+
+	stream << "{\"traceEvents\":[\n";
+
+	bool first = true;
+
+	for(auto& thread : database.threads)
+	{
+		for(auto& event : thread->events)
+		{
+			if(!first)
+			{
+				stream << ",\n";
+			}
+
+			first = false;
+
+			stream << std::fixed << std::setprecision(3)
+				<< "{\"name\":\"" << escapeJson(event.name)
+				<< "\",\"cat\":\"minerva\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+				<< thread->id << ",\"ts\":" << event.start
+				<< ",\"dur\":" << event.duration << "}";
+		}
+	}
+
+	stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void Profiler::reset()
+{
+	auto& database = getProfilerDatabase();
+
+	std::unique_lock<std::mutex> lock(database.mutex);
+
+	for(auto& thread : database.threads)
+	{
+		thread->root.children.clear();
+		thread->root.calls   = 0;
+		thread->root.seconds = 0.0;
+		thread->current      = &thread->root;
+		thread->events.clear();
+	}
+}
+
+int Profiler::_readKnobs()
+{
+	auto& database = getProfilerDatabase();
+
+	bool enabled = KnobDatabase::getKnobValue("Profiler::Enable", false);
+
+	{
+		std::unique_lock<std::mutex> lock(database.mutex);
+
+		database.reportPath = KnobDatabase::getKnobValue(
+			"Profiler::ReportPath", "");
+		database.tracePath = KnobDatabase::getKnobValue(
+			"Profiler::TracePath", "");
+		database.maximumTraceEvents = KnobDatabase::getKnobValue<size_t>(
+			"Profiler::MaximumTraceEvents", 1 << 20);
+
+		database.tracing = !database.tracePath.empty();
+	}
+
+	int state = enabled ? Enabled : Disabled;
+	int expected = Unknown;
+
+	if(!_state.compare_exchange_strong(expected, state))
+	{
+		return expected;
+	}
+
+	return state;
+}
+
+ProfilerDatabase::~ProfilerDatabase()
+{
+	if(Profiler::isEnabled() == false || threads.empty())
+	{
+		return;
+	}
+
+	if(reportPath.empty())
+	{
+		Profiler::writeReport(std::cout);
+	}
+	else
+	{
+		std::ofstream stream(reportPath);
+
+		Profiler::writeReport(stream);
+	}
+
+	if(tracing)
+	{
+		std::ofstream stream(tracePath);
+
+		Profiler::writeChromeTrace(stream);
+	}
+}
+
+void ProfilerScope::addFloatingPointOperations(size_t operations)
+{
+	_floatingPointOperations += operations;
+}
+
+void ProfilerScope::_begin(const char* name, size_t floatingPointOperations)
+{
+	auto& thread = getThreadProfile();
+
+	_parent = thread.current;
+	_node   = _parent->getChild(name);
+
+	thread.current = _node;
+
+	_floatingPointOperations = floatingPointOperations;
+	_bytesAtStart            = thread.bytesAllocated;
+
+	_start = Clock::now();
+}
+
+void ProfilerScope::_end()
+{
+	auto end = Clock::now();
+
+	auto& thread = getThreadProfile();
+
+	double seconds = std::chrono::duration<double>(end - _start).count();
+
+	_node->calls                   += 1;
+	_node->seconds                 += seconds;
+	_node->floatingPointOperations += _floatingPointOperations;
+	_node->bytesAllocated          += thread.bytesAllocated - _bytesAtStart;
+
+	thread.current = _parent;
+
+	auto& database = getProfilerDatabase();
+
+	if(database.tracing && thread.events.size() < database.maximumTraceEvents)
+	{
+		double start = std::chrono::duration<double, std::micro>(
+			_start - database.epoch).count();
+
+		thread.events.push_back(TraceEvent(_node->name, start,
+			seconds * 1.0e6));
+	}
+}
+
+}
+
+}
+
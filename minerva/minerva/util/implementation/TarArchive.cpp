@@ -10,9 +10,13 @@
 #include <minerva/util/interface/TarLibrary.h>
 
 #include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/Metrics.h>
 
 // Standard Library Includes
 #include <stdexcept>
+#include <sstream>
+#include <thread>
 #include <map>
 
 namespace minerva
@@ -21,6 +25,11 @@ namespace minerva
 namespace util
 {
 
+static Counter& cacheHits = Metrics::getCounter(
+	"minerva_archive_cache_hits_total", "Archive reads served from the cache.");
+static Counter& cacheMisses = Metrics::getCounter(
+	"minerva_archive_cache_misses_total", "Archive reads that scanned the archive.");
+
 static size_t getSize(std::istream& stream)
 {
 	size_t position = stream.tellg();
@@ -94,7 +103,8 @@ public:
 			if(TarLibrary::archive_read_open_FILE(_archive, _file) !=
 				TarLibrary::OK)
 			{
-				throw std::runtime_error("Failed to open archive.");
+				throw std::runtime_error("Failed to open archive. Message: " +
+					TarLibrary::archive_error_string(_archive));
 			}
 			
 			util::log("TarArchive") << " Opened archive in read mode...\n";
@@ -118,12 +128,7 @@ public:
 				throw std::runtime_error("Failed to create new archive.");
 			}
 			
-			if(TarLibrary::archive_write_set_compression_gzip(_archive) !=
-				TarLibrary::OK)
-			{
-				throw std::runtime_error("Failed to setup "
-					"archive compression.");
-			}
+			_setupCompression();
 			
 			if(TarLibrary::archive_write_set_format_pax_restricted(_archive) !=
 				TarLibrary::OK)
@@ -178,6 +183,94 @@ public:
 	}
 
 	void addFile(const std::string& name, std::istream& file)
+	{
+		size_t size = getSize(file);
+		
+		auto entry = _writeEntryHeader(name, size);
+		
+		util::log("TarArchive") << "  Writing data (" << size
+			<< " bytes) to archive...\n";
+		
+		char buffer[1024];
+		
+		while(size > 0)
+		{
+			int count = file.readsome(buffer, 1024);
+		
+			size -= count;
+		
+			if(TarLibrary::archive_write_data(_archive, buffer, count) != count)
+			{
+				TarLibrary::archive_entry_free(entry);
+				
+				throw std::runtime_error("Failed to write data to archive."
+					"Message: " + TarLibrary::archive_error_string(_archive));
+			}
+		}
+
+		_finishEntry(entry);
+	}
+
+	void addFile(const std::string& name, const TarArchive::BufferVector& buffers)
+	{
+		size_t size = 0;
+		
+		for(auto& buffer : buffers)
+		{
+			size += buffer.second;
+		}
+		
+		auto entry = _writeEntryHeader(name, size);
+		
+		util::log("TarArchive") << "  Writing data (" << size
+			<< " bytes) to archive from " << buffers.size() << " buffers...\n";
+		
+		for(auto& buffer : buffers)
+		{
+			auto   data      = static_cast<const char*>(buffer.first);
+			size_t remaining = buffer.second;
+			
+			// libarchive may accept less than requested in a single call
+			while(remaining > 0)
+			{
+				int count = TarLibrary::archive_write_data(_archive,
+					data, remaining);
+				
+				if(count <= 0)
+				{
+					TarLibrary::archive_entry_free(entry);
+					
+					throw std::runtime_error("Failed to write data to archive."
+						"Message: " + TarLibrary::archive_error_string(_archive));
+				}
+				
+				data      += count;
+				remaining -= count;
+			}
+		}
+		
+		_finishEntry(entry);
+	}
+
+	void extractFile(const std::string& name, std::ostream& file)
+	{
+		if(_loadFileFromCache(name, file))
+		{
+			cacheHits.increment();
+			return;
+		}
+		
+		cacheMisses.increment();
+		
+		_readFileIntoCache(name);
+		
+		_loadFileFromCache(name, file);
+	
+	}
+
+private:
+	TarLibrary::archive_entry* _writeEntryHeader(const std::string& name,
+		size_t size)
 	{
 		util::log("TarArchive") << " Adding file '" + name +
 			"' to archive '" + _path + "'\n";
@@ -191,8 +284,6 @@ public:
 
 		util::log("TarArchive") << "  Creating entry in archive...\n";
 		
-		size_t size = getSize(file);
-		
 		TarLibrary::archive_entry_set_uid(entry, 0);
 		TarLibrary::archive_entry_set_uname(entry, "root");
 		TarLibrary::archive_entry_set_gid(entry, 0);
@@ -210,27 +301,16 @@ public:
 			throw std::runtime_error("Failed to write entry to archive. "
 				"Message: " + TarLibrary::archive_error_string(_archive));
 		}
-
-		util::log("TarArchive") << "  Writing data (" << size
-			<< " bytes) to archive...\n";
-		
-		char buffer[1024];
-		
-		while(size > 0)
-		{
-			int count = file.readsome(buffer, 1024);
-		
-			size -= count;
 		
-			if(TarLibrary::archive_write_data(_archive, buffer, count) != count)
-			{
-				throw std::runtime_error("Failed to write data to archive."
-					"Message: " + TarLibrary::archive_error_string(_archive));
-			}
-		}
-
+		return entry;
+	}
+	
+	void _finishEntry(TarLibrary::archive_entry* entry)
+	{
 		if(TarLibrary::archive_write_finish_entry(_archive) != TarLibrary::OK)
 		{
+			TarLibrary::archive_entry_free(entry);
+			
 			throw std::runtime_error("Failed to finish "
 				"writing data to archive.");
 		}
@@ -239,18 +319,46 @@ public:
 
 		util::log("TarArchive") << "  File added successfully...\n";
 	}
-
-	void extractFile(const std::string& name, std::ostream& file)
+	
+	void _setupCompression()
 	{
-		if(_loadFileFromCache(name, file))
+		if(_mode == "w:gz")
 		{
+			if(TarLibrary::archive_write_set_compression_gzip(_archive) !=
+				TarLibrary::OK)
+			{
+				throw std::runtime_error("Failed to setup "
+					"archive compression.");
+			}
+			
 			return;
 		}
 		
-		_readFileIntoCache(name);
+		if(TarLibrary::archive_write_add_filter_zstd(_archive) !=
+			TarLibrary::OK)
+		{
+			throw std::runtime_error("Failed to setup zstd archive "
+				"compression, libarchive may be too old.");
+		}
 		
-		_loadFileFromCache(name, file);
-	
+		// zstd readers reject the zero padding of a full tar block
+		TarLibrary::archive_write_set_bytes_in_last_block(_archive, 1);
+		
+		size_t threads = util::KnobDatabase::getKnobValue(
+			"TarArchive::CompressionThreads",
+			std::max(1U, std::thread::hardware_concurrency()));
+		
+		std::stringstream threadString;
+		
+		threadString << threads;
+		
+		// older zstd filters ignore the option and compress serially
+		if(TarLibrary::archive_write_set_filter_option(_archive, "zstd",
+			"threads", threadString.str().c_str()) != TarLibrary::OK)
+		{
+			util::log("TarArchive") << " zstd filter does not support "
+				"threads, compressing serially.\n";
+		}
 	}
 
 private:
@@ -261,7 +369,7 @@ private:
 
 	bool isWriteMode()
 	{
-		return _mode == "w:gz";
+		return _mode == "w:gz" || _mode == "w:zst";
 	}
 
 private:
@@ -388,6 +496,11 @@ void TarArchive::addFile(const std::string& name, std::istream& file)
 	_archive->addFile(name, file);
 }
 
+void TarArchive::addFile(const std::string& name, const BufferVector& buffers)
+{
+	_archive->addFile(name, buffers);
+}
+
 void TarArchive::extractFile(const std::string& name, std::ostream& file)
 {
 	_archive->extractFile(name, file);
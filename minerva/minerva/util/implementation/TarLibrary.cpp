@@ -111,6 +111,33 @@ int TarLibrary::archive_write_set_compression_gzip(archive* a)
 	return (*_interface.archive_write_set_compression_gzip)(a);
 }
 
+int TarLibrary::archive_write_add_filter_zstd(archive* a)
+{
+	_check();
+	
+	// zstd is only available in newer versions of libarchive
+	if(_interface.archive_write_add_filter_zstd == nullptr)
+	{
+		return Failed;
+	}
+	
+	return (*_interface.archive_write_add_filter_zstd)(a);
+}
+
+int TarLibrary::archive_write_set_filter_option(archive* a,
+	const char* module, const char* option, const char* value)
+{
+	_check();
+	
+	if(_interface.archive_write_set_filter_option == nullptr)
+	{
+		return Failed;
+	}
+	
+	return (*_interface.archive_write_set_filter_option)(a, module,
+		option, value);
+}
+
 int TarLibrary::archive_write_set_format_pax_restricted(archive* a)
 {
 	_check();
@@ -118,6 +145,13 @@ int TarLibrary::archive_write_set_format_pax_restricted(archive* a)
 	return (*_interface.archive_write_set_format_pax_restricted)(a);
 }
 
+int TarLibrary::archive_write_set_bytes_in_last_block(archive* a, int bytes)
+{
+	_check();
+	
+	return (*_interface.archive_write_set_bytes_in_last_block)(a, bytes);
+}
+
 int TarLibrary::archive_write_open_FILE(archive* a, FILE* file)
 {
 	_check();
@@ -298,7 +332,10 @@ void TarLibrary::Interface::load()
 	DynLink(archive_write_new);
 	DynLink(archive_write_free);
 	DynLink(archive_write_set_compression_gzip);
+	DynLink(archive_write_add_filter_zstd);
+	DynLink(archive_write_set_filter_option);
 	DynLink(archive_write_set_format_pax_restricted);
+	DynLink(archive_write_set_bytes_in_last_block);
 	DynLink(archive_write_open_FILE);
 	DynLink(archive_write_header);
 	DynLink(archive_write_data);
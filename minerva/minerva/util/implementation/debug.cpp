@@ -19,6 +19,7 @@
 // Standard Library Includes
 #include <memory>
 #include <unordered_set>
+#include <mutex>
 
 
 #ifdef HAVE_CONFIG_H
@@ -83,17 +84,32 @@ namespace util
 		
 	public:
 		typedef std::unordered_set<std::string> StringSet;	
+		typedef std::unordered_set<LogChannel*> ChannelSet;
 	
 	public:
 		bool enableAll;
 		StringSet enabledLogs;
 
+	public:
+		std::mutex mutex;
+		ChannelSet channels;
+
 
 	public:
 		bool isEnabled(const std::string& logName) const
 		{
 			return enableAll || (enabledLogs.count(logName) != 0);
 		}
+		
+		void refreshChannels()
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			
+			for(auto channel : channels)
+			{
+				channel->refresh();
+			}
+		}
 	};
 	
 	LogDatabase::LogDatabase()
@@ -102,11 +118,21 @@ namespace util
 	
 	}
 	
-	static LogDatabase logDatabase;
+	// channels in other files may be constructed before this one
+	static LogDatabase& getLogDatabase()
+	{
+		static LogDatabase database;
+		
+		return database;
+	}
+	
+	static LogDatabase& logDatabase = getLogDatabase();
 	
 	void enableAllLogs()
 	{
 		logDatabase.enableAll = true;
+		
+		logDatabase.refreshChannels();
 	}
 	
 	void enableSpecificLogs(const std::string& modules)
@@ -122,6 +148,8 @@ namespace util
 	void enableLog(const std::string& name)
 	{
 		logDatabase.enabledLogs.insert(name);
+		
+		logDatabase.refreshChannels();
 	}
    
 	static std::unique_ptr<NullStream> nullstream;
@@ -147,6 +175,43 @@ namespace util
 	{
 		return logDatabase.isEnabled(name);
 	}
+	
+	LogChannel::LogChannel(const std::string& name)
+	: _name(name), _enabled(false)
+	{
+		auto& database = getLogDatabase();
+		
+		std::unique_lock<std::mutex> lock(database.mutex);
+		
+		database.channels.insert(this);
+		
+		refresh();
+	}
+	
+	LogChannel::~LogChannel()
+	{
+		auto& database = getLogDatabase();
+		
+		std::unique_lock<std::mutex> lock(database.mutex);
+		
+		database.channels.erase(this);
+	}
+	
+	std::ostream& LogChannel::stream() const
+	{
+		return _getStream(_name);
+	}
+	
+	const std::string& LogChannel::name() const
+	{
+		return _name;
+	}
+	
+	void LogChannel::refresh()
+	{
+		_enabled.store(getLogDatabase().isEnabled(_name),
+			std::memory_order_relaxed);
+	}
 
 }
 
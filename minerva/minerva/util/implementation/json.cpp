@@ -9,20 +9,21 @@
 */
 
 #include <minerva/util/interface/json.h>
+#include <minerva/util/interface/MemoryMappedFile.h>
 #include <minerva/util/interface/debug.h>
 
 #include <math.h>
 #include <sstream>
-#include <deque>
 #include <stdexcept>
 #include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <climits>
+#include <algorithm>
+#include <utility>
 
 #define EXCEPTION(message) std::runtime_error(message)
 
-#define throw_EXCEPTION_line(line, msg, stream) { std::stringstream ss; \
-	char buffer[32]; std::memset(buffer, 0, 32); stream.getline(buffer, 31); \
-	ss << "line " << line << ": " << msg << "\n before: " << buffer; throw std::runtime_error(ss.str()); }
-
 ////////////////////////////////////////////////////////////////////////////////
 namespace minerva {
 namespace util {
@@ -289,599 +290,347 @@ json::Value *json::Object::clone() const {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-json::Parser::Parser(): line_number(0) {
+json::Arena::Arena(size_t block_size): _position(0), _remaining(0),
+	_block_size(block_size) {
 
 }
 
-json::Parser::~Parser() {
-
+json::Arena::~Arena() {
+	clear();
 }
 
-json::Array *json::Parser::parse(std::istream &input) {
-	return 0;
+void *json::Arena::allocate(size_t size, size_t alignment) {
+	size_t padding = (alignment - ((size_t)_position % alignment)) % alignment;
+
+	if (_remaining < size + padding) {
+		size_t block_size = std::max(_block_size, size + alignment);
+
+		_blocks.push_back(static_cast<char *>(::operator new(block_size)));
+
+		_position = _blocks.back();
+		_remaining = block_size;
+
+		padding = (alignment - ((size_t)_position % alignment)) % alignment;
+	}
+
+	void *result = _position + padding;
+
+	_position += size + padding;
+	_remaining -= size + padding;
+
+	return result;
 }
 
-static bool is_whitespace_char(int ch) {
-	if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n') {
-		return true;
+void json::Arena::clear() {
+	for (std::vector< char * >::iterator block = _blocks.begin();
+		block != _blocks.end(); ++block) {
+		::operator delete(*block);
 	}
-	return false;
+
+	_blocks.clear();
+	_position = 0;
+	_remaining = 0;
 }
 
-int json::Parser::get_non_whitespace_char(std::istream &input) {
-	int ch;
-	bool reading = true;
-	bool in_comment = false;
-	
-	do {
-		ch = get_char(input);
-		if (in_comment) {
-			if(ch == '\n' || ch == '\r')
-			{
-				in_comment = false;
-			}
+////////////////////////////////////////////////////////////////////////////////
+
+json::Handler::~Handler() { }
+
+void json::Handler::begin_object() { }
+void json::Handler::key(const char *, size_t) { }
+void json::Handler::end_object() { }
+void json::Handler::begin_array() { }
+void json::Handler::end_array() { }
+void json::Handler::string(const char *, size_t) { }
+void json::Handler::integer(long long int) { }
+void json::Handler::real(double) { }
+void json::Handler::boolean(bool) { }
+void json::Handler::null() { }
+
+////////////////////////////////////////////////////////////////////////////////
+
+json::Reader::Reader(Handler &handler): line_number(0), _handler(handler),
+	_position(0), _end(0) {
+
+}
+
+const char *json::Reader::parse(const char *begin, const char *end) {
+	_position = begin;
+	_end = end;
+
+	parse_value();
+
+	return _position;
+}
+
+void json::Reader::error(const char *message) const {
+	std::stringstream ss;
+
+	ss << "line " << line_number << ": " << message << "\n before: "
+		<< std::string(_position, std::min< size_t >(31, _end - _position));
+
+	throw std::runtime_error(ss.str());
+}
+
+void json::Reader::skip_whitespace() {
+	while (_position != _end) {
+		char ch = *_position;
+
+		if (ch == '\n') {
+			++line_number;
 		}
 		else if (ch == '#') {
-			in_comment = true;
+			while (_position != _end && *_position != '\n' && *_position != '\r') {
+				++_position;
+			}
+			continue;
 		}
-		else if (!is_whitespace_char(ch)) {
-			reading = false;
+		else if (ch != ' ' && ch != '\t' && ch != '\r') {
+			return;
 		}
-	} while (reading);
-	return ch;
-}
 
-int json::Parser::get_char(std::istream &input) {
-	int ch = input.get();
-	if (ch == '\n') {
-		++line_number;
+		++_position;
 	}
-	return ch;
 }
 
-void json::Parser::putback(std::istream &input, int ch) {
-	if (ch == '\n') {
-		--line_number;
-	}
-	input.putback(ch);
+static bool is_identifier_start(char ch) {
+	return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch == '_');
 }
 
-json::Value *json::Parser::parse_value(std::istream &input) {
-	int ch = get_non_whitespace_char(input);
-	switch (ch) {
+static bool is_identifier_body(char ch) {
+	return is_identifier_start(ch) || (ch >= '0' && ch <= '9');
+}
+
+static bool is_digit(char ch) {
+	return ch >= '0' && ch <= '9';
+}
+
+void json::Reader::parse_value() {
+	skip_whitespace();
+
+	if (_position == _end) {
+		error("json::Reader::parse_value() - unexpected end of input");
+	}
+
+	switch (*_position) {
 		case '{':
-			//std::cout << "parse_value - parsing object..\n";
-			putback(input, ch);
-			return parse_object(input);
+			parse_object();
 			break;
 
 		case '[':
-			//std::cout << "parse_value - parsing array..\n";
-			putback(input, ch);
-			return parse_array(input);
+			parse_array();
 			break;
 
 		case '"':
-			//std::cout << "parse_value - parsing string..\n";
-			putback(input, ch);
-			return parse_string(input);
+			parse_string(false);
 			break;
 
 		default:
-			putback(input, ch);
-			if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch == '_')) {
-				json::String *identifier = parse_identifier(input);
-				if (identifier->as_string() == "true" || identifier->as_string() == "True") {
-					delete identifier;
-					return new Value(Value::True);
-				}
-				else if (identifier->as_string() == "false" || identifier->as_string() == "False") {
-					delete identifier;
-					return new Value(Value::False);
-				}
-				else if (identifier->as_string() == "null") {
-					delete identifier;
-					return new Value(Value::Null);
-				}
-				return identifier;
+			if (is_identifier_start(*_position)) {
+				parse_identifier(false);
 			}
 			else {
-				return parse_number(input);
+				parse_number();
 			}
 	}
-	return 0;
 }
 
-json::Value *json::Parser::parse_array(std::istream &input) {
-	typedef std::deque<int> FastIntVector;
-	
-	FastIntVector denseSequence;
-	
-	Array::ValueVector sequence;
-	enum States {
-		initial,
-		open_bracket,
-		close_bracket,
-		value,
-		comma,
-		exit,
-		invalid
-	};
-	States state = initial;
-	bool isDense = true;
-	
-	do {
-		char ch = get_non_whitespace_char(input);
-		switch (state) {
-			case initial: 
-				{
-					if (ch == '[') {
-						state = value;
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_array() - unexpected character '" << ch << "' expected '['", input);
-					}
-				}
-				break;
-			case value: 
-				{
-					if (ch == ']') {
-						state = exit;
-					}
-					else {
-						putback(input, ch);
-						json::Value *active_value = parse_value(input);
-						if (active_value) {
-							if (active_value->type == Value::Number &&
-								static_cast<Number*>(active_value)->number_type == Number::Integer) {
-								
-								denseSequence.push_back(active_value->as_integer());
-								
-								delete active_value;
-								
-								ch = get_non_whitespace_char(input);
-								if (ch == ']') {
-									state = exit;
-								}
-								else if (ch == ',') {
-									state = value;
-								}
-								else {
-									throw_EXCEPTION_line(line_number, "json::Parser::parse_array() - unexpected character'" << ch << "' expected ','", input);
-								}
-							}
-							else {
-								if (isDense) {
-									isDense = false;
-									
-									for (auto i = denseSequence.begin();
-										i != denseSequence.end(); ++i) {
-										sequence.push_back(new Number(*i));
-									}
-								}
-								
-								sequence.push_back(active_value);
-								ch = get_non_whitespace_char(input);
-								if (ch == ']') {
-									state = exit;
-								}
-								else if (ch == ',') {
-									state = value;
-								}
-								else {
-									throw_EXCEPTION_line(line_number, "json::Parser::parse_array() - unexpected character; expected ','", input);
-								}
-							}
-						}
-						else {
-							throw_EXCEPTION_line(line_number, "json::Parser::parse_array() - failed to parse value", input);
-						}
-					}
-				}
-				break;
-			case exit: 
-			default: {
-				}
-				break;
+void json::Reader::parse_object() {
+	++_position;
+
+	_handler.begin_object();
+
+	while (true) {
+		skip_whitespace();
+
+		if (_position == _end) {
+			error("json::Reader::parse_object() - unexpected end of input");
+		}
+
+		if (*_position == '}') {
+			++_position;
+			break;
+		}
+
+		if (*_position == '"') {
+			parse_string(true);
+		}
+		else if (is_identifier_start(*_position)) {
+			parse_identifier(true);
+		}
+		else {
+			error("json::Reader::parse_object() - unexpected key character found");
+		}
+
+		skip_whitespace();
+
+		if (_position == _end || *_position != ':') {
+			error("json::Reader::parse_object() - expected colon after key string");
+		}
+
+		++_position;
+
+		parse_value();
+
+		skip_whitespace();
+
+		if (_position == _end) {
+			error("json::Reader::parse_object() - unexpected end of input");
+		}
+
+		if (*_position == ',') {
+			++_position;
+		}
+		else if (*_position != '}') {
+			error("json::Reader::parse_object() - unexpected char after value");
 		}
-	} while (state != exit);
-	
-	if (isDense && !denseSequence.empty()) {
-		return new json::DenseArray(json::DenseArray::IntVector(
-			denseSequence.begin(), denseSequence.end()));
-	}
-	else {
-		return new json::Array(sequence);
 	}
+
+	_handler.end_object();
 }
 
-json::Object *json::Parser::parse_object(std::istream &input) {
-	enum States {
-		initial,
-		open_brace,
-		string,
-		identifier,
-		colon,
-		value,
-		comma,
-		close_brace,
-		exit,
-		invalid
-	};
-	String *active_string = 0;
-	Value *active_value = 0;
-	Object::Dictionary dictionary;
-
-	States state = initial;
-	do {
-		int ch = get_non_whitespace_char(input);
-		switch (state) {
-			case initial:
-				{
-					if (ch == '{') {
-						state = open_brace;
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_object() - unexpected character in object", input);
-					}
-				}
-				break;
+void json::Reader::parse_array() {
+	++_position;
 
-			case open_brace:
-				{
-					if (ch == '}') {
-						state = close_brace;
-					}
-					else if (ch == '"') {
-						putback(input, ch);
-						state = string;
-					}
-					else if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch == '_')) {
-						state = identifier;
-						putback(input, ch);
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_object() - unexpected key character found", input);
-					}
-				}
-				break;
+	_handler.begin_array();
 
-			case string:
-				{
-					putback(input, ch);
-					active_string = parse_string(input);
-					if (active_string) {
-						ch = get_non_whitespace_char(input);
-						if (ch == ':') {
-							state = value;
-							break;
-						}
-						else {
-							throw_EXCEPTION_line(line_number, "json::Parser::parse_object() - expected colon after key string", input);
-						}
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_object() - failed to parse key string", input);
-					}
-				}
-				break;
+	while (true) {
+		skip_whitespace();
 
-			case identifier:
-				{
-					putback(input, ch);
-					active_string = parse_identifier(input);
-					if (active_string) {
-						ch = get_non_whitespace_char(input);
-						if (ch == ':') {
-							state = value;
-							break;
-						}
-						else {
-							throw_EXCEPTION_line(line_number, "json::Parser::parse_object() - expected colon after key string", input);
-						}
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_object() - failed to parse key string", input);
-					}
-				}
-				break;
+		if (_position == _end) {
+			error("json::Reader::parse_array() - unexpected end of input");
+		}
 
-			case colon:
-				{
-					putback(input, ch);
-					state = value;
-				}
-				break;
+		if (*_position == ']') {
+			++_position;
+			break;
+		}
 
-			case value:
-				{
-					putback(input, ch);
-					active_value = parse_value(input);
-					if (active_value) {
-						assert(dictionary.count(active_string->value_string) == 0);
-						dictionary[active_string->value_string] = active_value;
-						delete active_string;
-						ch = get_non_whitespace_char(input);
-						if (ch == ',') {
-							state = open_brace;
-						}
-						else if (ch == '}') {
-							state = close_brace;
-						}
-						else {
-							throw_EXCEPTION_line(line_number, "json::Parser::parse_object() - unexpected char after value", input);
-						}
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_object() - failed to parse value", input);
-					}
-				}
-				break;
+		parse_value();
 
-			case comma:
-				{
-					if (ch == '"') {
-						putback(input, ch);
-						state = string;
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_object() - unexpected char after comma", input);
-					}
-				}
-				break;
+		skip_whitespace();
 
-			case close_brace:
-				{
-					putback(input, ch);
-					state = exit;
-				}
-				break;
+		if (_position == _end) {
+			error("json::Reader::parse_array() - unexpected end of input");
+		}
 
-			case exit:
-			case invalid:
-			default:
-				break;
-		};
-	} while (state != exit);
-
-	return new Object(dictionary);
-}
-
-json::Number *json::Parser::parse_number(std::istream &input) {
-	enum States {
-		initial,
-		negativeA,
-		leading_zero,
-		digit1_9,
-		digitA,
-		decimal,
-		digitB,
-		exponent,
-		positiveExponent,
-		negativeExponent,
-		digitC,
-		exit,
-		invalid
-	};
+		if (*_position == ',') {
+			++_position;
+		}
+		else if (*_position != ']') {
+			error("json::Reader::parse_array() - unexpected character; expected ','");
+		}
+	}
 
-	bool positive = true;
-	bool exponentPositive = true;
+	_handler.end_array();
+}
 
-	unsigned long long int part_whole = 0, part_decimal = 0, part_exponent = 0;
-	int digits_whole = 0, digits_decimal = 0, digits_exponent = 0;
+void json::Reader::parse_number() {
+	const char *begin = _position;
 
-	States state = initial;
-	do {
-		int ch = get_char(input);
-		switch (state) {
-			case initial:
-				{
-					if (ch == '-') {
-						state = negativeA;
-					}
-					else if (ch == '0') {
-						state = leading_zero;
-						digits_whole ++;
-					}
-					else if (ch >= '1' && ch <= '9') {
-						state = digit1_9;
-						part_whole = (int)(ch - '0');
-						digits_whole ++;
-					}
-					else if (is_whitespace_char(ch)) {
-						state = initial;
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_number() [initial] - unexpected character found", input);
-					}
-				}
-				break;
-			case negativeA:
-				{
-					positive = false;
-					if (ch == '0') {
-						state = leading_zero;
-						digits_whole ++;
-					}
-					else if (ch >= '1' && ch <= '9') {
-						state = digit1_9;
-						part_whole = (int)(ch - '0');
-						digits_whole ++;
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_number() [negativeA] - unexpected character found", input);
-					}
-				}
-				break;
-			case leading_zero:
-				{
-					if (ch == '.') {
-						state = decimal;
-					}
-					else {
-						putback(input, ch);
-						state = exit;
-					}
-				}
-				break;
-			case digit1_9:
-				{
-					if (ch >= '0' && ch <= '9') {
-						part_whole = part_whole * 10 + (int)(ch - '0');
-						digits_whole ++;
-						state = digitA;
-					}
-					else if (ch == '.') {
-						state = decimal;
-					}
-					else {
-						input.putback(ch);
-						state = exit;
-					}
-				}
-				break;
-			case digitA:
-				{
-					if (ch >= '0' && ch <= '9') {
-						part_whole = part_whole * 10 + (int)(ch - '0');
-						digits_whole ++;
-						state = digitA;
-					}
-					else if (ch == '.') {
-						state = decimal;
-					}
-					else if (ch == 'e' || ch == 'E') {
-						state = exponent;
-					}
-					else {
-						input.putback(ch);
-						state = exit;
-					}
-				}
-				break;
-			case decimal:
-				{
-					if (ch >= '0' && ch <= '9') {
-						state = digitB;
-						part_decimal = (int)(ch - '0');
-						digits_decimal ++;
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_number() [decimal] - unexpected character found", input);
-					}
-				}
-				break;
-			case digitB:
-				{
-					if (ch >= '0' && ch <= '9') {
-						state = digitB;
-						part_decimal = part_decimal * 10 + (int)(ch - '0');
-						digits_decimal ++;
-					}
-					else if (ch == 'e' || ch == 'E') {
-						state = exponent;
-					}
-					else {
-						putback(input, ch);
-						state = exit;
-					}
-				}
-				break;
-			case exponent:
-				{
-					if (ch == '+') {
-						state = positiveExponent;
-					}
-					else if (ch == '-') {
-						state = negativeExponent;
-					}
-					else if (ch >= '0' && ch <= '9') {
-						part_exponent = (int)(ch - '0');
-						digits_exponent ++;
-						state = digitC;
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_number() [exponent] - unexpected character found", input);
-					}
-				}
-				break;
-			case positiveExponent:
-				{
-					if (ch >= '0' && ch <= '9') {
-						part_exponent = (int)(ch - '0');
-						digits_exponent ++;
-						state = digitC;
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_number() [positiveExponent] - unexpected character found", input);
-					}
-				}
-				break;
-			case negativeExponent:
-				{
-					exponentPositive = false;
-					if (ch >= '0' && ch <= '9') {
-						part_exponent = (int)(ch - '0');
-						digits_exponent ++;
-						state = digitC;
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_number() [negativeExponent] - unexpected character found", input);
-					}
-				}
-				break;
-			case digitC:
-				{
-					if (ch >= '0' && ch <= '9') {
-						state = digitC;
-						part_exponent = part_exponent * 10 + (int)(ch - '0');
-						digits_exponent ++;
-					}
-					else {
-						putback(input, ch);
-						state = exit;
-					}
-				}
-				break;
-			default:
-				break;
-		}
-	} while (state != exit);
+	bool negative = false;
+	bool integral = true;
+	bool overflow = false;
 
-	Number *number = new Number;
-	if (digits_exponent == 0 && digits_decimal == 0) {
-		number->number_type = Number::Integer;
-		number->value_integer = (positive ? part_whole : -part_whole);
-		number->value_real = (double)number->value_integer;
+	unsigned long long int whole = 0;
+
+	if (_position != _end && *_position == '-') {
+		negative = true;
+		++_position;
+	}
+
+	if (_position == _end || !is_digit(*_position)) {
+		error("json::Reader::parse_number() - unexpected character found");
+	}
+
+	if (*_position == '0') {
+		++_position;
 	}
 	else {
-		double exponential = 1.0;
-		number->number_type = Number::Real;
-		number->value_real = (positive ? 1 : -1) * (
-			(double)part_whole + (double)part_decimal / pow(10.0, digits_decimal));
-		if (digits_exponent) {
-			exponential = pow(10.0, (double)part_exponent);
-			if (!exponentPositive) {
-				exponential = 1.0 / exponential;
+		// a negative integer may be one larger than the largest positive one
+		unsigned long long int limit = negative ?
+			(unsigned long long int)LLONG_MAX + 1 : LLONG_MAX;
+
+		while (_position != _end && is_digit(*_position)) {
+			unsigned int digit = *_position - '0';
+
+			if (whole > (limit - digit) / 10) {
+				overflow = true;
 			}
-			number->value_real *= exponential;
+			else {
+				whole = whole * 10 + digit;
+			}
+
+			++_position;
 		}
-		number->value_integer = (unsigned long long int)number->value_real;
 	}
 
-	return number;
-}
-/*
-static bool is_unicode_character(int ch) {
-	if (ch != '"') {
-		return false;
+	if (_position != _end && *_position == '.') {
+		integral = false;
+		++_position;
+
+		if (_position == _end || !is_digit(*_position)) {
+			error("json::Reader::parse_number() [decimal] - unexpected character found");
+		}
+
+		while (_position != _end && is_digit(*_position)) {
+			++_position;
+		}
 	}
-	if (ch != '\\') {
-		return false;
+
+	if (_position != _end && (*_position == 'e' || *_position == 'E')) {
+		integral = false;
+		++_position;
+
+		if (_position != _end && (*_position == '+' || *_position == '-')) {
+			++_position;
+		}
+
+		if (_position == _end || !is_digit(*_position)) {
+			error("json::Reader::parse_number() [exponent] - unexpected character found");
+		}
+
+		while (_position != _end && is_digit(*_position)) {
+			++_position;
+		}
+	}
+
+	if (integral) {
+		if (overflow) {
+			error("json::Reader::parse_number() - integer does not fit in 64 bits");
+		}
+
+		_handler.integer(negative ? (long long int)(0 - whole) : (long long int)whole);
+		return;
+	}
+
+	// the buffer may not be terminated, so convert a copy
+	char digits[64];
+
+	size_t length = _position - begin;
+
+	if (length >= sizeof(digits)) {
+		error("json::Reader::parse_number() - number is too long");
+	}
+
+	std::memcpy(digits, begin, length);
+	digits[length] = 0;
+
+	errno = 0;
+
+	double value = std::strtod(digits, 0);
+
+	if (errno == ERANGE && (value == HUGE_VAL || value == -HUGE_VAL)) {
+		error("json::Reader::parse_number() - number is out of range");
 	}
-	return true;
+
+	_handler.real(value);
 }
-*/
+
+static bool is_hex_digit(char ch) {
+	return is_digit(ch) || (ch >= 'a' && ch <= 'f') || (ch >= 'A' && ch <= 'F');
+}
+
 static char char_to_hex_digit(int ch) {
 	if (ch >= '0' && ch <= '9') {
 		return (char)(ch - '0');
@@ -895,189 +644,500 @@ static char char_to_hex_digit(int ch) {
 	return 0;
 }
 
-json::String *json::Parser::parse_identifier(std::istream &input) {
-	enum States {
-		initial,
-		body_char,
-		exit,
-		invalid
-	};
-	std::stringstream ss;
-	States state = initial;
-
-	do {
-		int ch = get_char(input);
-		switch (state) {
-			case initial:
-				if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch == '_')) {
-					state = body_char;
-					ss.write((const char *)&ch, (ch < 256 ? 1 : 2));
-				}
-				else {
-					putback(input, ch);
-					state = exit;
-				}
-				break;
-			case body_char:
-				if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch == '_') ||
-					(ch >= '0' && ch <= '9')) {
-					state = body_char;
-					ss.write((const char *)&ch, (ch < 256 ? 1 : 2));
-				}
-				else {
-					putback(input, ch);
-					state = exit;
-				}
-				break;
-			default:
-				throw_EXCEPTION_line(line_number, "json::Parser::parse_identifier() - invalid state", input);
+static void append_utf8(std::string &string, unsigned int code_point) {
+	if (code_point < 0x80) {
+		string.push_back((char)code_point);
+	}
+	else if (code_point < 0x800) {
+		string.push_back((char)(0xc0 | (code_point >> 6)));
+		string.push_back((char)(0x80 | (code_point & 0x3f)));
+	}
+	else {
+		string.push_back((char)(0xe0 | (code_point >> 12)));
+		string.push_back((char)(0x80 | ((code_point >> 6) & 0x3f)));
+		string.push_back((char)(0x80 | (code_point & 0x3f)));
+	}
+}
+
+void json::Reader::parse_string(bool is_key) {
+	++_position;
+
+	const char *begin = _position;
+
+	// strings without escapes are passed straight out of the buffer
+	while (_position != _end && *_position != '"' && *_position != '\\') {
+		if (*_position == '\n') {
+			++line_number;
 		}
-	} while (state != exit);
-	return new String(ss.str());
-}
-
-json::String *json::Parser::parse_string(std::istream &input) {
-	enum States {
-		initial,
-		leading_quote,
-		trailing_quote,
-		unicode_character,
-		backslash,
-		u0, u1, u2, u3,
-		exit,
-		invalid
-	};
+		++_position;
+	}
 
-	std::stringstream ss;
-	States state = initial;
-	char hex[5];
-	do {
-		int ch = get_char(input);
-		switch (state) {
-			case initial:
-				{
-					if (ch == '"') {
-						state = leading_quote;
-					}
-					else {
-						throw_EXCEPTION_line(line_number, "json::Parser::parse_string() - unexpected character", input);
-					}
-				}
-				break;
+	if (_position == _end) {
+		error("json::Reader::parse_string() - unterminated string");
+	}
 
-			case leading_quote:
-				{
-					if (ch == '"') {
-						state = exit;
-					}
-					else if (ch == '\\') {
-						state = backslash;
-					}
-					else {
-						state = leading_quote;
-						ss.write((const char *)&ch, (ch < 256 ? 1 : 2));
-					}
-				}
-				break;
+	const char *data = begin;
+	size_t length = _position - begin;
+
+	if (*_position == '\\') {
+		_scratch.assign(begin, _position);
+
+		while (_position != _end && *_position != '"') {
+			char ch = *_position++;
+
+			if (ch == '\n') {
+				++line_number;
+			}
+
+			if (ch != '\\') {
+				_scratch.push_back(ch);
+				continue;
+			}
 
-			case trailing_quote:
-				{
-					putback(input, ch);
-					state = exit;
-				}
+			if (_position == _end) {
 				break;
-				
-			case backslash:
-				{
-					switch (ch) {
-					case '"':
-						ss << "\"";
-						state = leading_quote;
-						break;
-					case '\\':
-						ss << "\\";
-						state = leading_quote;
-						break;
-					case '/':
-						ss << "/";
-						state = leading_quote;
-						break;
-					case 'b':
-						ss << "\b";
-						state = leading_quote;
-						break;
-					case 'f':
-						ss << "\f";
-						state = leading_quote;
-						break;
-					case 'n':
-						ss << "\n";
-						state = leading_quote;
-						break;
-					case 'r':
-						ss << "\r";
-						state = leading_quote;
-						break;
-					case 't':
-						ss << "\t";
-						state = leading_quote;
-						break;
-					case 'u':
-						state = u0;
-						break;
+			}
+
+			ch = *_position++;
+
+			switch (ch) {
+				case '"':  _scratch.push_back('"');  break;
+				case '\\': _scratch.push_back('\\'); break;
+				case '/':  _scratch.push_back('/');  break;
+				case 'b':  _scratch.push_back('\b'); break;
+				case 'f':  _scratch.push_back('\f'); break;
+				case 'n':  _scratch.push_back('\n'); break;
+				case 'r':  _scratch.push_back('\r'); break;
+				case 't':  _scratch.push_back('\t'); break;
+				case 'u':
+					{
+						if (_end - _position < 4) {
+							error("json::Reader::parse_string() - truncated unicode escape");
+						}
+
+						unsigned int code_point = 0;
+
+						for (int i = 0; i < 4; ++i) {
+							if (!is_hex_digit(*_position)) {
+								error("json::Reader::parse_string() - invalid unicode escape");
+							}
+
+							code_point = (code_point << 4) | char_to_hex_digit(*_position++);
+						}
+
+						append_utf8(_scratch, code_point);
 					}
-				}
-				break;
+					break;
+				default:
+					error("json::Reader::parse_string() - invalid escape sequence");
+			}
+		}
 
-			case u0:
-				{
-					hex[0] = char_to_hex_digit(ch);
-					state = u1;
-				}
-				break;
+		if (_position == _end) {
+			error("json::Reader::parse_string() - unterminated string");
+		}
 
-			case u1:
-				{
-					hex[1] = char_to_hex_digit(ch);
-					state = u2;
-				}
-				break;
+		data = _scratch.data();
+		length = _scratch.size();
+	}
 
-			case u2:
-				{
-					hex[2] = char_to_hex_digit(ch);
-					state = u3;
-				}
-				break;
+	++_position;
 
-			case u3:
-				{
-					int hex_value = 0;
-					hex[3] = char_to_hex_digit(ch);
-					hex[4] = 0;
-					state = leading_quote;
-					hex[0] += (hex[1] << 8);
-					hex[1] = (hex[3] << 8) + hex[1];
-					hex_value = (int)hex[0] + ((int)hex[1] << 8);
-					ss.write(hex, (hex_value > 127 ? 2 : 1));
-				}
-				break;
+	if (is_key) {
+		_handler.key(data, length);
+	}
+	else {
+		_handler.string(data, length);
+	}
+}
 
-			case exit:
-				{
-				}
-				break;
+void json::Reader::parse_identifier(bool is_key) {
+	const char *begin = _position;
 
-			default:
-				break;
+	while (_position != _end && is_identifier_body(*_position)) {
+		++_position;
+	}
+
+	size_t length = _position - begin;
+
+	if (is_key) {
+		_handler.key(begin, length);
+		return;
+	}
+
+	std::string identifier(begin, length);
+
+	if (identifier == "true" || identifier == "True") {
+		_handler.boolean(true);
+	}
+	else if (identifier == "false" || identifier == "False") {
+		_handler.boolean(false);
+	}
+	else if (identifier == "null") {
+		_handler.null();
+	}
+	else {
+		_handler.string(begin, length);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace json {
+
+/*!
+	Builds a tree from Reader callbacks, either on the heap (owned by the
+	caller) or in an arena (owned by a Document)
+*/
+class TreeBuilder : public Handler {
+public:
+	TreeBuilder(Arena *arena): _arena(arena), _depth(0), _root(0) {
+
+	}
+
+	~TreeBuilder() {
+		// only non-empty if parsing threw
+		for (size_t level = 0; level < _depth; ++level) {
+			Frame &frame = _frames[level];
+
+			destroy(frame.object);
+
+			for (Array::ValueVector::iterator value = frame.values.begin();
+				value != frame.values.end(); ++value) {
+				destroy(*value);
+			}
+		}
+
+		destroy(_root);
+	}
+
+public:
+	//! hands the tree to the caller
+	Value *release() {
+		Value *root = _root;
+		_root = 0;
+		return root;
+	}
+
+	//! destroys a tree, without freeing memory if it is in an arena
+	static void destroy(Value *value, bool in_arena) {
+		if (!value) {
+			return;
+		}
+
+		if (!in_arena) {
+			delete value;
+			return;
+		}
+
+		if (value->type == Value::Object) {
+			Object *object = static_cast<Object *>(value);
+
+			for (Object::iterator entry = object->begin(); entry != object->end(); ++entry) {
+				destroy(entry->second, true);
+			}
+
+			object->dictionary.clear();
+		}
+		else if (value->type == Value::Array) {
+			Array *array = static_cast<Array *>(value);
+
+			for (Array::iterator element = array->begin(); element != array->end(); ++element) {
+				destroy(*element, true);
+			}
+
+			array->sequence.clear();
+		}
+
+		value->~Value();
+	}
+
+public:
+	virtual void begin_object() {
+		Frame &frame = push();
+
+		frame.object = create<Object>();
+	}
+
+	virtual void key(const char *data, size_t length) {
+		_frames[_depth - 1].key.assign(data, length);
+	}
+
+	virtual void end_object() {
+		Frame &frame = _frames[_depth - 1];
+
+		Value *object = frame.object;
+		frame.object = 0;
+
+		--_depth;
+
+		add(object);
+	}
+
+	virtual void begin_array() {
+		push();
+	}
+
+	virtual void end_array() {
+		Frame &frame = _frames[_depth - 1];
+
+		Value *array = 0;
+
+		// all-integer arrays are stored densely
+		if (frame.dense && !frame.integers.empty()) {
+			DenseArray *dense = create<DenseArray>();
+			dense->sequence.assign(frame.integers.begin(), frame.integers.end());
+			array = dense;
+		}
+		else {
+			Array *sparse = create<Array>();
+			sparse->sequence.swap(frame.values);
+			array = sparse;
+		}
+
+		--_depth;
+
+		add(array);
+	}
+
+	virtual void string(const char *data, size_t length) {
+		add(create<String>(std::string(data, length)));
+	}
+
+	virtual void integer(long long int value) {
+		if (_depth > 0) {
+			Frame &frame = _frames[_depth - 1];
+
+			if (!frame.object && frame.dense) {
+				frame.integers.push_back((int)value);
+				return;
+			}
+		}
+
+		add(create_integer(value));
+	}
+
+	virtual void real(double value) {
+		Number *number = create<Number>();
+
+		number->number_type = Number::Real;
+		number->value_real = value;
+		number->value_integer = (unsigned long long int)value;
+
+		add(number);
+	}
+
+	virtual void boolean(bool value) {
+		add(create<Value>(value ? Value::True : Value::False));
+	}
+
+	virtual void null() {
+		add(create<Value>(Value::Null));
+	}
+
+private:
+	class Frame {
+	public:
+		Object *object;
+		std::string key;
+
+		bool dense;
+		DenseArray::IntVector integers;
+		Array::ValueVector values;
+	};
+
+	typedef std::vector< Frame > FrameVector;
+
+private:
+	Frame &push() {
+		if (_depth == _frames.size()) {
+			_frames.push_back(Frame());
+		}
+
+		// frames are reused, so their vectors keep their capacity
+		Frame &frame = _frames[_depth++];
+
+		frame.object = 0;
+		frame.dense = true;
+		frame.integers.clear();
+		frame.values.clear();
+
+		return frame;
+	}
+
+	void add(Value *value) {
+		if (_depth == 0) {
+			_root = value;
+			return;
+		}
+
+		Frame &frame = _frames[_depth - 1];
+
+		if (frame.object) {
+			Value *&slot = frame.object->dictionary[frame.key];
+
+			assert(slot == 0);
+
+			slot = value;
+			return;
 		}
-	} while (state != exit);
 
-	return new String(ss.str());
+		if (frame.dense) {
+			frame.dense = false;
+
+			for (DenseArray::IntVector::iterator integer = frame.integers.begin();
+				integer != frame.integers.end(); ++integer) {
+				frame.values.push_back(create_integer(*integer));
+			}
+		}
+
+		frame.values.push_back(value);
+	}
+
+	Number *create_integer(long long int value) {
+		Number *number = create<Number>();
+
+		number->number_type = Number::Integer;
+		number->value_integer = (unsigned long long int)value;
+		number->value_real = (double)value;
+
+		return number;
+	}
+
+	template< typename T, typename... Args >
+	T *create(Args&&... args) {
+		if (!_arena) {
+			return new T(std::forward<Args>(args)...);
+		}
+
+		return new (_arena->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+	}
+
+	void destroy(Value *value) {
+		destroy(value, _arena != 0);
+	}
+
+private:
+	Arena *_arena;
+
+	FrameVector _frames;
+	size_t _depth;
+
+	Value *_root;
+};
+
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
+json::Document::Document(): _root(0) {
+
+}
+
+json::Document::~Document() {
+	clear();
+}
+
+json::Value *json::Document::parse(const char *data, size_t size) {
+	clear();
+
+	TreeBuilder builder(&_arena);
+	Reader reader(builder);
+
+	reader.parse(data, data + size);
+
+	_root = builder.release();
+
+	return _root;
+}
+
+json::Value *json::Document::parse(const std::string &text) {
+	return parse(text.data(), text.size());
+}
+
+json::Value *json::Document::load(const std::string &path) {
+	MemoryMappedFile file(path);
+
+	return parse(file.data(), file.size());
+}
+
+json::Value *json::Document::root() const {
+	return _root;
+}
+
+void json::Document::clear() {
+	TreeBuilder::destroy(_root, true);
+
+	_root = 0;
+
+	_arena.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+json::Parser::Parser(): line_number(0) {
+
+}
+
+json::Parser::~Parser() {
+
+}
+
+json::Array *json::Parser::parse(std::istream &input) {
+	return 0;
+}
+
+json::Value *json::Parser::parse_value(std::istream &input) {
+	std::istream::pos_type start = input.tellg();
+
+	std::stringstream buffer;
+
+	buffer << input.rdbuf();
+
+	std::string text = buffer.str();
+
+	TreeBuilder builder(0);
+	Reader reader(builder);
+
+	reader.line_number = line_number;
+
+	const char *end = reader.parse(text.data(), text.data() + text.size());
+
+	line_number = reader.line_number;
+
+	if (start != std::istream::pos_type(-1)) {
+		input.clear();
+		input.seekg(start + std::streamoff(end - text.data()));
+	}
+
+	return builder.release();
+}
+
+json::Value *json::Parser::parse_array(std::istream &input) {
+	Value *value = parse_value(input);
+
+	if (value->type != Value::Array && value->type != Value::DenseArray) {
+		delete value;
+		throw EXCEPTION("json::Parser::parse_array() - expected '['");
+	}
+
+	return value;
+}
+
+json::Object *json::Parser::parse_object(std::istream &input) {
+	Value *value = parse_value(input);
+
+	if (value->type != Value::Object) {
+		delete value;
+		throw EXCEPTION("json::Parser::parse_object() - expected '{'");
+	}
+
+	return static_cast<Object *>(value);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+
 json::Emitter::Emitter(): use_tabs(true), indent_size(1) {
 
 }
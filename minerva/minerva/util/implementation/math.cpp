@@ -9,6 +9,7 @@
 
 // Standard Library Includes
 #include <utility>
+#include <algorithm>
 
 namespace minerva
 {
@@ -78,6 +79,22 @@ void getNearestToSquareFactors(size_t& factor1, size_t& factor2, size_t number)
 	}
 }
 
+double getPercentile(std::vector<double> values, double percentile)
+{
+	if(values.empty())
+	{
+		return 0.0;
+	}
+	
+	size_t position = (size_t)((percentile / 100.0) * (values.size() - 1) + 0.5);
+	
+	position = std::min(position, values.size() - 1);
+	
+	std::nth_element(values.begin(), values.begin() + position, values.end());
+	
+	return values[position];
+}
+
 }
 
 }
@@ -9,6 +9,12 @@
 // Standard Library Includes
 #include <string>
 #include <sstream>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <functional>
+#include <type_traits>
+#include <stdexcept>
 
 namespace minerva
 {
@@ -16,8 +22,13 @@ namespace minerva
 namespace util
 {
 
+class KnobBase;
+
 class KnobDatabase
 {
+public:
+	typedef std::pair<std::string, std::string> StringPair;
+	typedef std::vector<StringPair> StringPairVector;
 
 public:
 	static void addKnob(const std::string& name, const std::string& value);
@@ -37,8 +48,195 @@ public:
 
 public:	
 	static std::string getKnobValueAsString(const std::string& knobname);
+
+public:
+	/*! \brief Knobs that were set but never declared or looked up, each
+		paired with the closest known knob name (empty if nothing is close).
+	*/
+	static StringPairVector getUnrecognizedKnobs();
+
+public:
+	/*! \brief Called by Knob handles, which must outlive their registration */
+	static void registerKnob(KnobBase* knob);
+	static void unregisterKnob(KnobBase* knob);
+
+};
+
+/*! \brief The untyped part of a Knob, updated by the database on changes */
+class KnobBase
+{
+public:
+	typedef std::function<void()> Callback;
+
+public:
+	KnobBase(const std::string& name, const std::string& description);
+	virtual ~KnobBase();
+
+public:
+	KnobBase(const KnobBase&) = delete;
+	KnobBase& operator=(const KnobBase&) = delete;
+
+public:
+	const std::string& name() const;
+	const std::string& description() const;
+
+public:
+	/*! \brief Was the knob given a value, rather than using its default? */
+	bool isSet() const;
+
+public:
+	/*! \brief Call back after every change (from the setting thread) */
+	void onChange(const Callback& callback);
+
+public:
+	/*! \brief Re-parse the value from the database, throws if malformed */
+	virtual void update(const std::string* value) = 0;
+
+	/*! \brief Run the change callbacks */
+	void notify();
+
+protected:
+	template<typename T>
+	static T parse(const std::string& name, const std::string& value);
+
+protected:
+	std::atomic<bool> _isSet;
+
+private:
+	std::string _name;
+	std::string _description;
+
+private:
+	std::vector<Callback> _callbacks;
+
+};
+
+/*! \brief A typed knob, declared once (usually as a file-scope static) and
+	parsed when it is declared or set.
+
+	Reading it is a relaxed atomic load, so it is safe on hot paths.
+*/
+template<typename T>
+class Knob : public KnobBase
+{
+	static_assert(std::is_arithmetic<T>::value,
+		"Only arithmetic knobs can be read atomically");
+
+public:
+	Knob(const std::string& name, const T& defaultValue,
+		const std::string& description = "")
+	: KnobBase(name, description), _defaultValue(defaultValue),
+	  _value(defaultValue)
+	{
+		KnobDatabase::registerKnob(this);
+	}
+
+	~Knob()
+	{
+		KnobDatabase::unregisterKnob(this);
+	}
+
+public:
+	T get() const
+	{
+		return _value.load(std::memory_order_relaxed);
+	}
+
+	operator T() const
+	{
+		return get();
+	}
+
+public:
+	virtual void update(const std::string* value)
+	{
+		_value.store(value == nullptr ? _defaultValue :
+			parse<T>(name(), *value), std::memory_order_relaxed);
+		_isSet.store(value != nullptr, std::memory_order_relaxed);
+	}
+
+private:
+	T              _defaultValue;
+	std::atomic<T> _value;
+
 };
 
+/*! \brief String knobs are copied under a lock, keep them off hot loops */
+template<>
+class Knob<std::string> : public KnobBase
+{
+public:
+	Knob(const std::string& name, const std::string& defaultValue,
+		const std::string& description = "")
+	: KnobBase(name, description), _defaultValue(defaultValue),
+	  _value(defaultValue)
+	{
+		KnobDatabase::registerKnob(this);
+	}
+
+	~Knob()
+	{
+		KnobDatabase::unregisterKnob(this);
+	}
+
+public:
+	std::string get() const
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		return _value;
+	}
+
+	operator std::string() const
+	{
+		return get();
+	}
+
+public:
+	virtual void update(const std::string* value)
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		_value = value == nullptr ? _defaultValue : *value;
+		_isSet.store(value != nullptr, std::memory_order_relaxed);
+	}
+
+private:
+	std::string        _defaultValue;
+	std::string        _value;
+	mutable std::mutex _mutex;
+
+};
+
+template<typename T>
+T KnobBase::parse(const std::string& name, const std::string& value)
+{
+	std::stringstream stream(value);
+
+	T result = 0;
+
+	stream >> result;
+
+	if(stream.fail() || !(stream >> std::ws).eof())
+	{
+		throw std::runtime_error("Invalid value '" + value +
+			"' for knob '" + name + "'.");
+	}
+
+	return result;
+}
+
+template<>
+inline bool KnobBase::parse<bool>(const std::string& name,
+	const std::string& value)
+{
+	if(value == "1" || value == "true"  || value == "True")  return true;
+	if(value == "0" || value == "false" || value == "False") return false;
+
+	throw std::runtime_error("Invalid value '" + value +
+		"' for knob '" + name + "'.");
+}
+
 template<typename T>
 T KnobDatabase::getKnobValue(const std::string& knobname)
 {
@@ -0,0 +1,49 @@
+/*	\file   MemoryMappedFile.h
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The header file for the MemoryMappedFile class.
+*/
+
+#pragma once
+
+// Standard Library Includes
+#include <string>
+#include <cstddef>
+
+namespace minerva
+{
+
+namespace util
+{
+
+/*! \brief A read-only mapping of an entire file into memory. */
+class MemoryMappedFile
+{
+public:
+	explicit MemoryMappedFile(const std::string& path);
+	~MemoryMappedFile();
+
+public:
+	MemoryMappedFile(const MemoryMappedFile&) = delete;
+	MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+public:
+	/*! \brief Get a pointer to the first byte of the file */
+	const char* data() const;
+	/*! \brief Get the size of the file in bytes */
+	size_t size() const;
+
+public:
+	const std::string& path() const;
+
+private:
+	std::string _path;
+	const char* _data;
+	size_t      _size;
+
+};
+
+}
+
+}
+
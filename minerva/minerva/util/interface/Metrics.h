@@ -0,0 +1,198 @@
+/*	\file   Metrics.h
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The header file for the Metrics registry and metric classes.
+*/
+
+#pragma once
+
+// Standard Library Includes
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <ostream>
+#include <algorithm>
+#include <cstdint>
+
+namespace minerva
+{
+
+namespace util
+{
+
+/*! \brief Atomically add to a double (C++11 has no fetch_add for it) */
+inline void atomicAdd(std::atomic<double>& target, double value)
+{
+	double current = target.load(std::memory_order_relaxed);
+
+	while(!target.compare_exchange_weak(current, current + value,
+		std::memory_order_relaxed))
+	{
+
+	}
+}
+
+/*! \brief A value that only goes up, e.g. samples processed */
+class Counter
+{
+public:
+	Counter()
+	: _value(0.0)
+	{
+
+	}
+
+public:
+	void increment(double value = 1.0)
+	{
+		atomicAdd(_value, value);
+	}
+
+	double value() const
+	{
+		return _value.load(std::memory_order_relaxed);
+	}
+
+private:
+	std::atomic<double> _value;
+
+};
+
+/*! \brief A value that is set to the latest observation, e.g. queue depth */
+class Gauge
+{
+public:
+	Gauge()
+	: _value(0.0)
+	{
+
+	}
+
+public:
+	void set(double value)
+	{
+		_value.store(value, std::memory_order_relaxed);
+	}
+
+	void add(double value)
+	{
+		atomicAdd(_value, value);
+	}
+
+	double value() const
+	{
+		return _value.load(std::memory_order_relaxed);
+	}
+
+private:
+	std::atomic<double> _value;
+
+};
+
+/*! \brief Counts observations into fixed buckets, e.g. latencies */
+class Histogram
+{
+public:
+	typedef std::vector<double> BucketVector;
+
+public:
+	/*! \brief Buckets are the upper bounds, an implicit +Inf bucket is added */
+	explicit Histogram(const BucketVector& buckets)
+	: _buckets(buckets), _counts(new std::atomic<uint64_t>[buckets.size() + 1]),
+	  _sum(0.0), _count(0)
+	{
+		std::sort(_buckets.begin(), _buckets.end());
+
+		for(size_t i = 0; i <= _buckets.size(); ++i)
+		{
+			_counts[i].store(0, std::memory_order_relaxed);
+		}
+	}
+
+public:
+	void observe(double value)
+	{
+		size_t bucket = std::lower_bound(_buckets.begin(), _buckets.end(),
+			value) - _buckets.begin();
+
+		_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+		_count.fetch_add(1, std::memory_order_relaxed);
+
+		atomicAdd(_sum, value);
+	}
+
+public:
+	const BucketVector& buckets() const
+	{
+		return _buckets;
+	}
+
+	/*! \brief The observations in a bucket (not cumulative) */
+	uint64_t bucketCount(size_t bucket) const
+	{
+		return _counts[bucket].load(std::memory_order_relaxed);
+	}
+
+	double sum() const
+	{
+		return _sum.load(std::memory_order_relaxed);
+	}
+
+	uint64_t count() const
+	{
+		return _count.load(std::memory_order_relaxed);
+	}
+
+public:
+	/*! \brief Exponential buckets from 100us to about 100s */
+	static BucketVector getDefaultLatencyBuckets();
+
+private:
+	BucketVector                             _buckets;
+	std::unique_ptr<std::atomic<uint64_t>[]> _counts;
+	std::atomic<double>                      _sum;
+	std::atomic<uint64_t>                    _count;
+
+};
+
+/*! \brief The process-wide registry of named metrics.
+
+	Metrics are registered once and never removed, so callers keep the
+	returned reference (typically in a file-scope static) and update it
+	with a few relaxed atomic operations.
+
+	Knobs:
+		Metrics::Port            - serve the text dump over HTTP on localhost
+		Metrics::Path            - periodically write the text dump here
+		Metrics::IntervalSeconds - how often to write Metrics::Path
+*/
+class Metrics
+{
+public:
+	static Counter& getCounter(const std::string& name,
+		const std::string& help);
+	static Gauge& getGauge(const std::string& name,
+		const std::string& help);
+	static Histogram& getHistogram(const std::string& name,
+		const std::string& help,
+		const Histogram::BucketVector& buckets =
+			Histogram::getDefaultLatencyBuckets());
+
+public:
+	/*! \brief Write all metrics in the Prometheus text exposition format */
+	static void write(std::ostream& stream);
+
+public:
+	/*! \brief Start the exporters selected by the knobs, if not started */
+	static void startExporting();
+
+	/*! \brief Stop the exporters (also done at exit) */
+	static void stopExporting();
+
+};
+
+}
+
+}
+
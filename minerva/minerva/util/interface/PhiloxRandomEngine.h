@@ -0,0 +1,65 @@
+/*! \file   PhiloxRandomEngine.h
+	\author Gregory Diamos <gregory.diamos@gmail.com>
+	\date   Sunday October 18, 2026
+	\brief  The header file for the PhiloxRandomEngine class.
+*/
+
+#pragma once
+
+// Standard Library Includes
+#include <cstdint>
+#include <cstddef>
+
+namespace minerva
+{
+
+namespace util
+{
+
+/*! \brief The Philox4x32-10 counter based random number generator.
+
+	Every value is a pure function of (seed, stream, position), so separate
+	streams can be generated in parallel, and any position can be reached
+	in constant time, with results that do not depend on the schedule.
+	
+	It satisfies the standard UniformRandomBitGenerator requirements.
+*/
+class PhiloxRandomEngine
+{
+public:
+	typedef uint32_t result_type;
+
+public:
+	explicit PhiloxRandomEngine(uint64_t seed = 0, uint64_t stream = 0);
+
+public:
+	result_type operator()();
+
+	/*! \brief Skip ahead, in constant time */
+	void discard(uint64_t values);
+
+public:
+	/*! \brief A uniform value in [min, max) with 24 bits of precision */
+	float uniform(float min, float max);
+
+public:
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return UINT32_MAX; }
+
+private:
+	void _generate();
+
+private:
+	uint32_t _key[2];
+	uint32_t _counter[4];
+
+private:
+	uint32_t _values[4];
+	size_t   _index;
+
+};
+
+}
+
+}
+
@@ -0,0 +1,134 @@
+/*	\file   Profiler.h
+	\date   Sunday October 18, 2026
+	\author Gregory Diamos <solusstultus@gmail.com>
+	\brief  The header file for the Profiler and ProfilerScope classes.
+*/
+
+#pragma once
+
+// Standard Library Includes
+#include <string>
+#include <ostream>
+#include <atomic>
+#include <chrono>
+
+// Forward Declarations
+namespace minerva { namespace util { class ProfileNode; } }
+
+namespace minerva
+{
+
+namespace util
+{
+
+/*! \brief A hierarchical profiler for wall time, FLOPs, and allocations.
+
+	Scopes nest per thread and are aggregated by their path from the root.
+
+	Knobs:
+		Profiler::Enable      - record scopes (default off)
+		Profiler::ReportPath  - write the report here at exit, or stdout
+		Profiler::TracePath   - also write a Chrome trace-event file at exit
+*/
+class Profiler
+{
+public:
+	/*! \brief Is profiling enabled? Reads the knobs on the first call. */
+	static bool isEnabled()
+	{
+		int state = _state.load(std::memory_order_relaxed);
+
+		if(state == Unknown)
+		{
+			state = _readKnobs();
+		}
+
+		return state == Enabled;
+	}
+
+	/*! \brief Override the knob */
+	static void enable(bool enabled = true);
+
+public:
+	/*! \brief Attribute an allocation to the scopes open on this thread */
+	static void recordAllocation(size_t bytes);
+
+public:
+	/*! \brief Write the aggregated tree of all threads as a table */
+	static void writeReport(std::ostream& stream);
+
+	/*! \brief Write all recorded events in Chrome trace-event JSON */
+	static void writeChromeTrace(std::ostream& stream);
+
+	/*! \brief Discard everything recorded so far (threads must be idle) */
+	static void reset();
+
+private:
+	enum State
+	{
+		Unknown,
+		Disabled,
+		Enabled
+	};
+
+private:
+	static int _readKnobs();
+
+private:
+	static std::atomic<int> _state;
+
+};
+
+/*! \brief Times the enclosing block as a child of the open scope, if any.
+
+	The name must outlive the program (a string literal), since it is kept
+	by pointer.
+*/
+class ProfilerScope
+{
+public:
+	explicit ProfilerScope(const char* name, size_t floatingPointOperations = 0)
+	: _node(nullptr)
+	{
+		if(Profiler::isEnabled())
+		{
+			_begin(name, floatingPointOperations);
+		}
+	}
+
+	~ProfilerScope()
+	{
+		if(_node != nullptr)
+		{
+			_end();
+		}
+	}
+
+public:
+	ProfilerScope(const ProfilerScope&) = delete;
+	ProfilerScope& operator=(const ProfilerScope&) = delete;
+
+public:
+	/*! \brief Add work that was only known after the scope was opened */
+	void addFloatingPointOperations(size_t operations);
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+private:
+	void _begin(const char* name, size_t floatingPointOperations);
+	void _end();
+
+private:
+	ProfileNode*      _node;
+	ProfileNode*      _parent;
+	Clock::time_point _start;
+	size_t            _floatingPointOperations;
+	size_t            _bytesAtStart;
+
+};
+
+}
+
+}
+
@@ -10,6 +10,7 @@
 // Standard Library Includes
 #include <string>
 #include <vector>
+#include <utility>
 
 namespace minerva
 {
@@ -23,8 +24,15 @@ class TarArchive
 {
 public:
 	typedef std::vector<std::string> StringVector;
+	typedef std::pair<const void*, size_t> Buffer;
+	typedef std::vector<Buffer> BufferVector;
 
 public:
+	/*! \brief Open an archive, the mode is one of r:gz, w:gz or w:zst.
+	
+		Reading detects the compression from the file contents.
+		Writing with w:zst compresses on TarArchive::CompressionThreads threads.
+	*/
 	TarArchive(const std::string& path, const std::string& mode = "r:gz");
 	~TarArchive();
 
@@ -39,6 +47,8 @@ public:
 public:
 	/*! \brief Add a file to the archive */
 	void addFile(const std::string& name, std::istream& file);
+	/*! \brief Add a file made of in-memory buffers, without copying them */
+	void addFile(const std::string& name, const BufferVector& buffers);
 	
 	/*! \brief Extract a file from the archive */
 	void extractFile(const std::string& name, std::ostream& file);
@@ -27,6 +27,7 @@ public:
 	
 public:
 	static const int OK = 0;
+	static const int Failed = -25;
 	static const unsigned int RegularFile = 0100000;
 	
 public:
@@ -50,7 +51,11 @@ public:
 	static int archive_write_free(archive*);
 	
 	static int archive_write_set_compression_gzip(archive* );
+	static int archive_write_add_filter_zstd(archive* );
+	static int archive_write_set_filter_option(archive* , const char* module,
+		const char* option, const char* value);
 	static int archive_write_set_format_pax_restricted(archive* );
+	static int archive_write_set_bytes_in_last_block(archive* , int bytes);
 	static int archive_write_open_FILE(archive* , FILE* file);
 	
 	static int archive_write_header(archive*, archive_entry*);
@@ -102,7 +107,11 @@ private:
 		int (*archive_write_free)(archive*);
 	
 		int (*archive_write_set_compression_gzip)(archive* );
+		int (*archive_write_add_filter_zstd)(archive* );
+		int (*archive_write_set_filter_option)(archive* , const char* module,
+			const char* option, const char* value);
 		int (*archive_write_set_format_pax_restricted)(archive* );
+		int (*archive_write_set_bytes_in_last_block)(archive* , int bytes);
 		int (*archive_write_open_FILE)(archive* , FILE* file);
 	
 		int (*archive_write_header)(archive*, archive_entry*);
@@ -16,6 +16,7 @@
 #include <iostream>
 #include <sstream>
 #include <cassert>
+#include <atomic>
 #include <minerva/util/interface/Timer.h>
 
 #include <iosfwd>
@@ -139,6 +140,42 @@ namespace util
 	
 	extern bool isLogEnabled(const std::string& logName);
 
+	/*! \brief A log whose enabled flag is cached, for use on hot paths.
+	
+		Channels are declared once per file (at namespace scope) and used
+		with logIf(channel), checking a channel is a single load and
+		branch, and the message is only evaluated if it is enabled.
+	*/
+	class LogChannel
+	{
+	public:
+		explicit LogChannel(const std::string& name);
+		~LogChannel();
+	
+	public:
+		LogChannel(const LogChannel&) = delete;
+		LogChannel& operator=(const LogChannel&) = delete;
+	
+	public:
+		bool isEnabled() const
+		{
+			return _enabled.load(std::memory_order_relaxed);
+		}
+		
+		/*! \brief Get the stream for an enabled channel */
+		std::ostream& stream() const;
+	
+	public:
+		const std::string& name() const;
+		
+		/*! \brief Update the cached flag, called when logs are enabled */
+		void refresh();
+	
+	private:
+		std::string       _name;
+		std::atomic<bool> _enabled;
+	};
+
 
 	extern void enableAllLogs();
 	extern void enableLog(const std::string& logName);
@@ -164,6 +201,22 @@ inline minerva::util::NullStream & operator<<(minerva::util::NullStream & s,
 	return s;
 }
 
+/*!
+	\def logIf(channel)
+	\brief a MACRO that streams to a LogChannel only if it is enabled, the
+		expressions after it are not evaluated otherwise.
+		
+	Defining MINERVA_DISABLE_LOGS compiles the messages out entirely.
+*/
+
+#ifndef MINERVA_DISABLE_LOGS
+	#define logIf(channel) \
+		if(!(channel).isEnabled()) {} else (channel).stream()
+#else
+	#define logIf(channel) \
+		if(true) {} else (channel).stream()
+#endif
+
 /*!
 
 	\def REPORT_ERROR_LEVEL
@@ -219,7 +219,116 @@ namespace json {
 	};
 
 	/*!
-		Parses an istream into a JSON array
+		Bump allocator that Document allocates its nodes from; everything is
+		released at once when the arena is cleared or destroyed
+	*/
+	class Arena {
+	public:
+		explicit Arena(size_t block_size = 64 * 1024);
+		~Arena();
+
+		Arena(const Arena &) = delete;
+		Arena &operator=(const Arena &) = delete;
+
+		void *allocate(size_t size, size_t alignment);
+
+		//! releases every allocation
+		void clear();
+
+	private:
+		std::vector< char * > _blocks;
+		char *_position;
+		size_t _remaining;
+		size_t _block_size;
+	};
+
+	/*!
+		SAX-style callbacks, invoked by Reader in document order. Strings are
+		only valid for the duration of the call.
+	*/
+	class Handler {
+	public:
+		virtual ~Handler();
+
+		virtual void begin_object();
+		virtual void key(const char *data, size_t length);
+		virtual void end_object();
+
+		virtual void begin_array();
+		virtual void end_array();
+
+		virtual void string(const char *data, size_t length);
+		virtual void integer(long long int value);
+		virtual void real(double value);
+		virtual void boolean(bool value);
+		virtual void null();
+	};
+
+	/*!
+		Single-pass parser over a contiguous buffer, which does not need to be
+		null-terminated (e.g. a memory mapped file)
+	*/
+	class Reader {
+	public:
+		Reader(Handler &handler);
+
+		/*!
+			parses one value from [begin, end) and returns a pointer just past it
+		*/
+		const char *parse(const char *begin, const char *end);
+
+		int line_number;
+
+	private:
+		void skip_whitespace();
+		void parse_value();
+		void parse_object();
+		void parse_array();
+		void parse_number();
+		void parse_string(bool is_key);
+		void parse_identifier(bool is_key);
+
+		void error(const char *message) const;
+
+	private:
+		Handler &_handler;
+
+		const char *_position;
+		const char *_end;
+
+		std::string _scratch;
+	};
+
+	/*!
+		Owns a tree parsed from a buffer or file; nodes are allocated from an
+		arena and are released with the document
+	*/
+	class Document {
+	public:
+		Document();
+		~Document();
+
+		Document(const Document &) = delete;
+		Document &operator=(const Document &) = delete;
+
+		//! parses a buffer, which does not need to outlive the document
+		Value *parse(const char *data, size_t size);
+		Value *parse(const std::string &text);
+
+		//! memory maps a file and parses it
+		Value *load(const std::string &path);
+
+		Value *root() const;
+
+		void clear();
+
+	private:
+		Arena _arena;
+		Value *_root;
+	};
+
+	/*!
+		Parses an istream into a heap allocated tree owned by the caller
 	*/
 	class Parser {
 	public:
@@ -235,16 +344,12 @@ namespace json {
 
 	public:
 
-		int get_non_whitespace_char(std::istream &input);
-		int get_char(std::istream &input);
-		void putback(std::istream &input, int ch);
-
+		/*!
+			parse one value, leaving a seekable stream positioned just past it
+		*/
 		Value *parse_value(std::istream &input);
 		Value *parse_array(std::istream &input);
 		Object *parse_object(std::istream &input);
-		Number *parse_number(std::istream &input);
-		String *parse_string(std::istream &input);
-		String *parse_identifier(std::istream &input);
 	};
 
 	/*!
@@ -8,6 +8,7 @@
 
 // Standard Library Includes
 #include <cstring>
+#include <vector>
 
 namespace minerva
 {
@@ -21,6 +22,9 @@ size_t getSquareRoot(size_t number);
 /*! \brief Get the nearest to square factors of a number (e.g. 8, 5 for 40) */
 void getNearestToSquareFactors(size_t& factor1, size_t& factor2, size_t number);
 
+/*! \brief Get the value at a percentile in [0, 100] of an unsorted set */
+double getPercentile(std::vector<double> values, double percentile);
+
 }
 
 }
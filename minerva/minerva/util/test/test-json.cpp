@@ -0,0 +1,261 @@
+/*! \file   test-json.cpp
+	\author Gregory Diamos
+	\date   Sunday October 18, 2026
+	\brief  A unit test for the json reader.
+*/
+
+// Minerva Includes
+#include <minerva/util/interface/json.h>
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/ArgumentParser.h>
+
+// Standard Library Includes
+#include <iostream>
+#include <string>
+#include <climits>
+#include <cmath>
+
+namespace minerva
+{
+
+namespace util
+{
+
+static bool parses(const std::string& text, json::Document& document,
+	size_t size = std::string::npos)
+{
+	try
+	{
+		document.parse(text.data(), std::min(size, text.size()));
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "  Unexpected error parsing '" << text << "': "
+			<< e.what() << "\n";
+		return false;
+	}
+
+	return true;
+}
+
+static bool throws(const std::string& text, size_t size = std::string::npos)
+{
+	json::Document document;
+
+	try
+	{
+		document.parse(text.data(), std::min(size, text.size()));
+	}
+	catch(const std::exception&)
+	{
+		return true;
+	}
+
+	std::cout << "  Parsing '" << text.substr(0, size) << "' did not fail\n";
+
+	return false;
+}
+
+static bool check(bool condition, const std::string& message)
+{
+	if(!condition)
+	{
+		std::cout << "  " << message << "\n";
+	}
+
+	return condition;
+}
+
+static bool reportTest(bool passed, const std::string& name)
+{
+	std::cout << " Json " << name << " Test " << (passed ? "Passed" : "Failed")
+		<< "\n";
+
+	return passed;
+}
+
+static bool testCommentsAndTrailingCommas()
+{
+	json::Document document;
+
+	std::string text =
+		"# a comment before the value\n"
+		"{\n"
+		"	\"numbers\" : [1, 2, 3,], # a comment after a value\n"
+		"	unquoted : \"value\",\n"
+		"	\"flags\" : [true, False, null,],\n"
+		"}\n";
+
+	bool passed = parses(text, document);
+
+	if(passed)
+	{
+		auto& object = document.root()->as_object();
+
+		passed &= check(object.size() == 3, "Wrong number of keys");
+		passed &= check(object.count("numbers") != 0 &&
+			object.at("numbers")->as_dense_array().size() == 3,
+			"Trailing comma changed the array");
+		passed &= check(object.count("unquoted") != 0 &&
+			object.at("unquoted")->as_string() == "value",
+			"Unquoted key was not read");
+		passed &= check(object.count("flags") != 0 &&
+			object.at("flags")->as_array().size() == 3,
+			"Identifiers were not read");
+	}
+
+	passed &= check(document.parse("# only a comment\n 7")->as_integer() == 7,
+		"Comment before a number was not skipped");
+
+	return reportTest(passed, "Comments And Trailing Commas");
+}
+
+static bool testEscapes()
+{
+	json::Document document;
+
+	std::string text = "\"q\\\"b\\\\s\\/ n\\n t\\t u\\u00e9 e\\u20AC a\\u0041\"";
+
+	bool passed = parses(text, document);
+
+	if(passed)
+	{
+		passed &= check(document.root()->as_string() ==
+			"q\"b\\s/ n\n t\t u\xc3\xa9 e\xe2\x82\xac a" "A",
+			"Escapes decoded to '" + document.root()->as_string() + "'");
+	}
+
+	passed &= throws("\"\\u00zz\"");
+	passed &= throws("\"\\u00\"");
+	passed &= throws("\"\\q\"");
+
+	return reportTest(passed, "Escapes");
+}
+
+static bool testTruncatedInput()
+{
+	bool passed = true;
+
+	passed &= throws("");
+	passed &= throws("{\"a\" : [1, 2");
+	passed &= throws("{\"a\" : [1, 2,");
+	passed &= throws("{\"a\"");
+	passed &= throws("{\"a\" :");
+	passed &= throws("\"abc");
+	passed &= throws("\"abc\\");
+	passed &= throws("\"\\u00e");
+	passed &= throws("-");
+	passed &= throws("1.");
+	passed &= throws("1e+");
+
+	return reportTest(passed, "Truncated Input");
+}
+
+static bool testUnterminatedBuffer()
+{
+	json::Document document;
+
+	bool passed = true;
+
+	// the characters past the end of the buffer must not be read
+	passed &= parses("12345", document, 3) &&
+		check(document.root()->as_integer() == 123, "Read past an integer");
+	passed &= parses("1.57", document, 3) &&
+		check(document.root()->as_real() == 1.5, "Read past a real");
+	passed &= parses("\"abc\"def", document, 5) &&
+		check(document.root()->as_string() == "abc", "Read past a string");
+	passed &= parses("truest", document, 4) &&
+		check(document.root()->as_boolean(), "Read past an identifier");
+	passed &= parses("[1, 2]3", document, 6) &&
+		check(document.root()->as_dense_array().size() == 2,
+			"Read past an array");
+
+	passed &= throws("\"abc\"", 4);
+	passed &= throws("[1, 2]", 5);
+
+	return reportTest(passed, "Unterminated Buffer");
+}
+
+static bool testNumberLimits()
+{
+	json::Document document;
+
+	bool passed = true;
+
+	passed &= parses("9223372036854775807", document) &&
+		check((long long int)document.root()->as_integer() == LLONG_MAX,
+			"Largest integer was not read");
+	passed &= parses("-9223372036854775808", document) &&
+		check((long long int)document.root()->as_integer() == LLONG_MIN,
+			"Smallest integer was not read");
+
+	passed &= throws("9223372036854775808");
+	passed &= throws("-9223372036854775809");
+	passed &= throws("123456789012345678901234");
+
+	// a long mantissa is fine for a real
+	passed &= parses("123456789012345678901234.5", document) &&
+		check(std::fabs(document.root()->as_real() - 1.234567890123e23) < 1.0e12,
+			"Real with a long mantissa was not read");
+
+	passed &= throws("0." + std::string(70, '1'));
+	passed &= throws("1e999");
+	passed &= throws("-1e999");
+
+	return reportTest(passed, "Number Limits");
+}
+
+static void runTest()
+{
+	bool passed = testCommentsAndTrailingCommas();
+
+	passed &= testEscapes();
+	passed &= testTruncatedInput();
+	passed &= testUnterminatedBuffer();
+	passed &= testNumberLimits();
+
+	if(passed)
+	{
+		std::cout << "Test Passed\n";
+	}
+	else
+	{
+		std::cout << "Test Failed\n";
+	}
+}
+
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+
+	bool verbose = false;
+
+	parser.description("The minerva json reader test.");
+
+	parser.parse("-v", "--verbose", verbose, false,
+		"Print out log messages during execution");
+
+	parser.parse();
+
+	if(verbose)
+	{
+		minerva::util::enableAllLogs();
+	}
+
+	try
+	{
+		minerva::util::runTest();
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Json Test Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+	}
+
+	return 0;
+}
+
@@ -0,0 +1,144 @@
+/*! \file   test-log-overhead.cpp
+	\author Gregory Diamos
+	\date   Sunday October 18, 2026
+	\brief  A benchmark for the cost of disabled log statements.
+*/
+
+// Minerva Includes
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Timer.h>
+#include <minerva/util/interface/ArgumentParser.h>
+
+// Standard Library Includes
+#include <iostream>
+#include <string>
+
+namespace minerva
+{
+
+namespace util
+{
+
+static LogChannel benchmarkLog("LogOverheadBenchmark");
+
+static size_t evaluations = 0;
+
+static std::string expensiveMessage()
+{
+	++evaluations;
+	
+	return std::string(256, 'x');
+}
+
+static double timeUncachedLogs(size_t iterations)
+{
+	Timer timer;
+	
+	timer.start();
+	
+	for(size_t i = 0; i < iterations; ++i)
+	{
+		log("LogOverheadBenchmark") << expensiveMessage() << "\n";
+	}
+	
+	timer.stop();
+	
+	return timer.seconds();
+}
+
+static double timeChannelLogs(size_t iterations)
+{
+	Timer timer;
+	
+	timer.start();
+	
+	for(size_t i = 0; i < iterations; ++i)
+	{
+		logIf(benchmarkLog) << expensiveMessage() << "\n";
+	}
+	
+	timer.stop();
+	
+	return timer.seconds();
+}
+
+static bool testDisabledLogOverhead(size_t iterations)
+{
+	evaluations = 0;
+	
+	double uncached = timeUncachedLogs(iterations);
+	
+	bool uncachedEvaluated = evaluations == iterations;
+	
+	evaluations = 0;
+	
+	double channel = timeChannelLogs(iterations);
+	
+	bool channelEvaluated = evaluations != 0;
+	
+	std::cout << " util::log:        " << (uncached * 1.0e9 / iterations)
+		<< " ns per disabled statement\n";
+	std::cout << " logIf(channel):   " << (channel * 1.0e9 / iterations)
+		<< " ns per disabled statement\n";
+	
+	// the message must only be built when the channel is enabled
+	bool passed = uncachedEvaluated && !channelEvaluated;
+	
+	enableLog("LogOverheadBenchmark");
+	
+	passed &= benchmarkLog.isEnabled();
+	
+	if(passed)
+	{
+		std::cout << " Log Overhead Test Passed\n";
+	}
+	else
+	{
+		std::cout << " Log Overhead Test Failed\n";
+	}
+	
+	return passed;
+}
+
+static void runTest(size_t iterations)
+{
+	if(testDisabledLogOverhead(iterations))
+	{
+		std::cout << "Test Passed\n";
+	}
+	else
+	{
+		std::cout << "Test Failed\n";
+	}
+}
+
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+	
+	size_t iterations = 0;
+
+	parser.description("The minerva disabled log overhead benchmark.");
+
+	parser.parse("-i", "--iterations", iterations, 1000000,
+		"The number of log statements to time.");
+
+	parser.parse();
+
+	try
+	{
+		minerva::util::runTest(iterations);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Log Overhead Test Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+	}
+
+	return 0;
+}
+
@@ -30,16 +30,9 @@ public:
 public:
 	ImageLibraryDatabase()
 	{
-		_libraries = ImageLibraryFactory::createAll();
-		
-		for(auto library : _libraries)
+		for(auto library : ImageLibraryFactory::createAll())
 		{
-			auto formats = library->getSupportedExtensions();
-			
-			for(auto format : formats)
-			{
-				libraries.insert(std::make_pair(format, library));
-			}
+			add(library);
 		}
 	}
 	
@@ -51,6 +44,19 @@ public:
 		}
 	}
 
+public:
+	void add(ImageLibrary* library)
+	{
+		_libraries.push_back(library);
+		
+		auto formats = library->getSupportedExtensions();
+		
+		for(auto format : formats)
+		{
+			libraries[format] = library;
+		}
+	}
+
 public:
 	ExtensionToLibraryMap libraries;
 
@@ -172,6 +178,11 @@ void ImageLibraryInterface::addTextToStatusBar(const std::string& text)
 	library->second->addTextToStatusBar(text);
 }
 
+void ImageLibraryInterface::addLibrary(ImageLibrary* library)
+{
+	database.add(library);
+}
+
 ImageLibraryInterface::Header::Header(unsigned int X, unsigned int Y,
 	unsigned int c, unsigned int p)
 : x(X), y(Y), colorComponents(c), pixelSize(p)
@@ -12,10 +12,12 @@
 #include <minerva/util/interface/string.h>
 #include <minerva/util/interface/debug.h>
 #include <minerva/util/interface/paths.h>
+#include <minerva/util/interface/Knobs.h>
 
 // Standard Library Includes
 #include <stdexcept>
 #include <cstring>
+#include <algorithm>
 
 namespace minerva
 {
@@ -23,6 +25,8 @@ namespace minerva
 namespace video
 {
 
+static util::Knob<size_t> keyframeInterval("OpenCVVideoLibrary::KeyframeInterval",
+	12, "The assumed number of frames between keyframes of a video");
 
 VideoStream* OpenCVVideoLibrary::newStream(const std::string& path)
 {
@@ -109,6 +113,13 @@ bool OpenCVVideoLibrary::OpenCVVideoStream::seek(size_t frame)
 	return true;
 }
 
+size_t OpenCVVideoLibrary::OpenCVVideoStream::getSeekCost(size_t frame) const
+{
+	// OpenCV does not report where the decoder started, assume a fixed
+	//  distance between keyframes
+	return frame % std::max((size_t)1, (size_t)keyframeInterval);
+}
+
 }
 
 }
@@ -12,6 +12,7 @@
 
 #include <minerva/util/interface/paths.h>
 #include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
 
 // Standard Library Includes
 #include <stdexcept>
@@ -23,15 +24,23 @@ namespace minerva
 namespace video
 {
 
+// Seeking decodes from the previous keyframe, so only seek when the gap
+//  is larger than a typical group of pictures
+static util::Knob<size_t> maximumFramesToDecodeInsteadOfSeeking(
+	"Video::MaximumFramesToDecodeInsteadOfSeeking", 64,
+	"Decode forward over gaps up to this many frames rather than seeking");
+
 Video::Video(const std::string& p)
-: _path(p), _frame(0), _library(nullptr), _stream(nullptr)
+: _path(p), _frame(0), _decodedFrames(0), _seeks(0), _library(nullptr),
+	_stream(nullptr)
 {
 
 }
 
 Video::Video(const std::string& path, const std::string& label,
 	unsigned int beginFrame, unsigned int endFrame)
-: _path(path), _frame(0), _labels(1, Label(label, beginFrame, endFrame)),
+: _path(path), _frame(0), _decodedFrames(0), _seeks(0),
+	_labels(1, Label(label, beginFrame, endFrame)),
 	_library(nullptr), _stream(nullptr)
 {
 	
@@ -43,8 +52,8 @@ Video::~Video()
 }
 
 Video::Video(const Video& v)
-: _path(v._path), _frame(v._frame), _labels(v._labels), _library(nullptr),
-	_stream(nullptr)
+: _path(v._path), _frame(v._frame), _decodedFrames(0), _seeks(0),
+	_labels(v._labels), _library(nullptr), _stream(nullptr)
 {
 
 }
@@ -104,6 +113,13 @@ void Video::invalidateCache()
 	_stream  = nullptr;
 }
 
+void Video::close()
+{
+	invalidateCache();
+	
+	_frame = 0;
+}
+
 ImageVector Video::getNextFrames(unsigned int frames)
 {
 	load();
@@ -148,14 +164,65 @@ Image Video::getSpecificFrame(unsigned int frame)
     if(_stream->getNextFrame(image))
 	{
 		image.setLabel(_getLabelForCurrentFrame());
+		
+		++_decodedFrames;
 	}
 
 	util::log("Video") << "Getting specific frame " << frame << " from video "
 		<< path() << " with label '" << image.label() << "' \n";
 	
+	// the stream is now positioned after the decoded frame
+	++_frame;
+	
 	return image;
 }
 
+ImageVector Video::getSpecificFrames(const FrameVector& frames)
+{
+	load();
+	
+	size_t maximumFramesToSkip = maximumFramesToDecodeInsteadOfSeeking;
+	
+	ImageVector images;
+	
+	for(auto frame : frames)
+	{
+		if(frame < _frame || frame - _frame > maximumFramesToSkip)
+		{
+			_seek(frame);
+		}
+		
+		while(_frame < frame)
+		{
+			Image skipped;
+			
+			if(!_stream->getNextFrame(skipped)) break;
+			
+			++_decodedFrames;
+			++_frame;
+		}
+		
+		Image image;
+		
+		if(_stream->getNextFrame(image))
+		{
+			image.setLabel(_getLabelForCurrentFrame());
+			
+			++_decodedFrames;
+		}
+		
+		util::log("Video") << "Getting frame " << frame << " from video "
+			<< path() << " with label '" << image.label()
+			<< "' by sequential decode\n";
+		
+		images.push_back(image);
+		
+		++_frame;
+	}
+	
+	return images;
+}
+
 size_t Video::getTotalFrames()
 {
 	load();
@@ -170,6 +237,16 @@ bool Video::finished()
 	return _stream->finished();
 }
 
+size_t Video::getDecodedFrameCount() const
+{
+	return _decodedFrames;
+}
+
+size_t Video::getSeekCount() const
+{
+	return _seeks;
+}
+
 Video::LabelVector Video::getLabels() const
 {
 	return _labels;
@@ -196,6 +273,11 @@ void Video::_seek(unsigned int frame)
 {
 	_stream->seek(frame);
 	_frame = frame;
+	
+	// count the frames decoded inside the seek too
+	_decodedFrames += _stream->getSeekCost(frame);
+	
+	++_seeks;
 }
 
 std::string Video::_getLabelForCurrentFrame() const
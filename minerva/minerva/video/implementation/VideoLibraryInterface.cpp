@@ -28,16 +28,9 @@ public:
 public:
 	VideoLibraryDatabase()
 	{
-		_libraries = VideoLibraryFactory::createAll();
-		
-		for(auto library : _libraries)
+		for(auto library : VideoLibraryFactory::createAll())
 		{
-			auto formats = library->getSupportedExtensions();
-			
-			for(auto format : formats)
-			{
-				libraries.insert(std::make_pair(format, library));
-			}
+			add(library);
 		}
 	}
 	
@@ -49,6 +42,19 @@ public:
 		}
 	}
 
+public:
+	void add(VideoLibrary* library)
+	{
+		_libraries.push_back(library);
+		
+		auto formats = library->getSupportedExtensions();
+		
+		for(auto format : formats)
+		{
+			libraries[format] = library;
+		}
+	}
+
 public:
 	ExtensionToLibraryMap libraries;
 
@@ -79,6 +85,11 @@ VideoLibrary* VideoLibraryInterface::getLibraryThatSupports(
 	return library->second;
 }
 
+void VideoLibraryInterface::addLibrary(VideoLibrary* library)
+{
+	database.add(library);
+}
+
 }
 
 }
@@ -11,6 +11,9 @@
 #include <string>
 #include <cstdint>
 
+// Forward Declarations
+namespace minerva { namespace video { class ImageLibrary; } }
+
 namespace minerva
 {
 
@@ -55,6 +58,10 @@ public:
 	static void waitForKey(int delayInMilliseconds = 0);
 	static void addTextToStatusBar(const std::string& text);
 
+public:
+	/*! \brief Add a library for its extensions, taking ownership of it. */
+	static void addLibrary(ImageLibrary* library);
+
 };
 
 }
@@ -44,6 +44,7 @@ public:
 		virtual bool getNextFrame(Image&);
 		virtual size_t getTotalFrames() const;
 		virtual bool seek(size_t frame);
+		virtual size_t getSeekCost(size_t frame) const;
 	
 	private:
 		std::string _path;
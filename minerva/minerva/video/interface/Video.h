@@ -42,6 +42,7 @@ public:
 	};
 
 	typedef std::vector<Label> LabelVector;
+	typedef std::vector<unsigned int> FrameVector;
 
 public:
 	explicit Video(const std::string& path = "");
@@ -58,15 +59,28 @@ public:
 	void load();
 	
 	void invalidateCache();
+	
+	/*! \brief Release the underlying stream and rewind to the first frame. */
+	void close();
 
 public:
 	ImageVector getNextFrames(unsigned int frames = 1);
 	Image getSpecificFrame(unsigned int frame);
+	
+	/*! \brief Get a set of frames (sorted in increasing order) by decoding
+		forward through the video, only seeking over large gaps. */
+	ImageVector getSpecificFrames(const FrameVector& frames);
 
 	size_t getTotalFrames();
 	
 	bool finished();
 
+public:
+	/*! \brief Get the total number of frames decoded from this video. */
+	size_t getDecodedFrameCount() const;
+	/*! \brief Get the total number of seeks performed on this video. */
+	size_t getSeekCount() const;
+
 public:
 	LabelVector getLabels() const;
 	
@@ -88,6 +102,10 @@ private:
 	std::string   _path;
 	unsigned int  _frame;
 
+private:
+	size_t _decodedFrames;
+	size_t _seeks;
+
 private:
 	LabelVector _labels;
 
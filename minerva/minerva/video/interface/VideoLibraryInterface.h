@@ -26,6 +26,10 @@ public:
 public:
 	static VideoLibrary* getLibraryThatSupports(const std::string& path);
 
+public:
+	/*! \brief Add a library for its extensions, taking ownership of it. */
+	static void addLibrary(VideoLibrary* library);
+
 };
 
 }
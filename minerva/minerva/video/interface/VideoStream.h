@@ -28,6 +28,9 @@ public:
 	virtual bool getNextFrame(Image&) = 0;
 	virtual size_t getTotalFrames() const = 0;
 	virtual bool seek(size_t f) = 0;
+	/*! \brief The number of frames that seeking to frame 'f' decodes and
+		discards, the decoder starts from the keyframe before it. */
+	virtual size_t getSeekCost(size_t f) const = 0;
 
 };
 
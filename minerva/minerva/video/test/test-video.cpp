@@ -0,0 +1,228 @@
+/*! \file   test-video.cpp
+	\author Gregory Diamos
+	\date   Sunday October 18, 2026
+	\brief  A unit test for reading specific frames of a video.
+*/
+
+// Minerva Includes
+#include <minerva/video/interface/Video.h>
+#include <minerva/video/interface/VideoLibrary.h>
+#include <minerva/video/interface/VideoLibraryInterface.h>
+#include <minerva/video/interface/VideoStream.h>
+#include <minerva/video/interface/Image.h>
+
+#include <minerva/util/interface/debug.h>
+#include <minerva/util/interface/Knobs.h>
+#include <minerva/util/interface/ArgumentParser.h>
+
+// Standard Library Includes
+#include <iostream>
+#include <sstream>
+
+namespace minerva
+{
+
+namespace video
+{
+
+/*! \brief A stream whose frames hold their own index as the only pixel,
+	with a keyframe every 'keyframeInterval' frames. */
+class SyntheticVideoStream : public VideoStream
+{
+public:
+	SyntheticVideoStream(size_t frames, size_t keyframeInterval)
+	: _frames(frames), _keyframeInterval(keyframeInterval), _frame(0)
+	{
+
+	}
+
+public:
+	virtual bool finished() const
+	{
+		return _frame >= _frames;
+	}
+
+	virtual bool getNextFrame(Image& image)
+	{
+		if(finished())
+		{
+			return false;
+		}
+
+		image = Image(1, 1, 1, 1);
+
+		image.setComponentAt(0, 0, 0, _frame);
+
+		++_frame;
+
+		return true;
+	}
+
+	virtual size_t getTotalFrames() const
+	{
+		return _frames;
+	}
+
+	virtual bool seek(size_t frame)
+	{
+		_frame = frame;
+
+		return true;
+	}
+
+	virtual size_t getSeekCost(size_t frame) const
+	{
+		return frame % _keyframeInterval;
+	}
+
+private:
+	size_t _frames;
+	size_t _keyframeInterval;
+	size_t _frame;
+
+};
+
+class SyntheticVideoLibrary : public VideoLibrary
+{
+public:
+	SyntheticVideoLibrary(size_t frames, size_t keyframeInterval)
+	: _frames(frames), _keyframeInterval(keyframeInterval)
+	{
+
+	}
+
+public:
+	virtual VideoStream* newStream(const std::string& path)
+	{
+		return new SyntheticVideoStream(_frames, _keyframeInterval);
+	}
+
+	virtual void freeStream(VideoStream* s)
+	{
+		delete s;
+	}
+
+public:
+	virtual StringVector getSupportedExtensions() const
+	{
+		return StringVector(1, ".synthetic");
+	}
+
+private:
+	size_t _frames;
+	size_t _keyframeInterval;
+
+};
+
+static std::string toString(size_t value)
+{
+	std::stringstream stream;
+
+	stream << value;
+
+	return stream.str();
+}
+
+static bool getFrames(size_t maximumFramesToDecode, const Video::FrameVector& frames,
+	size_t expectedDecodedFrames, size_t expectedSeeks, const std::string& name)
+{
+	util::KnobDatabase::setKnob("Video::MaximumFramesToDecodeInsteadOfSeeking",
+		toString(maximumFramesToDecode));
+
+	Video video("frames.synthetic");
+
+	auto images = video.getSpecificFrames(frames);
+
+	bool passed = images.size() == frames.size();
+
+	for(size_t i = 0; passed && i < frames.size(); ++i)
+	{
+		float frame = images[i].getComponentAt(0, 0, 0);
+
+		if(frame != frames[i])
+		{
+			std::cout << "  " << name << " read frame " << frame
+				<< " instead of " << frames[i] << "\n";
+			passed = false;
+		}
+	}
+
+	if(video.getDecodedFrameCount() != expectedDecodedFrames)
+	{
+		std::cout << "  " << name << " decoded " << video.getDecodedFrameCount()
+			<< " frames, expected " << expectedDecodedFrames << "\n";
+		passed = false;
+	}
+
+	if(video.getSeekCount() != expectedSeeks)
+	{
+		std::cout << "  " << name << " seeked " << video.getSeekCount()
+			<< " times, expected " << expectedSeeks << "\n";
+		passed = false;
+	}
+
+	std::cout << " Video " << name << " Test " << (passed ? "Passed" : "Failed")
+		<< "\n";
+
+	return passed;
+}
+
+static void runTest()
+{
+	VideoLibraryInterface::addLibrary(new SyntheticVideoLibrary(200, 8));
+
+	Video::FrameVector frames = {3, 10, 100, 40, 41, 180};
+
+	// decode forward over every gap, only seek back to frame 40 (a keyframe)
+	bool passed = getFrames(1000, frames,
+		4 + 7 + 90 + (0 + 1) + 1 + 139, 1, "Sequential Decode");
+
+	// seek to every frame except 41, which directly follows 40
+	passed &= getFrames(0, frames,
+		(3 + 1) + (2 + 1) + (4 + 1) + (0 + 1) + 1 + (4 + 1), 5, "Seek");
+
+	if(passed)
+	{
+		std::cout << "Test Passed\n";
+	}
+	else
+	{
+		std::cout << "Test Failed\n";
+	}
+}
+
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	minerva::util::ArgumentParser parser(argc, argv);
+
+	bool verbose = false;
+
+	parser.description("The minerva video frame access test.");
+
+	parser.parse("-v", "--verbose", verbose, false,
+		"Print out log messages during execution");
+
+	parser.parse();
+
+	if(verbose)
+	{
+		minerva::util::enableAllLogs();
+	}
+
+	try
+	{
+		minerva::video::runTest();
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "Minerva Video Test Failed:\n";
+		std::cout << "Message: " << e.what() << "\n\n";
+	}
+
+	return 0;
+}
+